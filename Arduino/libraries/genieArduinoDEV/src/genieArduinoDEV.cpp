@@ -62,6 +62,8 @@ Genie::Genie() {
   UserHandler = nullptr;
   UserByteReader = nullptr;
   UserDoubleByteReader = nullptr;
+  UserTxHandler = nullptr;
+  UserBaudSetter = nullptr;
   debugSerial = nullptr;
 }
 
@@ -89,19 +91,15 @@ bool Genie::Begin(Stream &serial, uint16_t txDelay) {
 }
 
 bool Genie::Begin_common() {
+  /* Detection no longer waits here: the first DoEvents() pings the display and
+     DoEvents() queues GENIE_READY once it answers. Returns 1 only if it already has. */
   genieStart = 1;
-  _incomming_queue.clear();
-  uint32_t timeout_start = millis(); // timeout timer
-  while ( millis() - timeout_start <= 2000 ) { 
-    if ( DoEvents() == GENIE_REPORT_OBJ && !genieStart ) return 1;
-  }
-  if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Failed to detect display during setup"));
-  if ( UserHandler ) {
-    uint8_t buffer[6] = { GENIE_DISCONNECTED, 0, 0, 0, 0 };
-    _incomming_queue.push_back(buffer, 6);
-  }
   displayDetected = 0;
-  return 0;
+  _incomming_queue.clear();
+  begin_time = millis();
+  autoPingTimer = begin_time - recover_pulse - 1; /* ping on the first pass */
+  DoEvents();
+  return displayDetected;
 }
 
 void Genie::AttachDebugStream(Stream &serial) {
@@ -155,17 +153,122 @@ uint32_t Genie::GetUptime() {
   else return 0;
 }
 
+// ######################################
+// ## Send Status #######################
+// ######################################
+
+void Genie::AttachTxCompleteHandler(UserTxCompletePtr userHandler) {
+  UserTxHandler = userHandler;
+}
+
+bool Genie::IsIdle() {
+  return !pendingACK && !_priority_queue.size() && !_long_queue.size() && !_outgoing_queue.size();
+}
+
+uint8_t Genie::GetTxStatus() {
+  return tx_status;
+}
+
+uint32_t Genie::GetTxTimeouts() {
+  return tx_timeouts;
+}
+
+uint32_t Genie::GetTxFrames() {
+  return tx_frames;
+}
+
+uint16_t Genie::GetTxPending() { /* frames queued or awaiting an ACK; all go out in this order */
+  return ( pendingACK ? 1 : 0 ) + _priority_queue.size() + long_frames + _outgoing_queue.size();
+}
+
+// ######################################
+// ## Baud Negotiation ##################
+// ######################################
+
+void Genie::NegotiateBaud(uint32_t baseBaud, uint32_t fastBaud, uint8_t magicIndex, UserBaudSetPtr setBaud) {
+  baud_base = baud_current = baseBaud;
+  baud_fast = ( setBaud != nullptr ) ? fastBaud : 0;
+  baud_magic_index = magicIndex;
+  UserBaudSetter = setBaud;
+  baud_state = GENIE_BAUD_IDLE; /* starts once the display is online */
+}
+
+uint32_t Genie::GetBaud() {
+  return baud_current;
+}
+
+uint8_t Genie::GetBaudState() {
+  return baud_state;
+}
+
+void Genie::baud_set(uint32_t baud) {
+  baud_current = baud;
+  UserBaudSetter(baud);
+}
+
+void Genie::baud_send(uint8_t op) {
+  uint8_t buffer[9] = { GENIEM_WRITE_BYTES, baud_magic_index, 5, op,
+                        (uint8_t)(baud_fast >> 24), (uint8_t)(baud_fast >> 16), (uint8_t)(baud_fast >> 8), (uint8_t)baud_fast, 0 };
+  for ( uint8_t i = 0; i < 8; i++ ) buffer[8] ^= buffer[i];
+  writeMode(buffer, 9);
+  tx_frame[1] = GENIEM_WRITE_BYTES;
+  tx_frame[2] = 0;
+  tx_frame[3] = baud_magic_index;
+  tx_from_priority = 0;
+  pendingACK = 1;
+  pendingACK_timeout = millis();
+}
+
+void Genie::baud_fallback() {
+  if ( debugSerial != nullptr ) {
+    debugSerial->print(F("[Genie]: No answer at "));
+    debugSerial->print(baud_fast);
+    debugSerial->print(F(" baud, back to "));
+    debugSerial->println(baud_base);
+  }
+  baud_set(baud_base);
+  baud_state = GENIE_BAUD_FAILED; /* not retried; the display reverts on its own */
+  pendingACK = 0;
+  NAK_detected = 0;
+  display_uptime = millis();
+}
+
+void Genie::baud_processing() {
+  switch ( baud_state ) {
+    case GENIE_BAUD_IDLE: {
+        if ( baud_fast && baud_current != baud_fast && displayDetected && !NAK_detected && !pendingACK ) {
+          baud_recommit = 0;
+          baud_send('B');
+          baud_state = GENIE_BAUD_REQUESTED;
+        }
+        break;
+      }
+    case GENIE_BAUD_SETTLING: {
+        if ( millis() - baud_timer >= GENIE_BAUD_SETTLE_MS ) {
+          uint8_t buffer[4] = { (uint8_t)GENIE_READ_OBJ, GENIE_OBJ_FORM , 0, 10 };
+          writeMode(buffer,4);
+          baud_state = GENIE_BAUD_VERIFYING;
+          baud_timer = millis();
+        }
+        break;
+      }
+    case GENIE_BAUD_VERIFYING: {
+        if ( millis() - baud_timer >= GENIE_BAUD_VERIFY_MS ) baud_fallback();
+        break;
+      }
+  }
+}
+
 // ######################################
 // ## GetNextByte ####################### 
 // ######################################
 int16_t Genie::GetNextByte() {
-  if ( magic_report_len-- < 1 ) {
-    magic_report_len = 0;
+  if ( magic_report_len < 1 ) {
     magic_overpull_count++;
     return -1;
   }
-  uint32_t timeout = millis();
-  while ( millis() - timeout < 100 && deviceSerial->available() < 1 );
+  if ( deviceSerial->available() < 1 ) return -1; /* never arrived; dropped with the rest of the report */
+  magic_report_len--;
   return deviceSerial->read();
 }
 
@@ -174,8 +277,7 @@ int16_t Genie::GetNextByte() {
 // ######################################
 int32_t Genie::GetNextDoubleByte() {
   // protection to be implemented
-  uint32_t timeout = millis();
-  while ( millis() - timeout < 200 && deviceSerial->available() < 2 );
+  if ( deviceSerial->available() < 2 ) return -1;
   return ((uint16_t)(deviceSerial->read() << 8) | deviceSerial->read());
 }
 
@@ -192,14 +294,17 @@ int32_t Genie::ReadObject(uint8_t object, uint8_t index, bool now) {
   for ( uint8_t i = 1; i < 4; i++ ) checksum ^= buffer[i];
   buffer[4] = checksum;
   if ( now && displayDetected ) {
+    /* The one synchronous call left: it waits at most 100 ms in total, including
+       for an outstanding ACK. Use now = 0 and the GENIE_REPORT_OBJ event instead
+       wherever a stall matters. */
+    uint32_t timeout = millis();
     block_dequeue = 1; // disable dequeueing
-    while ( pendingACK ) DoEvents(); // wait & finish pending ACKs
+    while ( pendingACK && millis() - timeout <= 100 ) DoEvents(); // finish pending ACKs
     handler_response_request = 1; // request widget value immediately
     handler_response_values[1] = object;
     handler_response_values[2] = index;
     writeMode(&buffer[1],4);
     block_dequeue = 0; // enable dequeueing
-    uint32_t timeout = millis();
     while ( handler_response_request ) {
       if ( millis() - timeout > 100 ) {
         handler_response_request = 0;
@@ -209,7 +314,7 @@ int32_t Genie::ReadObject(uint8_t object, uint8_t index, bool now) {
     }
     return ((int32_t)(handler_response_values[3] << 8) | handler_response_values[4]);
   }
-  if ( !_outgoing_queue.replace(buffer,5,1,2,3) ) {
+  if ( !_outgoing_queue.replace(buffer,5) ) {
     if ( _outgoing_queue.size() == _outgoing_queue.capacity() ) if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Overflow writing frames to queue!"));
     _outgoing_queue.push_back(buffer,5);
   }
@@ -244,6 +349,7 @@ uint16_t Genie::WriteIntLedDigits(uint16_t index, int32_t data) {
 // ######################################
 bool Genie::WriteObject(uint8_t object, uint8_t index, uint16_t data) {
   if ( !displayDetected ) {
+    if ( GENIE_OBJ_FORM == object ) offline_form = index; /* shown once the display is detected */
     DoEvents();
     return 0;
   }
@@ -260,7 +366,7 @@ bool Genie::WriteObject(uint8_t object, uint8_t index, uint16_t data) {
 
   if ( object == GENIE_OBJ_SCOPE ) return WriteObjectPriority(object,index,data);
   if ( object == GENIE_OBJ_COOL_GAUGE ) return WriteObjectPriority(object,index,data);
-  if ( !_outgoing_queue.replace(buffer,7,1,2,3) ) {
+  if ( !_outgoing_queue.replace(buffer,7) ) {
     if ( _outgoing_queue.size() == _outgoing_queue.capacity() ) if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Overflow writing frames to queue!"));
 
     if ( GENIE_OBJ_FORM == object ) {
@@ -285,15 +391,14 @@ bool Genie::WriteObjectPriority(uint8_t object, uint8_t index, uint16_t data) {
   uint8_t checksum = 0, buffer[7] = { (uint8_t)currentForm, GENIE_WRITE_OBJ, object, index, (uint8_t)(data >> 8), (uint8_t)data, 0 };
   for ( uint8_t i = 1; i < 6; i++ ) checksum ^= buffer[i];
   buffer[6] = checksum;
-  block_dequeue = 1; // disable dequeue
-  while ( pendingACK ) DoEvents(); // wait pending ACKs
 
-  writeMode(&buffer[1],6);
-
-  pendingACK = 1; // enable ACK check
-  pendingACK_timeout = millis(); // reset ACK check timer
-  while ( pendingACK ) DoEvents(); // wait pending ACKs
-  block_dequeue = 0; // re-enable dequeue
+  /* Goes out ahead of the normal queue as soon as the link is free. A newer
+     write to the same object (any form, for form changes) replaces a queued one. */
+  if ( !_priority_queue.replace(buffer,7) ) {
+    if ( _priority_queue.size() == _priority_queue.capacity() ) if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Overflow writing priority frames to queue!"));
+    _priority_queue.push_back(buffer,7);
+  }
+  dequeue_processing(); /* send it now if nothing is awaiting an ACK */
 
   return 1;
 }
@@ -309,7 +414,7 @@ bool Genie::WriteContrast(uint8_t value) {
   uint8_t checksum = 0, buffer[4] = { (uint8_t)currentForm, GENIE_WRITE_CONTRAST, value, 0 };
   for ( uint8_t i = 1; i < 3; i++ ) checksum ^= buffer[i];
   buffer[3] = checksum;
-  if ( !_outgoing_queue.replace(buffer,4,1,1,1) ) {
+  if ( !_outgoing_queue.replace(buffer,4) ) {
     _outgoing_queue.push_back(buffer,4);
     return 0;
   }
@@ -340,15 +445,41 @@ void Genie::writeMode(uint8_t *bytes, uint8_t len) {
   }
 }
 
+// ######################################
+// ## Queue String/Magic Frame ##########
+// ######################################
+bool Genie::queue_long(const uint8_t *bytes, uint16_t len) {
+  if ( !displayDetected ) {
+    DoEvents();
+    return 0;
+  }
+  if ( _long_queue.capacity() - _long_queue.size() < len + 2 ) {
+    if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Overflow writing strings to queue!"));
+    return 0;
+  }
+  _long_queue.push_back((uint8_t)(len >> 8));
+  _long_queue.push_back((uint8_t)len);
+  for ( uint16_t i = 0; i < len; i++ ) _long_queue.push_back(bytes[i]);
+  long_frames++;
+  dequeue_processing(); /* send it now if nothing is awaiting an ACK */
+  return 1;
+}
+
 // ######################################
 // ## Do Events #########################
 // ######################################
-inline int16_t Genie::DoEvents() {
+int16_t Genie::DoEvents() {
 
   if ( !displayDetected ) {
     if ( deviceSerial->available() > 24) while(deviceSerial->available()) deviceSerial->read();
     currentForm = -1;
-    pendingACK = 0;
+    magic_pending = 0;
+    rx_discard = 0;
+    if ( pendingACK ) tx_complete(GENIE_TX_OFFLINE);
+    if ( genieStart && millis() - begin_time > 2000 ) {
+      if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Failed to detect display during setup, still trying"));
+      genieStart = 0;
+    }
   }
 
   /* Compatibility with sketches that include reset in setup, to prevent disconnection */
@@ -364,13 +495,17 @@ inline int16_t Genie::DoEvents() {
       uint8_t buffer[6] = { GENIE_DISCONNECTED, 0, 0, 0, 0 };
       _incomming_queue.push_back(buffer, 6);
       displayDetected = 0;
+      if ( baud_current != baud_base ) { /* a display that reset is back at its boot rate */
+        baud_set(baud_base);
+        baud_state = GENIE_BAUD_IDLE;
+      }
     }
     uint8_t buffer[4] = { (uint8_t)GENIE_READ_OBJ, GENIE_OBJ_FORM , 0, 10 };
     writeMode(buffer,4);
     autoPingFlag = 1;
   }
 
-  if ( deviceSerial->available() > 0 ) {
+  if ( !magic_processing() && deviceSerial->available() > 0 ) {
     switch ( deviceSerial->peek() ) {
       case GENIE_REPORT_OBJ: {
           if ( deviceSerial->available() >= 6 ) {
@@ -389,6 +524,19 @@ inline int16_t Genie::DoEvents() {
                   displayDetected = 1;
                   display_uptime = millis();
                   genieStart = 0;
+                  if ( offline_form >= 0 ) {
+                    if ( offline_form != currentForm ) WriteObjectPriority(GENIE_OBJ_FORM, (uint8_t)offline_form, 0);
+                    currentForm = offline_form;
+                    offline_form = -1;
+                  }
+                  return GENIE_REPORT_OBJ;
+                }
+                if ( baud_state == GENIE_BAUD_VERIFYING ) { /* new rate works, tell the display to keep it */
+                  NAK_detected = 0;
+                  autoPingFlag = 0;
+                  display_uptime = millis();
+                  baud_send('C');
+                  baud_state = GENIE_BAUD_COMMITTING;
                   return GENIE_REPORT_OBJ;
                 }
                 if ( NAK_detected ) {
@@ -433,7 +581,7 @@ inline int16_t Genie::DoEvents() {
               if ( GENIE_OBJ_FORM == buffer[1] ) currentForm = buffer[4];
               if ( GENIE_OBJ_4DBUTTON != buffer[1] &&
                    GENIE_OBJ_USERBUTTON != buffer[1] ) {
-                if ( !_incomming_queue.replace(buffer,6,0,1,2 ) ) _incomming_queue.push_back(buffer, 6);
+                if ( !_incomming_queue.replace(buffer,6) ) _incomming_queue.push_back(buffer, 6);
               }
               else _incomming_queue.push_back(buffer, 6);
             }
@@ -441,80 +589,27 @@ inline int16_t Genie::DoEvents() {
           return GENIE_REPORT_EVENT;
         }
 
-      case GENIEM_REPORT_BYTES: {
-          if ( !displayDetected ) { deviceSerial->read(); return 0; }
-          if ( deviceSerial->available() < 4 ) break; // magic report event less than 3 bytes? check again.
-          uint8_t data[] = { (uint8_t)deviceSerial->read(), (uint8_t)deviceSerial->read(), (uint8_t)deviceSerial->read() };
-          magic_report_len = data[2];
-          magic_overpull_count = 0;
-          if ( UserByteReader != nullptr ) {
-            UserByteReader( data[1], data[2] );
-            if ( magic_report_len > 0 ) {
-              if ( debugSerial != nullptr ) {
-                debugSerial->print(F("[Genie]: User forgot "));
-                debugSerial->print(magic_report_len);
-                debugSerial->println(F(" magic byte(s). Flushing rest..."));
-              }
-              uint32_t timeout = millis();
-              while ( magic_report_len && millis() - timeout < 100 ) {
-                if ( deviceSerial->available() > 0 ) {
-                  magic_report_len--;
-                  deviceSerial->read();
-                  timeout = millis();
-                }
-              }
-            }
-            else {
-              if ( debugSerial != nullptr ) {
-                if ( !magic_overpull_count ) debugSerial->println(F("[Genie]: User captured all magic bytes!"));
-                else {
-                  debugSerial->print(F("[Genie]: User captured all magic bytes, but tried to pull more than provided! ("));
-                  debugSerial->print(magic_overpull_count);
-                  debugSerial->println(F(" byte(s))")); 
-                }
-              }
-            }
-            display_uptime = millis();
-          }
-          else {
-            if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: MMagic bytes callback not set!"));
-            for ( uint16_t i = 0; i < data[2]; i++) deviceSerial->read();
-          }
-          uint32_t timeout = millis();
-          while ( millis() - timeout < 5000 && deviceSerial->available() < 1 );
-          deviceSerial->read();
-          return GENIEM_REPORT_BYTES;
-        }
-
+      case GENIEM_REPORT_BYTES:
       case GENIEM_REPORT_DBYTES: {
           if ( !displayDetected ) { deviceSerial->read(); return 0; }
           if ( deviceSerial->available() < 3 ) break; // magic report event less than 3 bytes? check again.
-          uint8_t data[] = { (uint8_t)deviceSerial->read(), (uint8_t)deviceSerial->read(), (uint8_t)deviceSerial->read() };
-          if ( UserDoubleByteReader != nullptr ) {
-            UserDoubleByteReader( data[1], data[2] );
-            (void)GetNextByte();
-            return GENIEM_REPORT_DBYTES;
-            // over/under pulling protection to be implemented as above
-          }
-          else {
-            if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Magic double bytes callback not set!"));
-            for ( uint16_t i = 0; i < 2 * data[2]; i++) deviceSerial->read();
-          }
-          uint32_t timeout = millis();
-          while ( millis() - timeout < 5000 && deviceSerial->available() < 1 );
-          deviceSerial->read();
-          return GENIEM_REPORT_DBYTES;
+          for ( uint8_t i = 0; i < 3; i++ ) magic_header[i] = deviceSerial->read();
+          magic_pending = magic_header[0];
+          magic_timer = millis();
+          magic_processing(); /* hands it to the reader now if the payload is already here */
+          return magic_header[0];
         }
 
       case GENIE_ACK: {
           deviceSerial->read();
           if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Received ACK!"));
-          pendingACK = 0;
+          if ( pendingACK ) tx_complete(GENIE_TX_ACKED);
           return GENIE_ACK;
         }
       case GENIE_NAK: {
           while ( deviceSerial->peek() == GENIE_NAK ) deviceSerial->read();
           if ( !genieStart && !NAK_detected && debugSerial != nullptr ) debugSerial->println(F("[Genie]: Received NAK!"));
+          if ( pendingACK ) tx_complete(GENIE_TX_NAKED);
           NAK_detected = 1;
           NAK_recovery_counter++;
           if ( NAK_recovery_counter >= 2 ) {
@@ -524,14 +619,16 @@ inline int16_t Genie::DoEvents() {
           return GENIE_NAK;
         }
       default: {
+          int16_t bad = deviceSerial->read(); /* drop it so the next frame can be parsed */
           if ( displayDetected && !NAK_detected && debugSerial != nullptr ) {
             debugSerial->print(F("[Genie]: Bad Byte: "));
-            debugSerial->println(deviceSerial->read());
+            debugSerial->println(bad);
           }
           break;
         }
     }
   }
+  baud_processing();
   dequeue_processing();
   if ( !main_handler_active && _incomming_queue.size() && UserHandler != nullptr ) {
     main_handler_active = 1;
@@ -546,37 +643,175 @@ inline int16_t Genie::DoEvents() {
 // ######################################
 
 void Genie::dequeue_processing() {
-  if ( pendingACK ) { /* check if ACK timeout, clear flag */
-    if ( millis() - pendingACK_timeout >= 500 ) {
+  if ( pendingACK ) { /* check if ACK timeout, move on to the next frame */
+    if ( millis() - pendingACK_timeout >= GENIE_ACK_TIMEOUT ) {
       if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: ACK timeout!"));
-      pendingACK = 0;
+      tx_timeouts++;
+      tx_complete(GENIE_TX_TIMEOUT);
     }
+    return;
   }
-  else { /* if no ACK is expected, send another request from queue */
-    if ( !block_dequeue && displayDetected && !NAK_detected && _outgoing_queue.size() ) {
-      uint8_t _dequeued_buffer[7];
-      _outgoing_queue.pop_front(_dequeued_buffer, 7);
-      switch ( _dequeued_buffer[1] ) {
-        case GENIE_WRITE_CONTRAST: {
-            writeMode(&_dequeued_buffer[1], 3); /* allow writing to any form pages. */
-            // if ( _dequeued_buffer[0] == currentForm ) writeMode(&_dequeued_buffer[1], 3); /* only allow writes to current form */
-            break;
-          }
-        case GENIE_READ_OBJ: { 
-            writeMode(&_dequeued_buffer[1], 4);
-            // if ( _dequeued_buffer[0] == currentForm ) writeMode(&_dequeued_buffer[1], 4);
-            return;
+  /* if no ACK is expected, send another request: priority frames, then strings, then objects */
+  if ( block_dequeue || !displayDetected || NAK_detected ) return;
+  if ( baud_state >= GENIE_BAUD_REQUESTED && baud_state <= GENIE_BAUD_COMMITTING ) return;
+  if ( _priority_queue.size() ) {
+    _priority_queue.pop_front(tx_frame, 7);
+    if ( !tx_retrying ) tx_retries_left = GENIE_TX_RETRIES;
+    tx_retrying = 0;
+    tx_from_priority = 1;
+    writeMode(&tx_frame[1], 6);
+  }
+  else if ( _long_queue.size() ) {
+    long_frames--;
+    uint16_t len = (uint16_t)_long_queue.pop_front() << 8;
+    len |= _long_queue.pop_front();
+    for ( uint16_t i = 0; i < len; i++ ) {
+      uint8_t b = _long_queue.pop_front();
+      if ( i < 2 ) tx_frame[i ? 3 : 1] = b; /* cmd, index */
+      deviceSerial->write(b);
+      delayMicroseconds(tx_delay);
+    }
+    tx_frame[2] = 0;
+    tx_from_priority = 0;
+  }
+  else if ( _outgoing_queue.size() ) {
+    _outgoing_queue.pop_front(tx_frame, 7);
+    tx_from_priority = 0;
+    switch ( tx_frame[1] ) {
+      case GENIE_WRITE_CONTRAST: {
+          writeMode(&tx_frame[1], 3); /* allow writing to any form pages. */
+          // if ( tx_frame[0] == currentForm ) writeMode(&tx_frame[1], 3); /* only allow writes to current form */
+          break;
+        }
+      case GENIE_READ_OBJ: { 
+          writeMode(&tx_frame[1], 4);
+          // if ( tx_frame[0] == currentForm ) writeMode(&tx_frame[1], 4);
+          return;
+        }
+      case GENIE_WRITE_OBJ: {
+          writeMode(&tx_frame[1], 6);
+          // if ( tx_frame[0] == currentForm ) writeMode(&tx_frame[1], 6);
+          break;
+        }
+    }
+  }
+  else return;
+  pendingACK = 1;
+  pendingACK_timeout = millis();
+}
+
+// ######################################
+// ## Send Completion ###################
+// ######################################
+
+void Genie::tx_complete(uint8_t status) {
+  pendingACK = 0;
+  if ( baud_state == GENIE_BAUD_REQUESTED ) { /* negotiation frames are not reported to the user */
+    if ( status == GENIE_TX_ACKED ) {
+      baud_set(baud_fast);
+      baud_state = GENIE_BAUD_SETTLING;
+      baud_timer = millis();
+    }
+    else {
+      if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Display refused baud change"));
+      baud_state = GENIE_BAUD_FAILED;
+    }
+    return;
+  }
+  if ( baud_state == GENIE_BAUD_COMMITTING ) {
+    if ( status == GENIE_TX_ACKED ) {
+      if ( debugSerial != nullptr ) {
+        debugSerial->print(F("[Genie]: Link running at "));
+        debugSerial->println(baud_current);
+      }
+      baud_state = GENIE_BAUD_ACTIVE;
+    }
+    else if ( status != GENIE_TX_OFFLINE && !baud_recommit ) {
+      /* The commit may have landed and only its ACK got lost; ping again rather
+         than leave the display at a rate we no longer listen on */
+      baud_recommit = 1;
+      baud_state = GENIE_BAUD_SETTLING;
+      baud_timer = millis();
+    }
+    else if ( status != GENIE_TX_OFFLINE ) baud_fallback();
+    return;
+  }
+  tx_status = status;
+  if ( status == GENIE_TX_ACKED ) tx_frames++;
+  if ( status != GENIE_TX_ACKED && status != GENIE_TX_OFFLINE && tx_from_priority && tx_retries_left ) {
+    tx_retries_left--;
+    tx_retrying = 1;
+    _priority_queue.push_front(tx_frame, 7); /* resend first; reported once the retry finishes */
+    return;
+  }
+  if ( UserTxHandler != nullptr && !tx_handler_active ) {
+    tx_handler_active = 1;
+    UserTxHandler(tx_frame[1], tx_frame[2], tx_frame[3], status);
+    tx_handler_active = 0;
+  }
+}
+
+// ######################################
+// ## Magic Report Processing ###########
+// ######################################
+
+/* Magic reports are handed to the reader only once the whole payload is in the
+   serial buffer (or GENIE_MAGIC_TIMEOUT has passed), so GetNextByte() never waits.
+   Returns 1 while the incoming bytes still belong to a report. */
+bool Genie::magic_processing() {
+  if ( magic_pending ) {
+    uint16_t needed = ( magic_pending == GENIEM_REPORT_BYTES ) ? magic_header[2] + 1 : 2 * magic_header[2] + 1;
+    if ( deviceSerial->available() < needed && millis() - magic_timer < GENIE_MAGIC_TIMEOUT ) return 1;
+    uint8_t cmd = magic_pending;
+    magic_pending = 0;
+    if ( cmd == GENIEM_REPORT_BYTES ) {
+      magic_report_len = magic_header[2];
+      magic_overpull_count = 0;
+      if ( UserByteReader != nullptr ) {
+        UserByteReader( magic_header[1], magic_header[2] );
+        if ( magic_report_len > 0 ) {
+          if ( debugSerial != nullptr ) {
+            debugSerial->print(F("[Genie]: User forgot "));
+            debugSerial->print(magic_report_len);
+            debugSerial->println(F(" magic byte(s). Flushing rest..."));
           }
-        case GENIE_WRITE_OBJ: {
-            writeMode(&_dequeued_buffer[1], 6);
-            // if ( _dequeued_buffer[0] == currentForm ) writeMode(&_dequeued_buffer[1], 6);
-            break;
+        }
+        else {
+          if ( debugSerial != nullptr ) {
+            if ( !magic_overpull_count ) debugSerial->println(F("[Genie]: User captured all magic bytes!"));
+            else {
+              debugSerial->print(F("[Genie]: User captured all magic bytes, but tried to pull more than provided! ("));
+              debugSerial->print(magic_overpull_count);
+              debugSerial->println(F(" byte(s))")); 
+            }
           }
+        }
+        display_uptime = millis();
       }
-      pendingACK = 1;
-      pendingACK_timeout = millis();
+      else if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: MMagic bytes callback not set!"));
+      rx_discard = magic_report_len + 1; /* leftovers and checksum */
+      magic_report_len = 0;
     }
+    else {
+      if ( UserDoubleByteReader != nullptr ) {
+        UserDoubleByteReader( magic_header[1], magic_header[2] );
+        rx_discard = 1; /* checksum */
+        // over/under pulling protection to be implemented as above
+      }
+      else {
+        if ( debugSerial != nullptr ) debugSerial->println(F("[Genie]: Magic double bytes callback not set!"));
+        rx_discard = 2 * magic_header[2] + 1;
+      }
+    }
+    /* the display answers a magic write with its report */
+    if ( pendingACK && ( tx_frame[1] == GENIEM_WRITE_BYTES || tx_frame[1] == GENIEM_WRITE_DBYTES ) ) tx_complete(GENIE_TX_ACKED);
   }
+  while ( rx_discard && deviceSerial->available() > 0 ) {
+    deviceSerial->read();
+    rx_discard--;
+  }
+  if ( rx_discard && millis() - magic_timer >= 2 * GENIE_MAGIC_TIMEOUT ) rx_discard = 0; /* lost; resync on the next frame */
+  return rx_discard != 0;
 }
 
 // ######################################
@@ -604,15 +839,7 @@ bool Genie::WriteStr(uint8_t index, const char *string) {
   for ( uint8_t i = 0; i < sizeof(buffer) - 1; i++ ) checksum ^= buffer[i];
   buffer[sizeof(buffer) - 1] = checksum;
 
-  block_dequeue = 1; // disable dequeue
-  while ( pendingACK ) DoEvents(); // wait pending ACKs
-  writeMode(buffer,sizeof(buffer)); // write String
-  pendingACK = 1; // enable ACK check
-  pendingACK_timeout = millis(); // reset ACK check timer
-  while ( pendingACK ) DoEvents(); // wait pending ACKs
-  block_dequeue = 0; // re-enable dequeue
-
-  return 1;
+  return queue_long(buffer,sizeof(buffer)); // queue String
 }
 
 bool Genie::WriteStr(uint8_t index, String string) {
@@ -838,15 +1065,7 @@ uint16_t Genie::WriteStrU (uint16_t index, uint16_t *string) {
   }
   buffer[(4+(len*2))-1] = checksum;
 
-  block_dequeue = 1; // disable dequeue
-  while ( pendingACK ) DoEvents(); // wait pending ACKs
-  writeMode(buffer,sizeof(buffer)); // write String
-  pendingACK = 1; // enable ACK check
-  pendingACK_timeout = millis(); // reset ACK check timer
-  while ( pendingACK ) DoEvents(); // wait pending ACKs
-  block_dequeue = 0; // re-enable dequeue
-
-  return 1;
+  return queue_long(buffer,sizeof(buffer)); // queue String
 }
 
 // ######################################
@@ -866,15 +1085,7 @@ bool Genie::WriteInhLabel(uint8_t index, const char *string) {
   for ( uint8_t i = 0; i < sizeof(buffer) - 1; i++ ) checksum ^= buffer[i];
   buffer[sizeof(buffer) - 1] = checksum;
 
-  block_dequeue = 1; // disable dequeue
-  while ( pendingACK ) DoEvents(); // wait pending ACKs
-  writeMode(buffer,sizeof(buffer)); // write String
-  pendingACK = 1; // enable ACK check
-  pendingACK_timeout = millis(); // reset ACK check timer
-  while ( pendingACK ) DoEvents(); // wait pending ACKs
-  block_dequeue = 0; // re-enable dequeue
-
-  return 1;
+  return queue_long(buffer,sizeof(buffer)); // queue String
 }
 
 bool Genie::WriteInhLabel(uint8_t index, String string) {
@@ -1123,36 +1334,8 @@ int8_t Genie::WriteMagicBytes(uint8_t index, uint8_t *bytes, uint8_t len, uint8_
   for ( uint8_t i = 0; i < sizeof(buffer) - 1; i++ ) checksum ^= buffer[i];
   buffer[sizeof(buffer) - 1] = checksum;
 
-  block_dequeue = 1;
-  while ( pendingACK ) DoEvents();
-  writeMode(buffer, sizeof(buffer));
-
-  if ( report ) {
-    while ( pendingACK ) DoEvents();
-    block_dequeue = 0;
-    return 1;
-  }
-
-  uint32_t timeout = millis();
-  while (millis() - timeout < 1000) {
-    uint8_t result = DoEvents();
-    switch ( result ) {
-      case GENIEM_REPORT_BYTES: {
-          block_dequeue = 0;
-          return result;
-        }
-      case GENIE_ACK: {
-          block_dequeue = 0;
-          return result;
-        }
-      case GENIE_NAK: {
-          block_dequeue = 0;
-          return result;
-        }
-    }
-  }
-  block_dequeue = 0;
-  return -1;
+  (void)report; /* the ACK or the display's magic report completes it, see AttachTxCompleteHandler */
+  return queue_long(buffer, sizeof(buffer)) ? 1 : -1;
 }
 
 // ######################################
@@ -1178,42 +1361,13 @@ int8_t Genie::WriteMagicDBytes(uint8_t index, uint16_t *shorts, uint8_t len, uin
   for ( uint8_t i = 0; i < sizeof(buffer) - 1; i++ ) checksum ^= buffer[i];
   buffer[sizeof(buffer) - 1] = checksum;
 
-  block_dequeue = 1;
-  while ( pendingACK ) DoEvents();
-  writeMode(buffer, sizeof(buffer));
-
-  if ( report ) {
-    block_dequeue = 0;
-    while ( pendingACK ) DoEvents();
-    return 1;
-  }
-
-  uint32_t timeout = millis();
-  while (millis() - timeout < 1000) {
-    uint8_t result = DoEvents();
-    switch ( result ) {
-      case GENIEM_REPORT_BYTES: {
-          block_dequeue = 0;
-          return result;
-        }
-      case GENIE_ACK: {
-          block_dequeue = 0;
-          return result;
-        }
-      case GENIE_NAK: {
-          block_dequeue = 0;
-          return result;
-        }
-    }
-  }
-  block_dequeue = 0;
-  return -1;
+  (void)report; /* see WriteMagicBytes */
+  return queue_long(buffer, sizeof(buffer)) ? 1 : -1;
 }
 
 
 
 
-
 // ######################################
 // ## GenieObject Class #################
 // ######################################
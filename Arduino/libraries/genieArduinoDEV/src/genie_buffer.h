@@ -550,4 +550,131 @@ T Genie_Buffer<T,_size,multi>::pop_back(T *buffer, uint16_t length) {
   }
 }
 
+/* Frame queue for coalescing writes. Each frame's key (see key_of) is kept in a
+   small hash index, so a newer write to an object already queued is found and
+   updated in place in O(1) instead of by scanning the ring as
+   Genie_Buffer::replace() does. The index points at the newest frame with each
+   key; a full queue drops its oldest frame like Genie_Buffer. */
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+class Genie_Keyed_Buffer {
+    public:
+        Genie_Keyed_Buffer() { clear(); }
+        void push_back(const T *buffer, uint16_t length);
+        void push_front(const T *buffer, uint16_t length);
+        T pop_front(T *buffer, uint16_t length);
+        bool replace(const T *buffer, uint16_t length);
+        bool contains(const T *buffer) { return lookup(key_of(buffer)) >= 0; }
+        void flush() { clear(); }
+        void clear() { head = _available = 0; memset(_index, 0xFF, sizeof(_index)); }
+        uint16_t size() { return _available; }
+        uint16_t available() { return _available; }
+        uint16_t capacity() { return _size; }
+
+    private:
+        static const uint16_t _buckets = 4 * _size; /* load factor <= 1/4 keeps probes short */
+        static const uint16_t _empty = 0xFFFF;
+
+        uint16_t bucket_of(uint32_t key) { return ((uint32_t)(key * 2654435769UL) >> 16) & (_buckets - 1); }
+        int32_t lookup(uint32_t key);
+        void index(uint16_t slot);
+        void unindex(uint16_t slot);
+        void store(uint16_t slot, const T *buffer, uint16_t length);
+
+        uint16_t head = 0;
+        uint16_t _available = 0;
+
+        T _cabuf[_size][multi+2];
+        uint32_t _keys[_size];
+        uint16_t _index[_buckets]; /* slot, or _empty */
+};
+
+
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+int32_t Genie_Keyed_Buffer<T,_size,multi,key_of>::lookup(uint32_t key) {
+  uint16_t b = bucket_of(key);
+  for ( uint16_t n = 0; n < _buckets; n++ ) {
+    if ( _index[b] == _empty ) return -1;
+    if ( _keys[_index[b]] == key ) return b;
+    b = (b + 1) & (_buckets - 1);
+  }
+  return -1;
+}
+
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+void Genie_Keyed_Buffer<T,_size,multi,key_of>::index(uint16_t slot) {
+  uint16_t b = bucket_of(_keys[slot]);
+  while ( _index[b] != _empty && _keys[_index[b]] != _keys[slot] ) b = (b + 1) & (_buckets - 1);
+  _index[b] = slot; /* newest frame with this key wins */
+}
+
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+void Genie_Keyed_Buffer<T,_size,multi,key_of>::unindex(uint16_t slot) {
+  uint16_t hole = bucket_of(_keys[slot]);
+  while ( _index[hole] != slot ) {
+    if ( _index[hole] == _empty ) return; /* an older duplicate, never indexed */
+    hole = (hole + 1) & (_buckets - 1);
+  }
+  /* Backward-shift delete: pull later entries of the probe run into the hole
+     unless their home bucket lies between the hole and where they sit */
+  for ( uint16_t j = (hole + 1) & (_buckets - 1); _index[j] != _empty; j = (j + 1) & (_buckets - 1) ) {
+    uint16_t home = bucket_of(_keys[_index[j]]);
+    if ( ((j - home) & (_buckets - 1)) >= ((j - hole) & (_buckets - 1)) ) {
+      _index[hole] = _index[j];
+      hole = j;
+    }
+  }
+  _index[hole] = _empty;
+}
+
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+void Genie_Keyed_Buffer<T,_size,multi,key_of>::store(uint16_t slot, const T *buffer, uint16_t length) {
+  _cabuf[slot][0] = length >> 8;
+  _cabuf[slot][1] = length & 0xFF;
+  memmove(_cabuf[slot]+2,buffer,length*sizeof(T));
+  _keys[slot] = key_of(buffer);
+}
+
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+void Genie_Keyed_Buffer<T,_size,multi,key_of>::push_back(const T *buffer, uint16_t length) {
+  if ( _available == _size ) { /* overwrite the oldest */
+    unindex(head);
+    head = (head + 1) & (_size - 1);
+    _available--;
+  }
+  uint16_t slot = (head + _available) & (_size - 1);
+  store(slot, buffer, length);
+  _available++;
+  index(slot);
+}
+
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+void Genie_Keyed_Buffer<T,_size,multi,key_of>::push_front(const T *buffer, uint16_t length) {
+  if ( _available == _size ) { /* drop the newest */
+    unindex((head + _available - 1) & (_size - 1));
+    _available--;
+  }
+  head = (head - 1) & (_size - 1);
+  store(head, buffer, length);
+  _available++;
+  if ( lookup(_keys[head]) < 0 ) index(head); /* a newer queued frame keeps the index */
+}
+
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+T Genie_Keyed_Buffer<T,_size,multi,key_of>::pop_front(T *buffer, uint16_t length) {
+  if ( !_available ) return 0;
+  memmove(&buffer[0],&_cabuf[head][2],length*sizeof(T));
+  unindex(head);
+  head = (head + 1) & (_size - 1);
+  _available--;
+  return 0;
+}
+
+template<typename T, uint16_t _size, uint16_t multi, uint32_t (*key_of)(const T *)>
+bool Genie_Keyed_Buffer<T,_size,multi,key_of>::replace(const T *buffer, uint16_t length) {
+  int32_t b = lookup(key_of(buffer));
+  if ( b < 0 ) return 0;
+  store(_index[b], buffer, length);
+  return 1;
+}
+
 #endif // Genie_Buffer_H
@@ -1,5 +1,6 @@
 // AutoCutCycleManager.cpp - Updated for batch cutting
 #include "AutoCutCycleManager.h"
+#include "Log.h"
 #include "ClearCore.h"
 
 AutoCutCycleManager& AutoCutCycleManager::Instance() {
@@ -19,7 +20,7 @@ void AutoCutCycleManager::setup() {
 void AutoCutCycleManager::startCycle() {
     // Use batch sequence instead of reset
     if (!CutSequenceController::Instance().startBatchSequence()) {
-        ClearCore::ConnectorUsb.SendLine("[AutoCutCycle] Failed to start batch sequence");
+        LOG_WARN(Seq, "[AutoCutCycle] Failed to start batch sequence");
         return;
     }
 
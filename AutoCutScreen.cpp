@@ -1,7 +1,13 @@
 #include "AutoCutScreen.h"
+#include "DisplayModel.h"
+#include "DisplayValue.h"
+#include "LatencyProfiler.h"
+#include "Log.h"
+#include "LoopWatchdog.h"
 #include "screenmanager.h"
 #include "AutoCutCycleManager.h"
 #include "CutSequenceController.h"
+#include "CycleTimeEstimator.h"
 #include "JogXScreen.h"
 #include "JogYScreen.h"
 #include "MotionController.h"
@@ -10,10 +16,20 @@
 #include "Config.h"
 #include "CutPositionData.h"
 
-extern Genie genie;
-
 AutoCutScreen::AutoCutScreen(ScreenManager& mgr) : _mgr(mgr) {}
 
+static const Screen::FieldInit AUTOCUT_INITIAL[] = {
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_START_AUTOFEED_F5, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SLIDE_HOLD_F5, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_END_CYCLE_F5, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_MOVE_TO_START_POSITION, 0 },
+};
+
+const Screen::FieldInit* AutoCutScreen::initialState(uint8_t& count) const {
+    count = sizeof(AUTOCUT_INITIAL) / sizeof(AUTOCUT_INITIAL[0]);
+    return AUTOCUT_INITIAL;
+}
+
 void AutoCutScreen::onShow() {
     _feedHoldManager.reset();
 
@@ -26,6 +42,8 @@ void AutoCutScreen::onShow() {
     );
 
     _torqueControlUI.onShow();
+    DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_SPINDLE_F5,
+        MotionController::Instance().IsSpindleRunning() ? 1 : 0);
     updateDisplay();
 }
 
@@ -37,69 +55,31 @@ void AutoCutScreen::onHide() {
     _torqueControlUI.onHide();  // Clean up torque control UI
 }
 
-void AutoCutScreen::handleEvent(const genieFrame& e) {
-    if (e.reportObject.cmd != GENIE_REPORT_EVENT) return;
-
-    switch (e.reportObject.object) {
-    case GENIE_OBJ_WINBUTTON:
-        switch (e.reportObject.index) {
-        case WINBUTTON_START_AUTOFEED_F5:           // 25 - Start Auto Feed
-            startCycle();
-            break;
-        case WINBUTTON_SLIDE_HOLD_F5:               // 23 - Pause/Resume toggle
-            togglePauseResume();
-            break;
-        case WINBUTTON_END_CYCLE_F5:                // 22 - Stop/Cancel cycle
-            cancelCycle();
-            break;
-        case WINBUTTON_ADJUST_CUT_PRESSURE_F5:      // 43 - Adjust cut pressure
-            adjustCutPressure();
-            break;
-        case WINBUTTON_ADJUST_MAX_SPEED_F5:         // 45 - Adjust max speed
-            adjustMaxSpeed();
-            break;
-        case WINBUTTON_MOVE_TO_START_POSITION:      // 44 - Rapid to Zero
-            moveToStartPosition();
-            break;
-        case WINBUTTON_SPINDLE_F5:                  // 24 - Toggle spindle
-            toggleSpindle();
-            break;
-        case WINBUTTON_SETTINGS_F5:                 // 26 - Open settings
-            openSettings();
-            break;
-        case WINBUTTON_SETUP_AUTOCUT_F5:            // 46 - Setup Auto Cut
-            openSetupAutocutScreen();
-            break;
-        }
-        break;
-    }
-}
-
 void AutoCutScreen::startCycle() {
-    ClearCore::ConnectorUsb.SendLine("[AutoCut] Start Cycle requested");
+    LOG_INFO(Seq, "[AutoCut] Start Cycle requested");
 
     // Visual feedback
-    updateButtonState(WINBUTTON_START_AUTOFEED_F5, true, nullptr, 0);
+    updateButtonState(WINBUTTON_START_AUTOFEED_F5, true);
 
     auto& cutSeq = CutSequenceController::Instance();
 
     // Check if already running
     if (cutSeq.isActive()) {
-        ClearCore::ConnectorUsb.SendLine("[AutoCut] Error: Cycle already running");
+        LOG_WARN(Seq, "[AutoCut] Error: Cycle already running");
         flashButtonError(WINBUTTON_START_AUTOFEED_F5);
         return;
     }
 
     // Validate that setup has been done
     if (cutSeq.getTotalCuts() == 0) {
-        ClearCore::ConnectorUsb.SendLine("[AutoCut] Error: No cuts configured - press Setup Auto Cut first");
+        LOG_WARN(Seq, "[AutoCut] Error: No cuts configured - press Setup Auto Cut first");
         flashButtonError(WINBUTTON_START_AUTOFEED_F5);
         return;
     }
 
     // Check if all cuts are already complete
     if (cutSeq.getRemainingPositions() == 0) {
-        ClearCore::ConnectorUsb.SendLine("[AutoCut] Error: All cuts already completed - reset from Jog X screen");
+        LOG_WARN(Seq, "[AutoCut] Error: All cuts already completed - reset from Jog X screen");
         flashButtonError(WINBUTTON_START_AUTOFEED_F5);
         return;
     }
@@ -121,19 +101,16 @@ void AutoCutScreen::startCycle() {
 
     // Start the batch sequence
     if (cutSeq.startBatchSequence()) {
-        ClearCore::ConnectorUsb.Send("[AutoCut] Batch started: ");
-        ClearCore::ConnectorUsb.Send(static_cast<int>(batchSize));
-        ClearCore::ConnectorUsb.Send(" cuts, ");
-        ClearCore::ConnectorUsb.Send(static_cast<int>(remainingCuts));
-        ClearCore::ConnectorUsb.SendLine(" total remaining");
+        LOG_INFO(Seq, "[AutoCut] Batch started: ", static_cast<int>(batchSize), " cuts, ",
+            static_cast<int>(remainingCuts), " total remaining");
 
         // Keep start button highlighted while running
         // (will be cleared in update() when cycle completes)
     }
     else {
-        ClearCore::ConnectorUsb.SendLine("[AutoCut] Failed to start batch sequence");
+        LOG_WARN(Seq, "[AutoCut] Failed to start batch sequence");
         _torqueControlUI.setCuttingActive(false);
-        updateButtonState(WINBUTTON_START_AUTOFEED_F5, false, nullptr, 0);
+        updateButtonState(WINBUTTON_START_AUTOFEED_F5, false);
     }
 
     updateDisplay();
@@ -145,12 +122,12 @@ void AutoCutScreen::togglePauseResume() {
     if (cutSeq.isActive()) {
         // Currently running - pause it
         cutSeq.pause();
-        updateButtonState(WINBUTTON_SLIDE_HOLD_F5, true, "[AutoCut] Cycle paused", 0);
+        updateButtonState(WINBUTTON_SLIDE_HOLD_F5, true, "[AutoCut] Cycle paused");
     }
     else {
         // Currently paused - resume it
         cutSeq.resume();
-        updateButtonState(WINBUTTON_SLIDE_HOLD_F5, false, "[AutoCut] Cycle resumed", 0);
+        updateButtonState(WINBUTTON_SLIDE_HOLD_F5, false, "[AutoCut] Cycle resumed");
     }
 
     updateDisplay();
@@ -164,7 +141,7 @@ void AutoCutScreen::pauseCycle() {
 void AutoCutScreen::resumeCycle() {
     auto& cutSeq = CutSequenceController::Instance();
     cutSeq.resume();
-    updateButtonState(WINBUTTON_SLIDE_HOLD_F5, false, "[AutoCut] Cycle resumed", 0);
+    updateButtonState(WINBUTTON_SLIDE_HOLD_F5, false, "[AutoCut] Cycle resumed");
     updateDisplay();
 }
 
@@ -172,8 +149,8 @@ void AutoCutScreen::cancelCycle() {
     auto& cutSeq = CutSequenceController::Instance();
     cutSeq.abort();
     _torqueControlUI.setCuttingActive(false);
-    updateButtonState(WINBUTTON_START_AUTOFEED_F5, false, "[AutoCut] Cycle cancelled", 0);
-    updateButtonState(WINBUTTON_SLIDE_HOLD_F5, false, nullptr, 0);
+    updateButtonState(WINBUTTON_START_AUTOFEED_F5, false, "[AutoCut] Cycle cancelled");
+    updateButtonState(WINBUTTON_SLIDE_HOLD_F5, false);
     updateDisplay();
 }
 
@@ -207,10 +184,10 @@ void AutoCutScreen::adjustMaxSpeed() {
 }
 
 void AutoCutScreen::moveToStartPosition() {
-    ClearCore::ConnectorUsb.SendLine("[AutoCut] Move to Start Position (Rapid to Job Zero)");
+    LOG_INFO(Seq, "[AutoCut] Move to Start Position (Rapid to Job Zero)");
 
     // Visual feedback
-    updateButtonState(WINBUTTON_MOVE_TO_START_POSITION, true, nullptr, 0);
+    updateButtonState(WINBUTTON_MOVE_TO_START_POSITION, true);
 
     // Get Y job zero position using the same calculation as JogY screen
     auto& cutData = _mgr.GetCutData();
@@ -220,20 +197,15 @@ void AutoCutScreen::moveToStartPosition() {
         desiredRetractPos = yHomePos;
     }
 
-    ClearCore::ConnectorUsb.Send("[AutoCut] Y Job Zero calculation: Cut Start ");
-    ClearCore::ConnectorUsb.Send(cutData.cutStartPoint);
-    ClearCore::ConnectorUsb.Send(" - Retract Distance ");
-    ClearCore::ConnectorUsb.Send(cutData.retractDistance);
-    ClearCore::ConnectorUsb.Send(" = ");
-    ClearCore::ConnectorUsb.Send(desiredRetractPos);
-    ClearCore::ConnectorUsb.SendLine(" (limited to >= 0.0)");
+    LOG_INFO(Seq, "[AutoCut] Y Job Zero calculation: Cut Start ", cutData.cutStartPoint,
+        " - Retract Distance ", cutData.retractDistance, " = ", desiredRetractPos, " (limited to >= 0.0)");
 
     // Start by moving Y to retract position at full speed
     MotionController::Instance().moveTo(AXIS_Y, desiredRetractPos, 1.0f);
     _rapidState = MovingYToRetract;
 
-    delay(200);
-    updateButtonState(WINBUTTON_MOVE_TO_START_POSITION, false, nullptr, 0);
+    // Release the button shortly after, without holding up the loop
+    UiTimeline::Instance().writeLater(GENIE_OBJ_WINBUTTON, WINBUTTON_MOVE_TO_START_POSITION, 0, 200);
 }
 
 void AutoCutScreen::openSetupAutocutScreen() {
@@ -242,11 +214,7 @@ void AutoCutScreen::openSetupAutocutScreen() {
 
 void AutoCutScreen::flashButtonError(uint16_t buttonId) {
     // Flash button to indicate error
-    for (int i = 0; i < 3; i++) {
-        updateButtonState(buttonId, false, nullptr, 150);
-        updateButtonState(buttonId, true, nullptr, 150);
-    }
-    updateButtonState(buttonId, false, nullptr, 0);
+    blinkButton(buttonId, 3, 150);
 }
 
 void AutoCutScreen::toggleSpindle() {
@@ -254,46 +222,37 @@ void AutoCutScreen::toggleSpindle() {
 
     if (motion.IsSpindleRunning()) {
         motion.StopSpindle();
-        updateButtonState(WINBUTTON_SPINDLE_F5, false, "[AutoCut] Spindle stopped", 0);
+        updateButtonState(WINBUTTON_SPINDLE_F5, false, "[AutoCut] Spindle stopped");
     }
     else {
         // Get RPM from settings
         float rpm = SettingsManager::Instance().settings().spindleRPM;
 
-        ClearCore::ConnectorUsb.Send("[AutoCut] Starting spindle at rpm: ");
-        ClearCore::ConnectorUsb.SendLine(rpm);
+        LOG_INFO(Seq, "[AutoCut] Starting spindle at rpm: ", rpm);
 
         motion.StartSpindle(rpm);
-        updateButtonState(WINBUTTON_SPINDLE_F5, true, "[AutoCut] Spindle started", 0);
+        updateButtonState(WINBUTTON_SPINDLE_F5, true, "[AutoCut] Spindle started");
     }
 
     updateDisplay();
 }
 
-void AutoCutScreen::openSettings() {
-    ScreenManager::Instance().ShowSettings();
-}
-
 void AutoCutScreen::updateDisplay() {
     auto& seq = CutSequenceController::Instance();
     auto& posData = CutPositionData::Instance();
 
-    // Stock Length (inches, scaled to 0.001)
-    float stockLength = ScreenManager::Instance().GetCutData().stockLength;
-    int32_t scaledStockLength = static_cast<int32_t>(stockLength * 1000.0f);
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_STOCK_LENGTH_F5, static_cast<uint16_t>(scaledStockLength));
+    // Stock Length (inches)
+    DisplayValue::show(LEDDIGITS_STOCK_LENGTH_F5, ScreenManager::Instance().GetCutData().stockLength);
 
     // Cutting Position (1-based)
-    int currentCut = seq.getCurrentIndex() + 1;
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_CUTTING_POSITION_F5, static_cast<uint16_t>(currentCut));
+    DisplayValue::showCount(LEDDIGITS_CUTTING_POSITION_F5, seq.getCurrentIndex() + 1);
 
     // Total Slices/Positions
-    int totalSlices = seq.getTotalCuts();
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_TOTAL_SLICES_F5, static_cast<uint16_t>(totalSlices));
+    DisplayValue::showCount(LEDDIGITS_TOTAL_SLICES_F5, seq.getTotalCuts());
 
-    // Job Remaining Cuts
-    int remainingCuts = seq.getRemainingPositions();
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_JOB_REMAINING_F5, static_cast<uint16_t>(remainingCuts));
+    // Job remaining: predicted seconds for the running or next batch
+    uint32_t remainingMs = CycleTimeEstimator::Instance().remainingMs();
+    DisplayValue::showCount(LEDDIGITS_JOB_REMAINING_F5, static_cast<int32_t>((remainingMs + 999) / 1000));
 
     // Show progress percentage
     float progress = seq.getBatchProgressPercent();
@@ -307,8 +266,7 @@ void AutoCutScreen::updateDisplay() {
         float yCutStop = seq.getYCutStop();
         float distanceToGo = yCutStop - yCurrentPos;
         if (distanceToGo < 0) distanceToGo = 0;
-        genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_DISTANCE_TO_GO_F5,
-            static_cast<uint16_t>(distanceToGo * 1000));
+        DisplayValue::show(LEDDIGITS_DISTANCE_TO_GO_F5, distanceToGo);
         break;
     }
     case CutSequenceController::SEQUENCE_MOVING_TO_X:
@@ -320,27 +278,24 @@ void AutoCutScreen::updateDisplay() {
     }
 
     // Spindle RPM
-    uint16_t rpm = MotionController::Instance().IsSpindleRunning() ?
-        static_cast<uint16_t>(MotionController::Instance().CommandedRPM()) : 0;
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_RPM_F5, rpm);
+    float rpm = MotionController::Instance().IsSpindleRunning() ?
+        MotionController::Instance().CommandedRPM() : 0.0f;
+    DisplayValue::show(LEDDIGITS_RPM_F5, rpm);
 
     // Thickness
-    float thickness = ScreenManager::Instance().GetCutData().thickness;
-    int32_t scaledThickness = static_cast<int32_t>(thickness * 1000.0f);
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_THICKNESS_F5, static_cast<uint16_t>(scaledThickness));
+    DisplayValue::show(LEDDIGITS_THICKNESS_F5, ScreenManager::Instance().GetCutData().thickness);
 }
 
-void AutoCutScreen::updateButtonState(uint16_t buttonId, bool state, const char* logMessage, uint16_t delayMs) {
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, buttonId, state ? 1 : 0);
+void AutoCutScreen::updateButtonState(uint16_t buttonId, bool state, const char* logMessage) {
+    showButtonSafe(buttonId, state ? 1 : 0);
     if (logMessage) {
-        ClearCore::ConnectorUsb.SendLine(logMessage);
-    }
-    if (delayMs > 0) {
-        delay(delayMs);
+        LOG_INFO(UI, logMessage);
     }
 }
 
 void AutoCutScreen::update() {
+    LATENCY_PROBE("screen.autocut");
+    LOOP_WATCHDOG_MARK();
     // Update torque control UI (handles gauge updates, encoder input, etc.)
     _torqueControlUI.update();
 
@@ -369,7 +324,7 @@ void AutoCutScreen::update() {
         float xCurrent = MotionController::Instance().getAbsoluteAxisPosition(AXIS_X);
         if (fabs(xCurrent - xZero) < 0.01f) { // Tolerance
             _rapidState = RapidIdle;
-            ClearCore::ConnectorUsb.SendLine("[AutoCut] Rapid to start position complete");
+            LOG_INFO(Seq, "[AutoCut] Rapid to start position complete");
             updateDisplay();
         }
     }
@@ -383,22 +338,21 @@ void AutoCutScreen::update() {
     if (isActive != wasActive) {
         if (isActive) {
             // Sequence just started - keep start button lit
-            updateButtonState(WINBUTTON_START_AUTOFEED_F5, true, nullptr, 0);
+            updateButtonState(WINBUTTON_START_AUTOFEED_F5, true);
         }
         else {
             // Sequence just stopped - turn off start button
-            updateButtonState(WINBUTTON_START_AUTOFEED_F5, false, nullptr, 0);
-            updateButtonState(WINBUTTON_SLIDE_HOLD_F5, false, nullptr, 0);
+            updateButtonState(WINBUTTON_START_AUTOFEED_F5, false);
+            updateButtonState(WINBUTTON_SLIDE_HOLD_F5, false);
             _torqueControlUI.setCuttingActive(false);
 
             // Check completion status
             if (cutSeq.getRemainingPositions() == 0) {
-                ClearCore::ConnectorUsb.SendLine("[AutoCut] All cuts completed!");
+                LOG_INFO(Seq, "[AutoCut] All cuts completed!");
             }
             else {
-                ClearCore::ConnectorUsb.Send("[AutoCut] Batch completed. ");
-                ClearCore::ConnectorUsb.Send(static_cast<int>(cutSeq.getRemainingPositions()));
-                ClearCore::ConnectorUsb.SendLine(" cuts remaining.");
+                LOG_INFO(Seq, "[AutoCut] Batch completed. ",
+                    static_cast<int>(cutSeq.getRemainingPositions()), " cuts remaining.");
             }
         }
         wasActive = isActive;
@@ -10,9 +10,10 @@ public:
     AutoCutScreen(ScreenManager& mgr);
     void onShow() override;
     void onHide() override;
-    void handleEvent(const genieFrame& e) override;
     void update() override;
+    const FieldInit* initialState(uint8_t& count) const override;
 
+    // Button actions, routed here by EventRouter
     // Cycle control methods
     void startCycle();
     void pauseCycle();
@@ -35,11 +36,10 @@ public:
 
     // UI methods
     void toggleSpindle();
-    void openSettings();
 
 private:
     void updateDisplay();
-    void updateButtonState(uint16_t buttonId, bool state, const char* logMessage = nullptr, uint16_t delayMs = 0);
+    void updateButtonState(uint16_t buttonId, bool state, const char* logMessage = nullptr);
     void flashButtonError(uint16_t buttonId);  // Helper for error feedback
 
     enum RapidToZeroState {
@@ -10,9 +10,55 @@
 #include "ScreenManager.h"
 #include "MotionController.h"
 #include "MPGJogManager.h"
+#include "TaskScheduler.h"
+#include "LoopWatchdog.h"
+#include "UiTimeline.h"
+#include "LatencyProfiler.h"
+#include "UsbConsole.h"
+#include "BinLog.h"
+#include "Log.h"
+#include "CutRecorder.h"
+#include "DisplayModel.h"
+#include "EventRouter.h"
+#include "BootSequence.h"
+#include "CycleTimeEstimator.h"
+#include "CutSequenceController.h"
 
 extern Genie genie;                     // main sketch defines this
-extern void myGenieEventHandler();      // forward-declare event handler
+
+// Scheduler task bodies
+static void taskEStop() { EStopManager::Instance().update(); }
+static void taskMotion() {
+    MotionController::Instance().update();
+    MPGJogManager::Instance().follow();
+}
+static void taskPendant() { PendantManager::Instance().Update(); }
+static void taskUIInput() { UIInputManager::Instance().update(); }
+static void taskUsbConsole() { UsbConsole::Instance().update(); }
+
+static void setGenieBaud(uint32_t baud) { GENIE_SERIAL_PORT.begin(baud); }
+
+static void taskGenie() {
+    DisplayModel::Instance().flush();
+    LATENCY_PROBE("genie");
+    genie.DoEvents();
+}
+
+static void taskScreen() {
+    UiTimeline::Instance().update();
+    if (ScreenManager::Instance().currentScreen()) {
+        ScreenManager::Instance().currentScreen()->update();
+    }
+}
+
+static void taskBoot() { BootSequence::Instance().update(); }
+static void taskLogDrain() { BinLog::Instance().drain(); }
+static void taskRecorder() { CutRecorder::Instance().update(); }
+
+static void taskSchedulerStats() {
+    TaskScheduler::Instance().logStats();
+    LoopWatchdog::Instance().logReport();
+}
 
 AutoSawController& AutoSawController::Instance() {
     static AutoSawController inst;
@@ -20,49 +66,70 @@ AutoSawController& AutoSawController::Instance() {
 }
 
 void AutoSawController::setup() {
-    // Serial and Genie UI
+    // Boot pipeline: safety and motion first, nothing here waits on a far
+    // end. USB and the display are picked up by the boot task (BootSequence.h)
+    auto& boot = BootSequence::Instance();
+    boot.begin();
+
+    // USB port opens now so setup messages have somewhere to go once a host
+    // attaches; there is no wait for one
     Serial.begin(USB_BAUD);
-    while (!Serial);
-    GENIE_SERIAL_PORT.begin(GENIE_BAUD);
-    genie.Begin(GENIE_SERIAL_PORT);
-    genie.AttachEventHandler(myGenieEventHandler);
 
     // Input and safety
     ClearCore::EncoderIn.Enable(true);
     EStopManager::Instance().setup();
 
-    // Motion hardware
+    // Settings, then motion hardware
+    SettingsManager::Instance().load();
     MotionController::Instance().setup();
 
-    // Pendant and UI input
+    // Pendant, MPG and UI input
     PendantManager::Instance().Init();
+    MPGJogManager::Instance().setup();
     UIInputManager::Instance().init(ENCODER_COUNTS_PER_CLICK);
+    boot.markMotionReady();
 
-    // Settings and filesystem
-    SettingsManager::Instance().load();
-    FileManager::Instance();
+    // Genie UI - Begin() only pings; the display is detected from DoEvents()
+    GENIE_SERIAL_PORT.begin(GENIE_BAUD);
+    genie.NegotiateBaud(GENIE_BAUD, GENIE_FAST_BAUD, GENIE_BAUD_MAGIC, setGenieBaud);
+    genie.Begin(GENIE_SERIAL_PORT);
+    genie.AttachEventHandler(EventRouter::onGenieEvent);
 
-    // UI startup
+    // Filesystem and UI startup (splash until the display answers)
+    FileManager::Instance();
     ScreenManager::Instance().Init();
 
-    // Jog manager
-    MPGJogManager::Instance().setup();
+    // USB console commands
+    LatencyProfiler::Instance().registerCommands();
+    BinLog::Instance().registerCommands();
+    CutRecorder::Instance().registerCommands();
+    DisplayModel::Instance().registerCommands();
+    CycleTimeEstimator::Instance().registerCommands();
+    CutSequenceController::Instance().registerCommands();
+    boot.registerCommands();
+
+    // Main loop tasks - safety and motion first, UI last
+    auto& sched = TaskScheduler::Instance();
+    sched.addTask("estop", taskEStop, TASK_PERIOD_ESTOP_US, TaskScheduler::PRIORITY_CRITICAL);
+    sched.addTask("motion", taskMotion, TASK_PERIOD_MOTION_US, TaskScheduler::PRIORITY_CRITICAL);
+    sched.addTask("pendant", taskPendant, TASK_PERIOD_PENDANT_US, TaskScheduler::PRIORITY_HIGH);
+    sched.addTask("uiInput", taskUIInput, TASK_PERIOD_UI_INPUT_US, TaskScheduler::PRIORITY_HIGH);
+    sched.addTask("genie", taskGenie, TASK_PERIOD_GENIE_US, TaskScheduler::PRIORITY_NORMAL);
+    sched.addTask("screen", taskScreen, TASK_PERIOD_SCREEN_US, TaskScheduler::PRIORITY_LOW);
+    sched.addTask("console", taskUsbConsole, TASK_PERIOD_CONSOLE_US, TaskScheduler::PRIORITY_LOW);
+    sched.addTask("recorder", taskRecorder, TASK_PERIOD_RECORDER_US, TaskScheduler::PRIORITY_IDLE);
+    sched.addTask("logDrain", taskLogDrain, 0, TaskScheduler::PRIORITY_IDLE);
+    boot.setTaskId(sched.addTask("boot", taskBoot, TASK_PERIOD_BOOT_US, TaskScheduler::PRIORITY_LOW));
+    if (SCHEDULER_STATS_LOGGING && LOG_ENABLED(Sys, Info)) {
+        sched.addTask("stats", taskSchedulerStats, SCHEDULER_STATS_INTERVAL * 1000UL,
+            TaskScheduler::PRIORITY_IDLE);
+    }
 }
 
 void AutoSawController::update() {
-    // Process touch and button events
-    genie.DoEvents();
-
-    // E-stop and pendant
-    EStopManager::Instance().update();
-    PendantManager::Instance().Update();
-    UIInputManager::Instance().update();
-
-    // Drive updates
-    MotionController::Instance().update();
-
-    // UI screen logic
-    if (ScreenManager::Instance().currentScreen()) {
-        ScreenManager::Instance().currentScreen()->update();
-    }
+    // One scheduling pass - runs the most urgent due task
+    auto& watchdog = LoopWatchdog::Instance();
+    watchdog.beginIteration();
+    TaskScheduler::Instance().run();
+    watchdog.endIteration(TaskScheduler::Instance().lastTaskName());
 }
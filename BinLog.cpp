@@ -0,0 +1,95 @@
+// BinLog.cpp
+#include "BinLog.h"
+#include "UsbConsole.h"
+#include <sam.h>
+
+BinLog& BinLog::Instance() {
+    static BinLog inst;
+    return inst;
+}
+
+void BinLog::commit(LogMsg id, uint8_t* rec, size_t len) {
+    // Header and checksum
+    uint32_t ts = ClearCore::TimingMgr.Microseconds();
+    uint16_t msgId = static_cast<uint16_t>(id);
+    rec[0] = SYNC;
+    rec[1] = static_cast<uint8_t>(len - PAYLOAD_OFFSET);
+    memcpy(rec + PAYLOAD_OFFSET, &ts, 4);
+    memcpy(rec + PAYLOAD_OFFSET + 4, &msgId, 2);
+
+    uint8_t sum = 0;
+    for (size_t i = PAYLOAD_OFFSET; i < len; i++) sum += rec[i];
+    rec[len++] = static_cast<uint8_t>(~sum);
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t used = _head - _tail;
+    if (used + len > RING_SIZE) {
+        _dropped++;
+        _droppedUnreported++;
+        __set_PRIMASK(primask);
+        return;
+    }
+
+    uint32_t pos = _head & RING_MASK;
+    size_t first = RING_SIZE - pos;
+    if (first >= len) {
+        memcpy(_ring + pos, rec, len);
+    }
+    else {
+        memcpy(_ring + pos, rec, first);
+        memcpy(_ring, rec + first, len - first);
+    }
+    _head = _head + len;
+    _written++;
+    if (used + len > _highWater) _highWater = used + len;
+
+    __set_PRIMASK(primask);
+}
+
+void BinLog::drain() {
+    // Tell the host how much it missed, once there's room again
+    if (_droppedUnreported && (_head - _tail) + MAX_FRAME <= RING_SIZE) {
+        uint32_t n = _droppedUnreported;
+        _droppedUnreported = 0;
+        BINLOG(BINLOG_DROPPED, n);
+    }
+
+    size_t sent = 0;
+    while (_tail != _head && sent < MAX_DRAIN_BYTES) {
+        // Whole frames only, so plain-text output can't land mid-frame
+        size_t len = _ring[(_tail + 1) & RING_MASK] + PAYLOAD_OFFSET + 1;
+        if (ClearCore::ConnectorUsb.AvailableForWrite() < static_cast<int32_t>(len)) break;
+
+        uint8_t frame[MAX_FRAME];
+        for (size_t i = 0; i < len; i++) {
+            frame[i] = _ring[(_tail + i) & RING_MASK];
+        }
+        ClearCore::ConnectorUsb.Send(reinterpret_cast<const char*>(frame), len);
+        _tail = _tail + len;
+        sent += len;
+    }
+}
+
+void BinLog::logStats() const {
+    ClearCore::ConnectorUsb.Send("[BinLog] written ");
+    ClearCore::ConnectorUsb.Send(_written);
+    ClearCore::ConnectorUsb.Send(", dropped ");
+    ClearCore::ConnectorUsb.Send(_dropped);
+    ClearCore::ConnectorUsb.Send(", pending ");
+    ClearCore::ConnectorUsb.Send(_head - _tail);
+    ClearCore::ConnectorUsb.Send(" / ");
+    ClearCore::ConnectorUsb.Send(static_cast<uint32_t>(RING_SIZE));
+    ClearCore::ConnectorUsb.Send(" bytes, high water ");
+    ClearCore::ConnectorUsb.SendLine(_highWater);
+}
+
+static void binlogCommand(const char*) {
+    BinLog::Instance().logStats();
+}
+
+void BinLog::registerCommands() {
+    UsbConsole::Instance().registerCommand("binlog", binlogCommand,
+        "binary log ring statistics");
+}
@@ -0,0 +1,131 @@
+// BinLog.h
+#pragma once
+
+#include <ClearCore.h>
+#include <string.h>
+#include "Config.h"
+
+/// Compile-time message IDs, one per LOG_MESSAGE entry in LogMessages.h
+enum class LogMsg : uint16_t {
+#define LOG_MESSAGE(id, text) id,
+#include "LogMessages.h"
+#undef LOG_MESSAGE
+    COUNT
+};
+
+/// Log a catalog message with raw arguments, e.g.
+///   BINLOG(FEED_RATE, rate * 100.0f, change, error);
+#define BINLOG(id, ...) BinLog::Instance().write(LogMsg::id, ##__VA_ARGS__)
+
+/// Deferred binary logger.
+/// write() packs a timestamp, message ID and the raw argument bytes into a
+/// RAM ring - no formatting, no USB. drain() runs in idle time and copies
+/// whole frames to USB only when the port can take them without blocking.
+/// tools/binlog_decode.py turns the stream back into text; plain-text
+/// output from the rest of the firmware passes through it untouched.
+///
+/// Frame: SYNC, len, timestamp us (4), id (2), args..., checksum
+/// where len counts timestamp+id+args and checksum = ~sum(those bytes).
+/// Each argument is a type byte followed by its value, little-endian.
+///
+/// write() may be called from an interrupt; the ring copy is a short
+/// critical section.
+class BinLog {
+public:
+    static constexpr uint8_t SYNC = 0xA5;   // never appears in ASCII text
+
+    enum ArgType : uint8_t {
+        ARG_I32 = 'i',
+        ARG_U32 = 'u',
+        ARG_F32 = 'f',
+        ARG_BOOL = 'b',
+        ARG_STR = 's'       // length byte + chars, truncated to MAX_STR
+    };
+
+    static BinLog& Instance();
+
+    template <typename... Args>
+    void write(LogMsg id, Args... args) {
+        uint8_t rec[MAX_FRAME];
+        size_t len = PAYLOAD_OFFSET + 6;    // after timestamp and id
+        pack(rec, len, args...);
+        commit(id, rec, len);
+    }
+
+    /// Copy pending frames to USB - call from an idle task
+    void drain();
+
+    uint32_t written() const { return _written; }
+    uint32_t dropped() const { return _dropped; }
+    uint32_t highWater() const { return _highWater; }
+
+    void logStats() const;
+    void registerCommands();
+
+private:
+    BinLog() = default;
+    BinLog(const BinLog&) = delete;
+    BinLog& operator=(const BinLog&) = delete;
+
+    static constexpr size_t MAX_FRAME = 64;
+    static constexpr size_t MAX_STR = 24;
+    static constexpr size_t PAYLOAD_OFFSET = 2;     // SYNC, len
+    static constexpr size_t RING_SIZE = BINLOG_RING_BYTES;
+    static constexpr size_t RING_MASK = RING_SIZE - 1;
+    static constexpr size_t MAX_DRAIN_BYTES = 256;
+    static_assert((RING_SIZE & RING_MASK) == 0, "BINLOG_RING_BYTES must be a power of two");
+
+    void commit(LogMsg id, uint8_t* rec, size_t len);
+
+    static void pack(uint8_t*, size_t&) {}
+
+    template <typename T, typename... Rest>
+    static void pack(uint8_t* rec, size_t& len, T first, Rest... rest) {
+        put(rec, len, first);
+        pack(rec, len, rest...);
+    }
+
+    static void putRaw(uint8_t* rec, size_t& len, uint8_t type, const void* v, size_t n) {
+        // Leave room for the checksum; drop arguments that don't fit
+        if (len + 1 + n + 1 > MAX_FRAME) return;
+        rec[len++] = type;
+        memcpy(rec + len, v, n);
+        len += n;
+    }
+
+    static void putI32(uint8_t* rec, size_t& len, int32_t v) { putRaw(rec, len, ARG_I32, &v, 4); }
+    static void putU32(uint8_t* rec, size_t& len, uint32_t v) { putRaw(rec, len, ARG_U32, &v, 4); }
+
+    static void put(uint8_t* rec, size_t& len, int v) { putI32(rec, len, v); }
+    static void put(uint8_t* rec, size_t& len, long v) { putI32(rec, len, static_cast<int32_t>(v)); }
+    static void put(uint8_t* rec, size_t& len, short v) { putI32(rec, len, v); }
+    static void put(uint8_t* rec, size_t& len, signed char v) { putI32(rec, len, v); }
+    static void put(uint8_t* rec, size_t& len, unsigned v) { putU32(rec, len, v); }
+    static void put(uint8_t* rec, size_t& len, unsigned long v) { putU32(rec, len, static_cast<uint32_t>(v)); }
+    static void put(uint8_t* rec, size_t& len, unsigned short v) { putU32(rec, len, v); }
+    static void put(uint8_t* rec, size_t& len, unsigned char v) { putU32(rec, len, v); }
+    static void put(uint8_t* rec, size_t& len, float v) { putRaw(rec, len, ARG_F32, &v, 4); }
+    static void put(uint8_t* rec, size_t& len, double v) { put(rec, len, static_cast<float>(v)); }
+    static void put(uint8_t* rec, size_t& len, bool v) {
+        uint8_t b = v ? 1 : 0;
+        putRaw(rec, len, ARG_BOOL, &b, 1);
+    }
+    static void put(uint8_t* rec, size_t& len, const char* s) {
+        uint8_t n = 0;
+        while (s && s[n] && n < MAX_STR) n++;
+        if (len + 2 + n + 1 > MAX_FRAME) return;
+        rec[len++] = ARG_STR;
+        rec[len++] = n;
+        memcpy(rec + len, s, n);
+        len += n;
+    }
+
+    uint8_t _ring[RING_SIZE];
+    volatile uint32_t _head = 0;    // free-running, advanced by writers
+    volatile uint32_t _tail = 0;    // free-running, advanced by drain()
+
+    uint32_t _written = 0;
+    uint32_t _dropped = 0;
+    uint32_t _droppedUnreported = 0;
+    uint32_t _highWater = 0;
+};
@@ -0,0 +1,91 @@
+// BootSequence.cpp
+#include "BootSequence.h"
+#include <genieArduinoDEV.h>
+#include "Config.h"
+#include "Log.h"
+#include "ScreenManager.h"
+#include "TaskScheduler.h"
+#include "UsbConsole.h"
+
+extern Genie genie;
+
+BootSequence& BootSequence::Instance() {
+    static BootSequence inst;
+    return inst;
+}
+
+void BootSequence::begin() {
+    _setupMs = ClearCore::TimingMgr.Milliseconds();
+}
+
+void BootSequence::markMotionReady() {
+    _motionReadyMs = ClearCore::TimingMgr.Milliseconds();
+}
+
+uint32_t BootSequence::timeToMotionReadyMs() const {
+    return motionReady() ? _motionReadyMs - _setupMs : 0;
+}
+
+void BootSequence::update() {
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    uint32_t sinceSetup = now - _setupMs;
+
+    if (!usbAttached() && ClearCore::ConnectorUsb) _usbMs = now;
+    if (!displayOnline() && genie.IsOnline()) _displayMs = now;
+
+    if (!_splashDone) {
+        if (displayOnline() && now - _displayMs >= BOOT_SPLASH_MS) {
+            endSplash();
+        }
+        else if (!displayOnline() && sinceSetup >= BOOT_DISPLAY_TIMEOUT_MS) {
+            LOG_WARN(Genie, "[Boot] No display after ", sinceSetup, " ms, running headless");
+            endSplash();
+        }
+    }
+
+    if (_splashDone && !_reported && (usbAttached() || sinceSetup >= BOOT_USB_TIMEOUT_MS)) {
+        _reported = true;
+        // Same report the boot command prints, gated like any other log
+        if (LOG_ENABLED(Sys, Info)) logReport();
+        if (_taskId >= 0) TaskScheduler::Instance().setEnabled(_taskId, false);
+    }
+}
+
+void BootSequence::endSplash() {
+    _splashDone = true;
+    // Only move on if nothing else has already left the splash
+    auto& screens = ScreenManager::Instance();
+    if (screens.currentForm() == FORM_SPLASH) screens.ShowManualMode();
+}
+
+void BootSequence::sendMilestone(const char* label, uint32_t atMs) const {
+    ClearCore::ConnectorUsb.Send("[Boot] ");
+    ClearCore::ConnectorUsb.Send(label);
+    if (atMs == NOT_YET) {
+        ClearCore::ConnectorUsb.SendLine(": not yet");
+        return;
+    }
+    ClearCore::ConnectorUsb.Send(": +");
+    ClearCore::ConnectorUsb.Send(atMs - _setupMs);
+    ClearCore::ConnectorUsb.Send(" ms (");
+    ClearCore::ConnectorUsb.Send(atMs);
+    ClearCore::ConnectorUsb.SendLine(" ms after reset)");
+}
+
+void BootSequence::logReport() const {
+    ClearCore::ConnectorUsb.Send("[Boot] setup entered ");
+    ClearCore::ConnectorUsb.Send(_setupMs);
+    ClearCore::ConnectorUsb.SendLine(" ms after reset");
+    sendMilestone("motion ready", _motionReadyMs);
+    sendMilestone("display online", _displayMs);
+    sendMilestone("usb attached", _usbMs);
+}
+
+static void bootCommand(const char*) {
+    BootSequence::Instance().logReport();
+}
+
+void BootSequence::registerCommands() {
+    UsbConsole::Instance().registerCommand("boot", bootCommand,
+        "boot milestones: motion ready, display online, usb attached");
+}
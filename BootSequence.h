@@ -0,0 +1,60 @@
+// BootSequence.h
+#pragma once
+
+#include <ClearCore.h>
+
+/// Boot milestones and the parts of startup that finish in the background.
+///
+/// setup() brings up the E-stop chain and motion first and calls
+/// markMotionReady(); nothing before that point waits on a far end. The USB
+/// host and the Genie display are then started without waiting for either -
+/// the display library detects its panel from DoEvents() - and the "boot"
+/// task polls for both. Once the display answers (or BOOT_DISPLAY_TIMEOUT_MS
+/// passes and the saw runs headless) the splash gives way to manual mode.
+/// When the display has settled and USB is attached (or BOOT_USB_TIMEOUT_MS
+/// passes) the task logs one boot report and disables itself. "boot" on the
+/// USB console prints the same report any time later.
+class BootSequence {
+public:
+    static BootSequence& Instance();
+
+    /// First thing in setup()
+    void begin();
+
+    /// E-stop and motion are up; the machine can be jogged from the pendant
+    void markMotionReady();
+
+    /// Scheduler task id of update(), so it can retire itself
+    void setTaskId(int id) { _taskId = id; }
+
+    /// Poll USB and display, end the splash - call from a scheduler task
+    void update();
+
+    bool motionReady() const { return _motionReadyMs != NOT_YET; }
+    bool displayOnline() const { return _displayMs != NOT_YET; }
+    bool usbAttached() const { return _usbMs != NOT_YET; }
+
+    /// Milliseconds from setup() entry to motion ready
+    uint32_t timeToMotionReadyMs() const;
+
+    void logReport() const;
+    void registerCommands();
+
+private:
+    BootSequence() = default;
+    BootSequence(const BootSequence&) = delete;
+    BootSequence& operator=(const BootSequence&) = delete;
+
+    void endSplash();
+    void sendMilestone(const char* label, uint32_t atMs) const;
+
+    static constexpr uint32_t NOT_YET = 0xFFFFFFFFUL;
+
+    int      _taskId = -1;
+    uint32_t _setupMs = 0;               // Milliseconds() at setup() entry (time since reset)
+    uint32_t _motionReadyMs = NOT_YET;
+    uint32_t _displayMs = NOT_YET;
+    uint32_t _usbMs = NOT_YET;
+    bool     _splashDone = false;
+    bool     _reported = false;
+};
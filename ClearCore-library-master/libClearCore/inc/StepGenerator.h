@@ -43,6 +43,11 @@ namespace ClearCore
     fractional values (15). **/
 #define FRACT_BITS 15
 
+/** Jerk-limited (S-curve) moves integrate jerk, acceleration and velocity
+    with 32 more fractional bits than FRACT_BITS, since a practical jerk limit
+    is far below one Q15 step pulse per sample^3. **/
+#define SCURVE_FRACT_BITS (FRACT_BITS + 32)
+
     /**
         \class StepGenerator
         \brief ClearCore Step and Direction generator class
@@ -247,6 +252,31 @@ namespace ClearCore
         **/
         void EStopDecelMax(uint32_t decelMax);
 
+        /**
+            \brief Sets the maximum jerk for positional moves in step pulses
+            per second^3. 0 (the default) keeps the trapezoidal profile.
+
+            With a jerk limit set, a positional move that starts from a
+            standstill runs as a 7-segment S-curve: the acceleration ramps up
+            and down at no more than \a jerkMax instead of stepping between 0
+            and #AccelMax. The move still respects #VelMax and #AccelMax and
+            lands exactly on its target; it takes a little longer than the
+            trapezoid would. Moves issued while already in motion, velocity
+            moves and #MoveStopDecel stay trapezoidal.
+
+            Like the other limits, a new value applies from the next move.
+
+            \code{.cpp}
+            // Limit M-0's jerk to 5,000,000 step pulses/sec^3
+            ConnectorM0.JerkMax(5000000);
+            \endcode
+
+            \param[in] jerkMax The new jerk limit, 0 to disable
+
+            <div class="sd-disclaimer">For use with Step and Direction mode.</div>
+        **/
+        void JerkMax(uint32_t jerkMax);
+
         /**
             \brief Function to check if no steps are currently being commanded to
             the motor.
@@ -284,7 +314,8 @@ namespace ClearCore
         **/
         bool CruiseVelocityReached()
         {
-            return MoveStateGet() == MS_CRUISE;
+            return MoveStateGet() == MS_CRUISE ||
+                   (MoveStateGet() == MS_SCURVE && m_scSegment == SC_CRUISE);
         }
 
     protected:
@@ -319,8 +350,22 @@ namespace ClearCore
             MS_DECEL_VEL,
             MS_END,
             MS_CHANGE_DIR,
+            MS_SCURVE,
         } MoveStates;
 
+        /** Segments of an S-curve move, in order **/
+        typedef enum
+        {
+            SC_JERK_UP,      // Acceleration ramps up
+            SC_ACCEL,        // Constant acceleration
+            SC_JERK_DOWN,    // Acceleration ramps back to 0
+            SC_CRUISE,
+            SC_DECEL_UP,     // Deceleration ramps up
+            SC_DECEL,        // Constant deceleration
+            SC_DECEL_DOWN,   // Deceleration ramps back to 0
+            SC_SEGMENTS,
+        } SCurveSegments;
+
         uint32_t m_stepsPrevious;
         uint32_t m_stepsPerSampleMax;
         MoveStates m_moveState;
@@ -392,11 +437,36 @@ namespace ClearCore
         int32_t m_accelLimitPendingQx;    // Acceleration limit
         int32_t m_altDecelLimitPendingQx; // E-Stop Deceleration limit
 
+        // Jerk-limited positional moves, in SCURVE_FRACT_BITS fixed point.
+        // The segment lengths are whole samples and the jerk is scaled so the
+        // profile covers exactly the move distance.
+        int64_t m_jerkLimitQj;        // Jerk limit, 0 for trapezoidal moves
+        int64_t m_jerkLimitPendingQj; // Jerk limit for the next move
+        int64_t m_scJerkQj;           // Jerk of the current S-curve
+        int64_t m_scJerkSixthQj;      // m_scJerkQj / 6, for the position step
+        int64_t m_scAccelQj;          // Current acceleration (signed)
+        int64_t m_scVelQj;            // Current velocity
+        int64_t m_scPosnFractQj;      // Position below one Q15 unit
+        uint32_t m_scRampSamples;     // Length of each jerk segment
+        uint32_t m_scAccelSamples;    // Length of each constant-accel segment
+        uint32_t m_scCruiseSamples;   // Length of the cruise segment
+        uint32_t m_scSamplesLeft;     // Samples left in the current segment
+        uint8_t m_scSegment;          // Current SCurveSegments value
+
         virtual void OutputDirection() = 0;
         void StepsPerSampleMaxSet(uint32_t maxSteps);
 
         void AltVelMax(int32_t velMax);
 
+        /**
+            \brief Private helper that lays out an S-curve from a standstill
+            to m_posnTargetQx. Returns false if the move should stay
+            trapezoidal (no jerk limit, too short or too long to plan).
+        **/
+        bool SCurvePlan();
+
+        uint32_t SCurveSegmentSamples(uint8_t segment) const;
+
         /**
             \brief Private helper function for Move functions to call that
             updates the internal vel/accel limits to those set by the user.
@@ -410,6 +480,7 @@ namespace ClearCore
             m_altVelLimitQx = m_altVelLimitPendingQx;
             m_accelLimitQx = m_accelLimitPendingQx;
             m_altDecelLimitQx = m_altDecelLimitPendingQx;
+            m_jerkLimitQj = m_jerkLimitPendingQj;
         }
     };
 
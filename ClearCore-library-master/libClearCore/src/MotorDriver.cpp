@@ -376,7 +376,7 @@ void MotorDriver::Refresh() {
         m_lastMoveWasPositional && !statusRegPending.bit.StepsActive &&
         m_hlfbState == HLFB_ASSERTED;
     statusRegPending.bit.AtTargetVelocity = m_isEnabled &&
-        (StepGenerator::m_moveState == StepGenerator::MoveStates::MS_CRUISE ||
+        (StepGenerator::CruiseVelocityReached() ||
         (!statusRegPending.bit.StepsActive && !m_lastMoveWasPositional)) &&
         m_hlfbState != HLFB_DEASSERTED;
     statusRegPending.bit.PositionalMove = m_lastMoveWasPositional;
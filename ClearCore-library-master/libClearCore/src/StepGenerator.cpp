@@ -108,6 +108,11 @@ void StepGenerator::StepsCalculated() {
                 m_velTargetQx = 0;
             }
 
+            else if (m_jerkLimitQj && !m_velCurrentQx && SCurvePlan()) {
+                // Jerk limited move from a standstill
+                m_moveState = MS_SCURVE;
+            }
+
             else {
                 // If the move profile is a triangle (i.e. doesn't reach
                 // VelLimit), set the velocity limit to peak velocity so that
@@ -294,6 +299,56 @@ void StepGenerator::StepsCalculated() {
                 }
             }
             break;
+        case MS_SCURVE: { // Jerk limited positional move
+            // Jerk is constant within a sample, so integrate it exactly:
+            //   posn += vel + accel / 2 + jerk / 6
+            //   vel += accel + jerk / 2
+            //   accel += jerk
+            // The ramps pair up (+j/-j), so accel and vel return to exactly 0
+            // and the position truncations cancel.
+            int64_t jerkQj = 0;
+            int64_t jerkSixthQj = 0;
+            if (m_scSegment == SC_JERK_UP || m_scSegment == SC_DECEL_DOWN) {
+                jerkQj = m_scJerkQj;
+                jerkSixthQj = m_scJerkSixthQj;
+            }
+            else if (m_scSegment == SC_JERK_DOWN || m_scSegment == SC_DECEL_UP) {
+                jerkQj = -m_scJerkQj;
+                jerkSixthQj = -m_scJerkSixthQj;
+            }
+            m_scPosnFractQj += m_scVelQj + (m_scAccelQj >> 1) + jerkSixthQj;
+            m_scVelQj += m_scAccelQj + (jerkQj >> 1);
+            m_scAccelQj += jerkQj;
+
+            // Carry whole Q15 units into the move position
+            m_posnCurrentQx += m_scPosnFractQj >> (SCURVE_FRACT_BITS - FRACT_BITS);
+            m_scPosnFractQj &= (INT64_C(1) << (SCURVE_FRACT_BITS - FRACT_BITS)) - 1;
+            m_velCurrentQx = m_scVelQj >> (SCURVE_FRACT_BITS - FRACT_BITS);
+            m_accelCurrentQx = (m_scAccelQj < 0 ? -m_scAccelQj : m_scAccelQj) >>
+                               (SCURVE_FRACT_BITS - FRACT_BITS);
+
+            if (--m_scSamplesLeft == 0) {
+                // Advance past any empty segments
+                do {
+                    m_scSegment++;
+                } while (m_scSegment < SC_SEGMENTS &&
+                         !SCurveSegmentSamples(m_scSegment));
+
+                if (m_scSegment >= SC_SEGMENTS) {
+                    // Done; the position is within a fraction of a step of
+                    // the target, enforce it exactly.
+                    m_accelCurrentQx = 0;
+                    m_velCurrentQx = 0;
+                    m_posnCurrentQx = m_posnTargetQx;
+                    m_moveState = MS_END;
+                }
+                else {
+                    m_scSamplesLeft = SCurveSegmentSamples(m_scSegment);
+                }
+            }
+            break;
+        }
+
         case MS_CHANGE_DIR:
             // When a direction change occurs, the goal is to slow down
             // as quickly as possible (accel limit). During this slow
@@ -345,6 +400,117 @@ void StepGenerator::StepsCalculated() {
     m_posnAbsolute += m_direction ? -m_stepsPrevious : m_stepsPrevious;
 }
 
+/*
+    Plan a jerk limited move from a standstill to m_posnTargetQx.
+
+    Lays out the continuous 7-segment profile for the distance under the
+    velocity, acceleration and jerk limits, then rounds each segment up to
+    whole samples: Nj samples per jerk ramp, Na per constant-accel segment and
+    Nv of cruise. For a symmetric profile with jerk j the distance is
+        j * Nj * (Nj + Na) * (2 * Nj + Na + Nv)
+    so j is recomputed from that product to cover the distance exactly. Since
+    every segment only got longer, the peak jerk, acceleration and velocity
+    can only drop below their limits.
+*/
+bool StepGenerator::SCurvePlan() {
+    int64_t distQx = m_posnTargetQx - m_posnCurrentQx;
+    if (distQx <= 0 || m_jerkLimitQj <= 0) {
+        return false;
+    }
+
+    // Planning runs once per move, in per-sample units
+    float dist = static_cast<float>(distQx) / (1L << FRACT_BITS);
+    float vel = static_cast<float>(m_velLimitQx) / (1L << FRACT_BITS);
+    float accel = static_cast<float>(m_accelLimitQx) / (1L << FRACT_BITS);
+    float jerk = static_cast<float>(m_jerkLimitQj) /
+                 static_cast<float>(INT64_C(1) << SCURVE_FRACT_BITS);
+
+    float rampTime = accel / jerk;  // Time to reach full acceleration
+    float accelTime;
+    float cruiseTime = 0;
+    if (vel * jerk < accel * accel) {
+        // The velocity limit is reached before the acceleration limit
+        rampTime = sqrtf(vel / jerk);
+        accelTime = 0;
+    }
+    else {
+        accelTime = vel / accel - rampTime;
+    }
+    // Distance to speed up to the velocity limit and back down
+    float rampDist = vel * (2 * rampTime + accelTime);
+    if (rampDist <= dist) {
+        cruiseTime = (dist - rampDist) / vel;
+    }
+    else if (dist >= 2 * accel * (accel / jerk) * (accel / jerk)) {
+        // No cruise, but full acceleration is reached
+        rampTime = accel / jerk;
+        float peakVel = (sqrtf(accel * accel * rampTime * rampTime +
+                               4 * accel * dist) - accel * rampTime) / 2;
+        accelTime = max(peakVel / accel - rampTime, 0.0f);
+    }
+    else {
+        // Short move: jerk ramps only
+        rampTime = cbrtf(dist / (2 * jerk));
+        accelTime = 0;
+    }
+    if (cruiseTime > 1e9f) {
+        return false;
+    }
+
+    uint32_t rampSamples = static_cast<uint32_t>(ceilf(rampTime));
+    if (rampSamples < 1) {
+        rampSamples = 1;
+    }
+    uint32_t accelSamples = static_cast<uint32_t>(ceilf(accelTime));
+    uint32_t cruiseSamples = static_cast<uint32_t>(ceilf(cruiseTime));
+
+    uint64_t shape = static_cast<uint64_t>(rampSamples) *
+                     (rampSamples + accelSamples) *
+                     (2ULL * rampSamples + accelSamples + cruiseSamples);
+    // Keeps the division below in range and the end error far below a step
+    if (shape >= (1ULL << 40)) {
+        return false;
+    }
+
+    // jerkQj = (distQx << 32) / shape, in three steps to stay in 64 bits
+    uint64_t quot = static_cast<uint64_t>(distQx) / shape;
+    uint64_t rem = static_cast<uint64_t>(distQx) % shape;
+    uint64_t jerkQj = quot << 32;
+    rem <<= 16;
+    jerkQj += (rem / shape) << 16;
+    rem = (rem % shape) << 16;
+    jerkQj += rem / shape;
+    // Even, so the halves taken in the ISR are exact
+    jerkQj &= ~1ULL;
+    if (jerkQj < 2) {
+        return false;
+    }
+
+    m_scJerkQj = static_cast<int64_t>(jerkQj);
+    m_scJerkSixthQj = m_scJerkQj / 6;
+    m_scAccelQj = 0;
+    m_scVelQj = 0;
+    m_scPosnFractQj = 0;
+    m_scRampSamples = rampSamples;
+    m_scAccelSamples = accelSamples;
+    m_scCruiseSamples = cruiseSamples;
+    m_scSegment = SC_JERK_UP;
+    m_scSamplesLeft = rampSamples;
+    return true;
+}
+
+uint32_t StepGenerator::SCurveSegmentSamples(uint8_t segment) const {
+    switch (segment) {
+        case SC_ACCEL:
+        case SC_DECEL:
+            return m_scAccelSamples;
+        case SC_CRUISE:
+            return m_scCruiseSamples;
+        default:
+            return m_scRampSamples;
+    }
+}
+
 /*
     Default constructor
 */
@@ -374,7 +540,19 @@ StepGenerator::StepGenerator()
       m_velLimitPendingQx(1),
       m_altVelLimitPendingQx(0),
       m_accelLimitPendingQx(2),
-      m_altDecelLimitPendingQx(2) {}
+      m_altDecelLimitPendingQx(2),
+      m_jerkLimitQj(0),
+      m_jerkLimitPendingQj(0),
+      m_scJerkQj(0),
+      m_scJerkSixthQj(0),
+      m_scAccelQj(0),
+      m_scVelQj(0),
+      m_scPosnFractQj(0),
+      m_scRampSamples(0),
+      m_scAccelSamples(0),
+      m_scCruiseSamples(0),
+      m_scSamplesLeft(0),
+      m_scSegment(SC_JERK_UP) {}
 
 /*
     This function clears the current move and puts the motor in a
@@ -570,6 +748,21 @@ void StepGenerator::EStopDecelMax(uint32_t decelMax) {
     m_altDecelLimitPendingQx = max(decelQx, m_accelLimitQx);
 }
 
+/*
+    This function takes the jerk in step pulses/sec^3
+    and sets m_jerkLimitPendingQj in step pulses/sample^3.
+*/
+void StepGenerator::JerkMax(uint32_t jerkMax) {
+    // Convert from step pulses/sec^3 to step pulses/sample^3 with
+    // SCURVE_FRACT_BITS of fraction. jerkMax << 31 fits in 64 bits; the
+    // remaining 16 bits are applied after the divide.
+    uint64_t sampleRateCubed = static_cast<uint64_t>(SampleRateHz) *
+                               SampleRateHz * SampleRateHz;
+    m_jerkLimitPendingQj = static_cast<int64_t>(
+        ((static_cast<uint64_t>(jerkMax) << 31) / sampleRateCubed)
+        << (SCURVE_FRACT_BITS - 31));
+}
+
 /*
     This function limits the velocity to the maximum that the step output
     can provide.
@@ -5,7 +5,9 @@
 
 // === Serial Configuration ===
 #define USB_BAUD            115200
-#define GENIE_BAUD          115200
+#define GENIE_BAUD          115200  // Rate the display boots at
+#define GENIE_FAST_BAUD     600000  // Negotiated once the display is up; 0 stays at GENIE_BAUD
+#define GENIE_BAUD_MAGIC    0       // Magic object index of the display's baud handler
 #define GENIE_SERIAL_PORT Serial0  // Optional, or just use Serial1 directly
 
 // === Motor Connections ===
@@ -42,6 +44,47 @@
 #define MAX_X_INCHES 7.0f   // for example
 #define MAX_Y_INCHES 7.0f   // your table depth
 
+// Positional move limits (steps/s, steps/s^2)
+#define FENCE_VEL_MAX             10000.0f
+#define FENCE_ACCEL_MAX           100000.0f
+#define TABLE_VEL_MAX             10000.0f
+#define TABLE_ACCEL_MAX           100000.0f
+
+// S-curve positional moves. MotorDriver::JerkMax exists only in the patched
+// libClearCore in ClearCore-library-master; the project builds against the
+// stock 1.7.0 board package, which doesn't have it. Leave 0 until the build
+// links the patched library (see README.md): every move, cycle-time estimate
+// and blend distance is then trapezoidal and the jerk limits go unused.
+#define MOTION_SCURVE             0
+
+// Jerk limits for positional moves (steps/s^3) with MOTION_SCURVE.
+// Acceleration ramps over MAX_ACCELERATION / jerk (20 ms at 100000 steps/s^2),
+// see StepGenerator::JerkMax and tools/stepgen_sim
+#define FENCE_JERK_MAX            5000000UL
+#define TABLE_JERK_MAX            5000000UL
+
+// The jerk the axes actually run with; 0 = trapezoidal profile
+#define FENCE_MOVE_JERK           (MOTION_SCURVE ? FENCE_JERK_MAX : 0UL)
+#define TABLE_MOVE_JERK           (MOTION_SCURVE ? TABLE_JERK_MAX : 0UL)
+
+// Queued moves per axis (see MotionQueue.h)
+#define MOTION_QUEUE_DEPTH        8
+
+// Cut sequencing: overlap the X index with the Y retract and approach.
+// X may move once the table is CUT_SEQ_BLADE_CLEARANCE short of the cut
+// start; the Y approach is queued once X is inside CUT_SEQ_X_ENVELOPE.
+#define CUT_SEQ_OVERLAP           true
+#define CUT_SEQ_BLADE_CLEARANCE   0.050f  // Inches
+#define CUT_SEQ_X_ENVELOPE        0.100f  // Inches
+
+// Cut order planner: cost of reversing the fence (backlash take-up and
+// settle) when comparing cut orders, see CutPlanner.h
+#define CUT_PLAN_REVERSAL_MS      150
+
+// Cycle-time estimator: weight of each finished cut in the learned feed
+// speed and index scale, see CycleTimeEstimator.h
+#define CYCLE_EST_LEARN_RATE      0.2f
+
 // === RPM Control ===
 #define SPINDLE_MAX_RPM       4000.0f
 #define RPM_MIN               0.0f
@@ -55,6 +98,15 @@
 #define JOG_MULTIPLIER_X10        10
 #define JOG_MULTIPLIER_X100       100
 
+// MPG handwheel following: the axis tracks the wheel with velocity commands
+// from the motion task instead of one move per batch of clicks
+#define MPG_FOLLOW_MODE           true
+#define MPG_FOLLOW_TC_MS          40.0f   // Error time constant - the smoothing, and the lag at steady wheel speed
+#define MPG_FOLLOW_MAX_LAG        0.100f  // Inches; wheel travel beyond this is dropped
+#define MPG_FOLLOW_MAX_SPEED      2.4f    // Inches/s before the range scale (X1 15%, X10 50%, X100 90%)
+#define MPG_FOLLOW_BRAKE_ACCEL    20.0f   // Inches/s^2, under the axes' 100000 steps/s^2 (~24.6)
+#define MPG_FOLLOW_SETTLE         0.0002f // Inches; closer than this with the wheel still, land with a move
+
 // === Form IDs ===
 #define FORM_HOMING         0   // Form0
 #define FORM_JOG_X          1   // Form1 (Jog Fence)
@@ -229,9 +281,83 @@
 // Encoder position verification mode
 #define ENCODER_VERIFICATION_ENABLED  true    // Set to false to disable position verification
 
-// Debug settings
-#define ENCODER_DEBUG_LOGGING  true    // Enable/disable detailed position logging
+// Debug settings (position logging is Motion/Debug, see Logging below)
 #define ENCODER_LOG_INTERVAL   1000    // Milliseconds between position log messages
 
 // Motor references for encoder position tracking
-#define MOTOR_SAW_Y  MOTOR_TABLE_Y     // Clarifying Y-axis motor reference for encoder tracking
\ No newline at end of file
+#define MOTOR_SAW_Y  MOTOR_TABLE_Y     // Clarifying Y-axis motor reference for encoder tracking
+
+// === Main Loop Scheduler ===
+// Task rates in microseconds (see AutoSawController::setup)
+#define TASK_PERIOD_ESTOP_US      1000    // 1 kHz
+#define TASK_PERIOD_MOTION_US     1000    // 1 kHz - axis updates, torque feed loop
+#define TASK_PERIOD_PENDANT_US    5000    // 200 Hz
+#define TASK_PERIOD_UI_INPUT_US   10000   // 100 Hz
+#define TASK_PERIOD_GENIE_US      2000    // 500 Hz - keeps the display UART drained
+#define TASK_PERIOD_SCREEN_US     40000   // 25 Hz
+#define TASK_PERIOD_CONSOLE_US    20000   // 50 Hz - USB command console
+#define TASK_PERIOD_BOOT_US       20000   // 50 Hz - background boot steps, retires itself
+
+// Scheduler statistics
+#define SCHEDULER_STATS_LOGGING   false   // Periodically dump per-task overrun counters
+#define SCHEDULER_STATS_INTERVAL  10000   // Milliseconds between dumps
+
+// Boot pipeline (see BootSequence.h) - safety and motion come up first,
+// USB and the display are picked up in the background
+#define BOOT_SPLASH_MS            500     // Splash time once the display has answered
+#define BOOT_DISPLAY_TIMEOUT_MS   5000    // No display by then: leave the splash and run headless
+#define BOOT_USB_TIMEOUT_MS       10000   // Log the boot report by then even without a USB host
+
+// Loop-stall watchdog
+#define LOOP_STALL_BUDGET_US      2000    // A scheduler pass longer than this counts as a stall
+#define LOOP_WATCHDOG_LOGGING     true    // Report stalls over USB
+#define LOOP_WATCHDOG_LOG_INTERVAL 1000   // Min milliseconds between stall reports
+
+// Latency histograms (dump with "lat" on the USB console, clear with "lat reset")
+#define LATENCY_PROFILING         true    // false compiles the probes out
+
+// Binary log ring (decode on the host with tools/binlog_decode.py)
+#define BINLOG_RING_BYTES         4096    // Power of two; frames are dropped, not blocked, when full
+
+// === Logging ===
+// Per-category log levels (see Log.h): LogLevel::Off, Error, Warn, Info, Debug.
+// Statements above a category's level compile out, arguments included.
+#ifndef LOG_MAX_LEVEL
+#define LOG_MAX_LEVEL             LogLevel::Debug  // Build-wide cap; LogLevel::Error for a lean production build
+#endif
+#define LOG_LEVEL_MOTION          LogLevel::Debug  // Axes, encoder tracking, MPG
+#define LOG_LEVEL_FEED            LogLevel::Info   // Torque-controlled feed
+#define LOG_LEVEL_UI              LogLevel::Info   // Screens and pendant
+#define LOG_LEVEL_HOMING          LogLevel::Info
+#define LOG_LEVEL_SEQ             LogLevel::Info   // Cut sequencing
+#define LOG_LEVEL_GENIE           LogLevel::Info   // Display traffic
+#define LOG_LEVEL_SYS             LogLevel::Info   // E-stop, scheduler, watchdog, console
+
+// === Torque Feed Loop ===
+// Opt-in: run the Y torque-feed law from a fixed-rate timer interrupt
+// instead of the main loop. DynamicFeed still owns the feed state machine.
+#define TORQUE_LOOP_IN_ISR        false   // true = interrupt-driven torque law
+#define TORQUE_LOOP_RATE_HZ       5000    // Matches the ClearCore sample rate (min ~1900 Hz)
+#define TORQUE_LOOP_IRQ_PRIORITY  4       // Below the ClearCore sample interrupt (0-7, 0 highest)
+#define TORQUE_LOOP_FAST_TAU_MS   5.0f    // Torque filter seen by the control law
+#define TORQUE_LOOP_SLOW_TAU_MS   200.0f  // Torque filter reported for display
+#define TORQUE_PID_PERIOD_US      2000    // Main-loop torque law step (HLFB refreshes at ~482 Hz)
+#define TORQUE_PID_WRITE_DEADBAND 0.002f  // in/s of feed change worth a new velocity command
+
+// === Cut Recorder ===
+// Samples the torque feed while Feeding; a trigger freezes the ring and it is
+// written to SD as /CUTnnnn.BIN between cuts (tools/cutrec_to_csv.py)
+#define CUT_RECORDER_ENABLED      true
+#define CUT_RECORDER_PERIOD_US    5000    // 200 Hz
+#define CUT_RECORDER_SAMPLES      1024    // Power of two, 16 bytes each (~5 s at 200 Hz)
+#define CUT_RECORDER_POST_SAMPLES 256     // Kept after a trigger; the rest is pre-trigger history
+#define CUT_RECORDER_SPIKE_MARGIN 30.0f   // Torque % over target that counts as a spike
+#define TASK_PERIOD_RECORDER_US   10000   // SD flush task, one block per run
+
+// === Display Model ===
+// Shadow cache and priority lanes in front of the Genie link (see DisplayModel.h)
+#define DISPLAY_MODEL_SLOTS        256     // Power of two; more distinct objects than this write through
+#define DISPLAY_LINK_SHARE_PCT     80      // Share of the link baud used for writes; the rest is for events and ACKs
+#define DISPLAY_BURST_FRAMES       4       // Link credit saved up while idle, in frames
+#define DISPLAY_LANE_MAX_WAIT_MS   250     // A lower lane waiting this long is served ahead of higher ones
+#define DISPLAY_FORM_BURST_FRAMES  8       // Library queue depth a new form's starting state may fill outside the budget
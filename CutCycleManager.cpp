@@ -2,6 +2,7 @@
 // CutCycleManager.cpp
 #include "CutCycleManager.h"
 #include "CutPositionData.h"
+#include "Log.h"
 #include "SettingsManager.h"
 
 CutCycleManager& CutCycleManager::Instance() {
@@ -174,8 +175,7 @@ void CutCycleManager::setState(CutCycleState newState) {
         _lastStateChangeTime = ClearCore::TimingMgr.Milliseconds();
 
         // Debug output
-        ClearCore::ConnectorUsb.Send("[CutCycle] State changed to: ");
-        ClearCore::ConnectorUsb.SendLine(static_cast<int>(_currentState));
+        LOG_DEBUG(Seq, "[CutCycle] State changed to: ", static_cast<int>(_currentState));
     }
 }
 
@@ -226,17 +226,11 @@ void CutCycleManager::executeFeedCycle() {
     float targetY = posData.getCutEndPosition();
 
     // Log the current and target positions
-    ClearCore::ConnectorUsb.Send("[CutCycle] Y position: current=");
-    ClearCore::ConnectorUsb.Send(currentY);
-    ClearCore::ConnectorUsb.Send(", target=");
-    ClearCore::ConnectorUsb.SendLine(targetY);
+    LOG_INFO(Seq, "[CutCycle] Y position: current=", currentY, ", target=", targetY);
 
     if (fabs(currentY - targetY) > 0.001f) {
         // Move Y to cut end position at feed rate
-        ClearCore::ConnectorUsb.Send("[CutCycle] Moving Y to ");
-        ClearCore::ConnectorUsb.Send(targetY);
-        ClearCore::ConnectorUsb.Send(" at feed rate ");
-        ClearCore::ConnectorUsb.SendLine(_feedRate);
+        LOG_INFO(Seq, "[CutCycle] Moving Y to ", targetY, " at feed rate ", _feedRate);
 
         motion.moveToWithRate(AXIS_Y, targetY, _feedRate);
 
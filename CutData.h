@@ -6,6 +6,7 @@
     struct CutData {
         // X-axis (cut sequence) parameters
         float cutPositions[kMaxCuts] = { 0.0f }; // Array of cut positions (inches)
+        float cutDepths[kMaxCuts] = { 0.0f };    // Y cut end per position (inches), 0 = cutEndPoint
         int numCuts = 0;                       // Number of valid cut positions
         float positionZero = 0.0f;   // Captured zero position for X
         bool useStockZero = false;   // Whether to use the captured zero
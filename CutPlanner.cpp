@@ -0,0 +1,103 @@
+// CutPlanner.cpp
+#include "CutPlanner.h"
+#include "Config.h"
+#include "Log.h"
+#include "MoveProfile.h"
+#include <math.h>
+
+namespace {
+
+    // Positions closer than this are the same cut position
+    constexpr float SAME_X = 0.0005f;
+
+    struct Cost {
+        float travel;
+        uint8_t reversals;
+        uint32_t ms;
+    };
+
+    Cost price(const CutPlanner::Cut* cuts, const uint8_t* order, int count, float startX) {
+        Cost c = { 0.0f, 0, 0 };
+        float pos = startX;
+        int lastDir = 0;
+        for (int i = 0; i < count; i++) {
+            float d = cuts[order[i]].x - pos;
+            pos = cuts[order[i]].x;
+            if (fabsf(d) < SAME_X) continue;
+            int dir = d > 0.0f ? 1 : -1;
+            if (lastDir && dir != lastDir) c.reversals++;
+            lastDir = dir;
+            c.travel += fabsf(d);
+            c.ms += CutPlanner::fenceMoveMs(fabsf(d));
+        }
+        c.ms += c.reversals * CUT_PLAN_REVERSAL_MS;
+        return c;
+    }
+}
+
+uint32_t CutPlanner::fenceMoveMs(float inches) {
+    MoveProfile::Limits fence = MoveProfile::fence();
+    float t = MoveProfile::seconds(MoveProfile::plan(inches, fence));
+    return static_cast<uint32_t>(t * 1000.0f + 0.5f);
+}
+
+bool CutPlanner::plan(const Cut* cuts, int count, const Options& options, Plan& out) {
+    if (count <= 0 || count > kMaxCuts) {
+        LOG_WARN(Seq, "[CutPlan] Cut count ", count, " outside 1..", kMaxCuts);
+        return false;
+    }
+
+    // Sorted by X; insertion sort keeps equal positions in list order
+    uint8_t ascending[kMaxCuts];
+    for (int i = 0; i < count; i++) {
+        int j = i;
+        while (j > 0 && cuts[ascending[j - 1]].x > cuts[i].x) {
+            ascending[j] = ascending[j - 1];
+            j--;
+        }
+        ascending[j] = static_cast<uint8_t>(i);
+    }
+    uint8_t descending[kMaxCuts];
+    for (int i = 0; i < count; i++) {
+        descending[i] = ascending[count - 1 - i];
+    }
+
+    Cost up = price(cuts, ascending, count, options.startX);
+    Cost down = price(cuts, descending, count, options.startX);
+
+    bool useUp;
+    if (options.constraint == ORDER_STOCK_END_FIRST) {
+        // Start from whichever end of the list the stock end is nearer
+        float lo = cuts[ascending[0]].x;
+        float hi = cuts[ascending[count - 1]].x;
+        useUp = fabsf(options.stockEndX - lo) <= fabsf(options.stockEndX - hi);
+    }
+    else {
+        useUp = up.ms < down.ms || (up.ms == down.ms && up.reversals <= down.reversals);
+    }
+
+    const Cost& chosen = useUp ? up : down;
+    const uint8_t* order = useUp ? ascending : descending;
+    for (int i = 0; i < count; i++) {
+        out.order[i] = order[i];
+    }
+    out.count = count;
+    out.travel = chosen.travel;
+    out.reversals = chosen.reversals;
+    out.fenceMs = chosen.ms;
+
+    uint8_t asEntered[kMaxCuts];
+    for (int i = 0; i < count; i++) {
+        asEntered[i] = static_cast<uint8_t>(i);
+    }
+    Cost naive = price(cuts, asEntered, count, options.startX);
+    out.naiveFenceMs = naive.ms;
+    out.naiveTravel = naive.travel;
+    out.naiveReversals = naive.reversals;
+
+    LOG_INFO(Seq, "[CutPlan] ", count, " cuts ", useUp ? "ascending" : "descending",
+        ": ", Log::fixed(out.travel, 3), " in, ", out.reversals, " reversals, ", out.fenceMs,
+        " ms fence time; as entered ", Log::fixed(naive.travel, 3), " in, ", naive.reversals,
+        " reversals, ", naive.ms, " ms; saves ", out.savedMs(), " ms");
+    return true;
+}
@@ -0,0 +1,56 @@
+// CutPlanner.h
+#pragma once
+
+#include <stdint.h>
+#include "CutData.h"
+
+/// Execution order for an arbitrary list of fence cuts.
+///
+/// On a single axis the least fence travel from the current X is a sweep:
+/// go to one end of the list, then take every cut in order to the other end.
+/// That is at most one direction reversal, and a list that starts beyond
+/// either end needs none. The planner prices both sweeps with the fence's
+/// motion profile plus CUT_PLAN_REVERSAL_MS per reversal and keeps the
+/// quicker one; with ORDER_STOCK_END_FIRST only the sweep starting at the
+/// stock end is allowed. The list as entered is priced the same way, so the
+/// saving is reported against it.
+///
+///   CutPlanner::Plan plan;
+///   if (CutPlanner::plan(cuts, n, options, plan)) { ... plan.order[i] ... }
+namespace CutPlanner {
+
+    struct Cut {
+        float x;        // Fence position (inches)
+        float yStop;    // Y cut end for this cut (inches)
+    };
+
+    enum Constraint : uint8_t {
+        ORDER_FREE,             // Any order
+        ORDER_STOCK_END_FIRST   // Nearest the stock end first, working inward
+    };
+
+    struct Options {
+        float startX = 0.0f;                // Fence position before the first cut
+        Constraint constraint = ORDER_FREE;
+        float stockEndX = 0.0f;             // Free end of the stock, for ORDER_STOCK_END_FIRST
+    };
+
+    struct Plan {
+        uint8_t order[kMaxCuts];    // Indices into the input list, in execution order
+        int count = 0;
+        float travel = 0.0f;        // Fence inches
+        uint8_t reversals = 0;
+        uint32_t fenceMs = 0;       // Predicted fence time for this order
+        uint32_t naiveFenceMs = 0;  // The same for the list as entered
+        float naiveTravel = 0.0f;
+        uint8_t naiveReversals = 0;
+
+        int32_t savedMs() const { return static_cast<int32_t>(naiveFenceMs - fenceMs); }
+    };
+
+    /// Plan count cuts (1..kMaxCuts); false if the list or options are unusable
+    bool plan(const Cut* cuts, int count, const Options& options, Plan& out);
+
+    /// Predicted time for one fence move of the given length from rest to rest
+    uint32_t fenceMoveMs(float inches);
+}
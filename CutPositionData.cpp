@@ -1,6 +1,7 @@
 // Enhanced CutPositionData.cpp
 #include "CutPositionData.h"
 #include "CutSequenceController.h"
+#include "Log.h"
 #include "SettingsManager.h"
 #include <ClearCore.h>
 
@@ -21,10 +22,7 @@ void CutPositionData::buildCutSequence() {
     seq.setYCutStop(_cutEndPosition);
     seq.setYRetract(getRetractPosition());
 
-    ClearCore::ConnectorUsb.Send("[CutPosData] Built sequence with ");
-    ClearCore::ConnectorUsb.Send(_totalSlices);
-    ClearCore::ConnectorUsb.Send(" cuts, increment: ");
-    ClearCore::ConnectorUsb.SendLine(_increment);
+    LOG_INFO(Seq, "[CutPosData] Built sequence with ", _totalSlices, " cuts, increment: ", _increment);
 }
 
 std::vector<float> CutPositionData::getAllCutPositions() const {
@@ -38,19 +36,19 @@ std::vector<float> CutPositionData::getAllCutPositions() const {
 bool CutPositionData::isReadyForSequence() const {
     // Check that all required parameters are set
     if (_increment <= 0) {
-        ClearCore::ConnectorUsb.SendLine("[CutPosData] Invalid increment");
+        LOG_WARN(Seq, "[CutPosData] Invalid increment");
         return false;
     }
     if (_totalSlices <= 0) {
-        ClearCore::ConnectorUsb.SendLine("[CutPosData] Invalid slice count");
+        LOG_WARN(Seq, "[CutPosData] Invalid slice count");
         return false;
     }
     if (_cutEndPosition <= _cutStartPosition) {
-        ClearCore::ConnectorUsb.SendLine("[CutPosData] Invalid cut positions");
+        LOG_WARN(Seq, "[CutPosData] Invalid cut positions");
         return false;
     }
     if (_retractDistance <= 0) {
-        ClearCore::ConnectorUsb.SendLine("[CutPosData] Invalid retract distance");
+        LOG_WARN(Seq, "[CutPosData] Invalid retract distance");
         return false;
     }
     return true;
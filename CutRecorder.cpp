@@ -0,0 +1,229 @@
+// CutRecorder.cpp
+#include "CutRecorder.h"
+#include "FileManager.h"
+#include "UsbConsole.h"
+#include "Log.h"
+#include <stdio.h>
+#include <string.h>
+
+static int16_t toCenti(float v) {
+    float scaled = v * 100.0f;
+    if (scaled > 32767.0f) return 32767;
+    if (scaled < -32768.0f) return -32768;
+    return static_cast<int16_t>(scaled);
+}
+
+CutRecorder& CutRecorder::Instance() {
+    static CutRecorder inst;
+    return inst;
+}
+
+void CutRecorder::beginCut(float startPos, float targetPos, float maxFeedRate) {
+    if (!CUT_RECORDER_ENABLED) return;
+
+    _cutActive = true;
+    if (_frozen) {
+        // Previous capture hasn't reached the card yet - keep it
+        _skippedCuts++;
+        LOG_WARN(Feed, "[CutRecorder] Previous capture still flushing, not recording this cut");
+        return;
+    }
+
+    _total = 0;
+    _trigger = Trigger::None;
+    _triggerSeq = 0;
+    _nextSampleUs = ClearCore::TimingMgr.Microseconds();
+
+    memset(&_header, 0, sizeof(_header));
+    memcpy(_header.magic, "ACUT", 4);
+    _header.version = FORMAT_VERSION;
+    _header.sampleBytes = sizeof(Sample);
+    _header.samplePeriodUs = CUT_RECORDER_PERIOD_US;
+    _header.cutStartMs = ClearCore::TimingMgr.Milliseconds();
+    _header.startPos = startPos;
+    _header.targetPos = targetPos;
+    _header.maxFeedRate = maxFeedRate;
+
+    _recording = true;
+}
+
+void CutRecorder::sample(float yPos, float torque, float smoothedTorque, float torqueTarget, float feedRate) {
+    if (!_recording) return;
+
+    // Fixed rate off the microsecond clock; resync rather than burst after a stall
+    uint32_t nowUs = ClearCore::TimingMgr.Microseconds();
+    if (static_cast<int32_t>(nowUs - _nextSampleUs) < 0) return;
+    _nextSampleUs += CUT_RECORDER_PERIOD_US;
+    if (static_cast<int32_t>(nowUs - _nextSampleUs) >= 0) {
+        _nextSampleUs = nowUs + CUT_RECORDER_PERIOD_US;
+    }
+
+    float spindleLoad = 0.0f;
+    if (MOTOR_SPINDLE.HlfbState() == MotorDriver::HLFB_HAS_MEASUREMENT) {
+        spindleLoad = MOTOR_SPINDLE.HlfbPercent();
+    }
+
+    Sample& s = _ring[_total & RING_MASK];
+    s.yPos = static_cast<int32_t>(yPos * 100000.0f);
+    s.torque = toCenti(torque);
+    s.smoothedTorque = toCenti(smoothedTorque);
+    s.torqueTarget = toCenti(torqueTarget);
+    s.feedRate = static_cast<uint16_t>(feedRate * 10000.0f);
+    s.spindleLoad = toCenti(spindleLoad);
+    s.flags = 0;
+    _total++;
+
+    if (_trigger == Trigger::None) {
+        if (torque > torqueTarget + CUT_RECORDER_SPIKE_MARGIN) {
+            trigger(Trigger::TorqueSpike);
+        }
+    }
+    else if (_total - _triggerSeq > CUT_RECORDER_POST_SAMPLES) {
+        freeze();
+    }
+}
+
+void CutRecorder::trigger(Trigger reason) {
+    if (!_recording || _trigger != Trigger::None) return;
+
+    _trigger = reason;
+    _triggerSeq = _total ? _total - 1 : 0;
+    if (_total) {
+        _ring[_triggerSeq & RING_MASK].flags |= FLAG_TRIGGER;
+    }
+    LOG_INFO(Feed, "[CutRecorder] Triggered by ", triggerName(reason), " at sample ", _triggerSeq);
+}
+
+void CutRecorder::endCut() {
+    _cutActive = false;
+    if (!_recording) return;
+
+    _recording = false;
+    if (_trigger != Trigger::None) {
+        // Cut ended before the post-trigger tail filled - keep what we have
+        freeze();
+    }
+}
+
+void CutRecorder::freeze() {
+    _recording = false;
+    if (_total == 0) return;
+
+    _frozenCount = _total < RING_SAMPLES ? _total : RING_SAMPLES;
+    uint32_t oldest = _total - _frozenCount;
+    _header.sampleCount = _frozenCount;
+    _header.triggerIndex = _triggerSeq >= oldest ? _triggerSeq - oldest : 0;
+    _header.reason = static_cast<uint8_t>(_trigger);
+    _flushPos = 0;
+    _frozen = true;
+    _captures++;
+}
+
+// Look for the next free CUTnnnn.BIN a few names per call, so a card full of
+// captures doesn't stall the loop. True once the search is over: _fileName is
+// free, or there is no card or no number left for openFile() to report.
+bool CutRecorder::findFileName() {
+    if (!_sdReady) {
+        _sdReady = FileManager::Instance().init();
+        if (!_sdReady) return true;
+    }
+
+    for (int i = 0; i < FILE_PROBES_PER_CALL && _fileNumber <= MAX_FILE_NUMBER; i++, _fileNumber++) {
+        snprintf(_fileName, sizeof(_fileName), "/CUT%04u.BIN", static_cast<unsigned>(_fileNumber));
+        if (!SD.exists(_fileName)) return true;
+    }
+    return _fileNumber > MAX_FILE_NUMBER;
+}
+
+bool CutRecorder::openFile() {
+    if (!_sdReady || _fileNumber > MAX_FILE_NUMBER) return false;
+
+    _file = SD.open(_fileName, FILE_WRITE);
+    if (!_file) {
+        // Card may have been swapped; mount again next time
+        _sdReady = false;
+        return false;
+    }
+    _fileNumber++;
+    return _file.write(reinterpret_cast<const uint8_t*>(&_header), sizeof(_header)) == sizeof(_header);
+}
+
+void CutRecorder::update() {
+    // Only between cuts - SD writes can take a few milliseconds
+    if (!_frozen || _cutActive) return;
+
+    if (_flushPos == 0 && !_file) {
+        if (!findFileName()) return;
+        if (!openFile()) {
+            _writeErrors++;
+            if (_file) _file.close();
+            _frozen = false;
+            LOG_ERROR(Feed, "[CutRecorder] Could not write capture to SD");
+            return;
+        }
+    }
+
+    uint32_t oldest = _total - _frozenCount;
+    uint32_t n = _frozenCount - _flushPos;
+    if (n > FLUSH_SAMPLES) n = FLUSH_SAMPLES;
+
+    // Contiguous run up to the ring wrap
+    uint32_t idx = (oldest + _flushPos) & RING_MASK;
+    if (n > RING_SAMPLES - idx) n = RING_SAMPLES - idx;
+
+    size_t bytes = n * sizeof(Sample);
+    if (_file.write(reinterpret_cast<const uint8_t*>(&_ring[idx]), bytes) != bytes) {
+        _writeErrors++;
+        _file.close();
+        _frozen = false;
+        LOG_ERROR(Feed, "[CutRecorder] SD write failed, capture dropped");
+        return;
+    }
+    _flushPos += n;
+
+    if (_flushPos >= _frozenCount) {
+        _file.close();
+        _frozen = false;
+        LOG_INFO(Feed, "[CutRecorder] Saved ", _frozenCount, " samples (", triggerName(_trigger),
+            ") to ", _fileName);
+    }
+}
+
+const char* CutRecorder::triggerName(Trigger reason) {
+    switch (reason) {
+    case Trigger::TorqueSpike: return "torque spike";
+    case Trigger::Abort:       return "abort";
+    case Trigger::FeedHold:    return "feed hold";
+    case Trigger::Manual:      return "manual";
+    default:                   return "none";
+    }
+}
+
+void CutRecorder::logStatus() const {
+    ClearCore::ConnectorUsb.Send("[CutRecorder] ");
+    ClearCore::ConnectorUsb.Send(_recording ? "recording" : _frozen ? "flushing" : "idle");
+    ClearCore::ConnectorUsb.Send(", samples ");
+    ClearCore::ConnectorUsb.Send(_total < RING_SAMPLES ? _total : RING_SAMPLES);
+    ClearCore::ConnectorUsb.Send("/");
+    ClearCore::ConnectorUsb.Send(RING_SAMPLES);
+    ClearCore::ConnectorUsb.Send(", captures ");
+    ClearCore::ConnectorUsb.Send(_captures);
+    ClearCore::ConnectorUsb.Send(", skipped cuts ");
+    ClearCore::ConnectorUsb.Send(_skippedCuts);
+    ClearCore::ConnectorUsb.Send(", write errors ");
+    ClearCore::ConnectorUsb.SendLine(_writeErrors);
+}
+
+static void recCommand(const char* args) {
+    CutRecorder& rec = CutRecorder::Instance();
+    if (strcmp(args, "save") == 0) {
+        // Keep the cut in progress; it's written once the cut ends
+        rec.trigger(CutRecorder::Trigger::Manual);
+    }
+    rec.logStatus();
+}
+
+void CutRecorder::registerCommands() {
+    UsbConsole::Instance().registerCommand("rec", recCommand,
+        "cut recorder status; 'rec save' captures the current cut");
+}
@@ -0,0 +1,114 @@
+// CutRecorder.h
+#pragma once
+
+#include <ClearCore.h>
+#include <SD.h>
+#include "Config.h"
+
+/// Flight recorder for torque-controlled cuts.
+/// While DynamicFeed is Feeding it samples torque, feed rate, Y position and
+/// spindle load at a fixed rate into a RAM ring, so there is always a few
+/// seconds of history. A trigger (torque spike, abort, feed hold) records a
+/// short post-trigger tail and then freezes the ring; update() writes the
+/// frozen capture to the SD card as /CUTnnnn.BIN once the cut is over.
+/// tools/cutrec_to_csv.py converts the files to CSV.
+class CutRecorder {
+public:
+    enum class Trigger : uint8_t {
+        None = 0,
+        TorqueSpike,
+        Abort,
+        FeedHold,
+        Manual
+    };
+
+    /// On-card layout, little-endian. Bump FORMAT_VERSION when it changes.
+    struct FileHeader {
+        char     magic[4];          // "ACUT"
+        uint16_t version;
+        uint16_t sampleBytes;
+        uint32_t samplePeriodUs;
+        uint32_t sampleCount;
+        uint32_t triggerIndex;      // Sample index of the trigger
+        uint32_t cutStartMs;
+        uint8_t  reason;            // Trigger
+        uint8_t  reserved[3];
+        float    startPos;          // inches
+        float    targetPos;         // inches
+        float    maxFeedRate;       // velocity scale 0..1
+    };
+
+    struct Sample {
+        int32_t  yPos;              // 1e-5 inch
+        int16_t  torque;            // HLFB torque, 0.01 %
+        int16_t  smoothedTorque;    // 0.01 %
+        int16_t  torqueTarget;      // 0.01 %
+        uint16_t feedRate;          // Commanded velocity scale, 0.01 %
+        int16_t  spindleLoad;       // Spindle HLFB duty, 0.01 %
+        uint16_t flags;             // FLAG_*
+    };
+
+    static constexpr uint16_t FORMAT_VERSION = 1;
+    static constexpr uint16_t FLAG_TRIGGER = 0x0001;
+
+    static CutRecorder& Instance();
+
+    /// DynamicFeed hooks
+    void beginCut(float startPos, float targetPos, float maxFeedRate);
+    void sample(float yPos, float torque, float smoothedTorque, float torqueTarget, float feedRate);
+    void trigger(Trigger reason);
+    void endCut();
+
+    /// Idle task: writes a frozen capture to SD a block at a time
+    void update();
+
+    bool recording() const { return _recording; }
+    bool pendingFlush() const { return _frozen; }
+
+    void logStatus() const;
+    void registerCommands();
+
+private:
+    CutRecorder() = default;
+    CutRecorder(const CutRecorder&) = delete;
+    CutRecorder& operator=(const CutRecorder&) = delete;
+
+    static constexpr uint32_t RING_SAMPLES = CUT_RECORDER_SAMPLES;
+    static constexpr uint32_t RING_MASK = RING_SAMPLES - 1;
+    static constexpr uint32_t FLUSH_SAMPLES = 512 / sizeof(Sample);    // One SD block per call
+    static constexpr int FILE_PROBES_PER_CALL = 8;      // SD.exists() calls per update()
+    static constexpr uint16_t MAX_FILE_NUMBER = 9999;
+    static_assert((RING_SAMPLES & RING_MASK) == 0, "CUT_RECORDER_SAMPLES must be a power of two");
+    static_assert(sizeof(Sample) == 16, "Sample layout is part of the file format");
+    static_assert(sizeof(FileHeader) == 40, "FileHeader layout is part of the file format");
+
+    void freeze();
+    bool findFileName();
+    bool openFile();
+    static const char* triggerName(Trigger reason);
+
+    Sample _ring[RING_SAMPLES];
+    uint32_t _total = 0;            // Samples taken this cut (free-running)
+    uint32_t _nextSampleUs = 0;
+
+    bool _cutActive = false;
+    bool _recording = false;
+    bool _frozen = false;
+    Trigger _trigger = Trigger::None;
+    uint32_t _triggerSeq = 0;
+
+    FileHeader _header = {};
+    uint32_t _frozenCount = 0;
+
+    // Flush state
+    File _file;
+    uint32_t _flushPos = 0;
+    bool _sdReady = false;
+    uint16_t _fileNumber = 1;
+    char _fileName[16] = "";
+
+    // Stats
+    uint32_t _captures = 0;
+    uint32_t _skippedCuts = 0;
+    uint32_t _writeErrors = 0;
+};
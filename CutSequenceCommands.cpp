@@ -0,0 +1,120 @@
+// CutSequenceCommands.cpp - the "plan" USB console command.
+// Kept apart from CutSequenceController.cpp, which the host sims in
+// tools/cutseq_sim link without the screens; the command edits the cut data
+// the Setup Autocut and AutoCut screens share through ScreenManager.
+#include "CutSequenceController.h"
+#include "MotionController.h"
+#include "screenmanager.h"
+#include "UsbConsole.h"
+#include <ClearCore.h>
+#include <stdlib.h>
+#include <string.h>
+
+//   plan                       show the loaded plan
+//   plan 1.5 3.25:2.1 0.75     plan these fence positions (from the stock
+//                              zero), optional ":<Y cut end>" per cut
+//   plan end 12 1.5 3.25 ...   take the cut nearest X = 12 first
+//   plan clear                 back to the uniform slices from the X screen
+
+static void logPlan(const CutSequenceController& seq, float zero) {
+    const CutPlanner::Plan& plan = seq.getLastPlan();
+    ClearCore::ConnectorUsb.Send("[Plan] ");
+    ClearCore::ConnectorUsb.Send(plan.count);
+    ClearCore::ConnectorUsb.Send(" cuts:");
+    for (int i = 0; i < seq.getTotalCuts(); i++) {
+        ClearCore::ConnectorUsb.Send(' ');
+        ClearCore::ConnectorUsb.Send(seq.getXForIndex(i) - zero, 3);
+    }
+    ClearCore::ConnectorUsb.SendLine();
+    ClearCore::ConnectorUsb.Send("[Plan] fence ");
+    ClearCore::ConnectorUsb.Send(plan.travel, 3);
+    ClearCore::ConnectorUsb.Send(" in, ");
+    ClearCore::ConnectorUsb.Send(plan.reversals);
+    ClearCore::ConnectorUsb.Send(" reversals, ");
+    ClearCore::ConnectorUsb.Send(plan.fenceMs);
+    ClearCore::ConnectorUsb.Send(" ms; as entered ");
+    ClearCore::ConnectorUsb.Send(plan.naiveFenceMs);
+    ClearCore::ConnectorUsb.Send(" ms; saves ");
+    ClearCore::ConnectorUsb.Send(plan.savedMs());
+    ClearCore::ConnectorUsb.SendLine(" ms");
+}
+
+static void planCommand(const char* args) {
+    auto& seq = CutSequenceController::Instance();
+    auto& cutData = ScreenManager::Instance().GetCutData();
+    float zero = cutData.useStockZero ? cutData.positionZero : 0.0f;
+
+    while (*args == ' ') args++;
+    if (*args == '\0') {
+        if (seq.hasPlannedList()) logPlan(seq, zero);
+        else ClearCore::ConnectorUsb.SendLine("[Plan] No planned cut list");
+        return;
+    }
+
+    if (seq.isActive()) {
+        ClearCore::ConnectorUsb.SendLine("[Plan] Not while a sequence runs");
+        return;
+    }
+
+    if (strcmp(args, "clear") == 0) {
+        cutData.numCuts = 0;
+        if (cutData.increment > 0.0f && cutData.totalSlices > 0) {
+            seq.buildXPositions(zero, cutData.increment, cutData.totalSlices);
+        }
+        else {
+            seq.setXIncrements(std::vector<float>());
+        }
+        seq.reset();
+        ClearCore::ConnectorUsb.SendLine("[Plan] Cleared, back to uniform slices");
+        return;
+    }
+
+    CutPlanner::Options options;
+    options.startX = MotionController::Instance().getAbsoluteAxisPosition(AXIS_X);
+
+    char* end;
+    if (strncmp(args, "end ", 4) == 0) {
+        options.constraint = CutPlanner::ORDER_STOCK_END_FIRST;
+        options.stockEndX = zero + strtof(args + 4, &end);
+        if (end == args + 4) {
+            ClearCore::ConnectorUsb.SendLine("[Plan] 'end' needs the stock end X");
+            return;
+        }
+        args = end;
+    }
+
+    int count = 0;
+    while (count < kMaxCuts) {
+        float x = strtof(args, &end);
+        if (end == args) break;
+        args = end;
+        cutData.cutPositions[count] = zero + x;
+        cutData.cutDepths[count] = 0.0f;
+        if (*args == ':') {
+            cutData.cutDepths[count] = strtof(args + 1, &end);
+            if (end == args + 1) break;
+            args = end;
+        }
+        count++;
+    }
+    while (*args == ' ') args++;
+    if (*args != '\0' || count == 0) {
+        ClearCore::ConnectorUsb.Send("[Plan] Expected up to ");
+        ClearCore::ConnectorUsb.Send(kMaxCuts);
+        ClearCore::ConnectorUsb.SendLine(" positions, e.g. 'plan 1.5 3.25:2.1'");
+        return;
+    }
+
+    cutData.numCuts = count;
+    if (!seq.planCutList(cutData, options)) {
+        ClearCore::ConnectorUsb.SendLine("[Plan] Could not plan the list");
+        return;
+    }
+    seq.setBatchSize(count);
+    logPlan(seq, zero);
+}
+
+void CutSequenceController::registerCommands() {
+    UsbConsole::Instance().registerCommand("plan", planCommand,
+        "plan a cut list: 'plan [end <x>] <x>[:<y>] ...', 'plan clear'");
+}
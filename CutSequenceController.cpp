@@ -2,7 +2,9 @@
 #include "CutSequenceController.h"
 #include "MotionController.h"
 #include "CutPositionData.h"
+#include "CycleTimeEstimator.h"
 #include "SettingsManager.h"
+#include "Log.h"
 
 // Avoid min/max macro conflicts with std:: functions
 #undef min
@@ -17,7 +19,8 @@ CutSequenceController& CutSequenceController::Instance() {
     return instance;
 }
 
-CutSequenceController::CutSequenceController() {
+CutSequenceController::CutSequenceController()
+    : _overlap(CUT_SEQ_OVERLAP) {
     // Load saved position state on startup
     loadPositionState();
 }
@@ -25,9 +28,51 @@ CutSequenceController::CutSequenceController() {
 // === EXISTING METHODS (unchanged) ===
 void CutSequenceController::setXIncrements(const std::vector<float>& increments) {
     _xIncrements = increments;
+    _yCutStops.clear();
+    _plan.count = 0;
     _currentIndex = 0;
 }
 
+void CutSequenceController::setCutList(const std::vector<float>& xPositions, const std::vector<float>& yStops) {
+    _xIncrements = xPositions;
+    _yCutStops = yStops;
+    _yCutStops.resize(_xIncrements.size(), _yCutStop);
+    _currentIndex = 0;
+}
+
+float CutSequenceController::getYCutStopFor(int idx) const {
+    if (idx >= 0 && idx < static_cast<int>(_yCutStops.size())) return _yCutStops[idx];
+    return _yCutStop;
+}
+
+bool CutSequenceController::planCutList(const CutData& cutData, const CutPlanner::Options& options) {
+    if (isActive()) {
+        LOG_WARN(Seq, "[CutSeq] Cannot plan - sequence active");
+        return false;
+    }
+
+    static CutPlanner::Cut cuts[kMaxCuts];   // Off the stack
+    int count = cutData.numCuts < kMaxCuts ? cutData.numCuts : kMaxCuts;
+    for (int i = 0; i < count; i++) {
+        cuts[i].x = cutData.cutPositions[i];
+        cuts[i].yStop = cutData.cutDepths[i] > 0.0f ? cutData.cutDepths[i] : cutData.cutEndPoint;
+    }
+    if (!CutPlanner::plan(cuts, count, options, _plan)) return false;
+
+    std::vector<float> xs, ys;
+    xs.reserve(count);
+    ys.reserve(count);
+    for (int i = 0; i < _plan.count; i++) {
+        xs.push_back(cuts[_plan.order[i]].x);
+        ys.push_back(cuts[_plan.order[i]].yStop);
+    }
+    setCutList(xs, ys);
+
+    // A new order invalidates the saved progress
+    clearPositionState();
+    return true;
+}
+
 void CutSequenceController::setYCutStart(float yStart) { _yCutStart = yStart; }
 void CutSequenceController::setYCutStop(float yStop) { _yCutStop = yStop; }
 void CutSequenceController::setYRetract(float yRetract) { _yRetract = yRetract; }
@@ -95,6 +140,8 @@ int CutSequenceController::findClosestIncrementIndex(float x, float tolerance) c
 
 void CutSequenceController::buildXPositions(float stockZero, float increment, int totalSlices) {
     _xIncrements.clear();
+    _yCutStops.clear();
+    _plan.count = 0;
     for (int i = 0; i < totalSlices; ++i) {
         _xIncrements.push_back(stockZero + i * increment);
     }
@@ -103,10 +150,8 @@ void CutSequenceController::buildXPositions(float stockZero, float increment, in
     // When positions are rebuilt, load saved state
     loadPositionState();
 
-    ClearCore::ConnectorUsb.Send("[CutSeq] Built ");
-    ClearCore::ConnectorUsb.Send(totalSlices);
-    ClearCore::ConnectorUsb.Send(" positions, last completed: ");
-    ClearCore::ConnectorUsb.SendLine(_lastCompletedPosition);
+    LOG_INFO(Seq, "[CutSeq] Built ", totalSlices, " positions, last completed: ",
+        _lastCompletedPosition);
 }
 
 int CutSequenceController::getClosestIndexForPosition(float x, float tolerance) const {
@@ -154,8 +199,7 @@ void CutSequenceController::setBatchSize(int size) {
     _batchSize = (size > maxSize) ? maxSize : size;
     _batchSize = (_batchSize < 1) ? 1 : _batchSize;
 
-    ClearCore::ConnectorUsb.Send("[CutSeq] Batch size set to: ");
-    ClearCore::ConnectorUsb.SendLine(_batchSize);
+    LOG_INFO(Seq, "[CutSeq] Batch size set to: ", _batchSize);
 }
 
 int CutSequenceController::getRemainingPositions() const {
@@ -170,8 +214,7 @@ int CutSequenceController::getMaxBatchSize() const {
 void CutSequenceController::savePositionState() {
     // Save to EEPROM or persistent storage
     // For now, just log - implement actual EEPROM saving based on your hardware
-    ClearCore::ConnectorUsb.Send("[CutSeq] Saving position state: ");
-    ClearCore::ConnectorUsb.SendLine(_lastCompletedPosition);
+    LOG_INFO(Seq, "[CutSeq] Saving position state: ", _lastCompletedPosition);
 
     // Example EEPROM save (pseudo-code):
     // EEPROM.write(POSITION_STATE_ADDR, POSITION_STATE_KEY);
@@ -188,8 +231,7 @@ void CutSequenceController::loadPositionState() {
     //     _lastCompletedPosition = EEPROM.read(POSITION_STATE_ADDR + 4);
     // }
 
-    ClearCore::ConnectorUsb.Send("[CutSeq] Loaded position state: ");
-    ClearCore::ConnectorUsb.SendLine(_lastCompletedPosition);
+    LOG_INFO(Seq, "[CutSeq] Loaded position state: ", _lastCompletedPosition);
 }
 
 void CutSequenceController::clearPositionState() {
@@ -199,17 +241,17 @@ void CutSequenceController::clearPositionState() {
 
 bool CutSequenceController::startBatchSequence() {
     if (_state != SEQUENCE_IDLE) {
-        ClearCore::ConnectorUsb.SendLine("[CutSeq] Cannot start - already active");
+        LOG_WARN(Seq, "[CutSeq] Cannot start - already active");
         return false;
     }
 
     if (_xIncrements.empty() || _batchSize <= 0) {
-        ClearCore::ConnectorUsb.SendLine("[CutSeq] Cannot start - no positions or invalid batch size");
+        LOG_WARN(Seq, "[CutSeq] Cannot start - no positions or invalid batch size");
         return false;
     }
 
     if (_lastCompletedPosition >= _xIncrements.size()) {
-        ClearCore::ConnectorUsb.SendLine("[CutSeq] Cannot start - all positions completed");
+        LOG_WARN(Seq, "[CutSeq] Cannot start - all positions completed");
         return false;
     }
 
@@ -217,15 +259,18 @@ bool CutSequenceController::startBatchSequence() {
     _batchStartPosition = _lastCompletedPosition;
     _batchCompletedCount = 0;
     _currentIndex = _batchStartPosition;
+    _yRetractId = _xIndexId = _yApproachId = 0;
+    _timing.valid = false;
+    _lastSavedMs = 0;
+    _batchSavedMs = 0;
 
     // Start sequence
     _state = SEQUENCE_MOVING_TO_RETRACT;
+    CycleTimeEstimator::Instance().beginBatch();
 
-    ClearCore::ConnectorUsb.Send("[CutSeq] Starting batch from position ");
-    ClearCore::ConnectorUsb.Send(_batchStartPosition + 1); // 1-based for display
-    ClearCore::ConnectorUsb.Send(" with ");
-    ClearCore::ConnectorUsb.Send(_batchSize);
-    ClearCore::ConnectorUsb.SendLine(" cuts");
+    // Position is 1-based for display
+    LOG_INFO(Seq, "[CutSeq] Starting batch from position ", _batchStartPosition + 1,
+        " with ", _batchSize, " cuts");
 
     return true;
 }
@@ -241,22 +286,26 @@ void CutSequenceController::update() {
     _currentXPosition = motion.getAbsoluteAxisPosition(AXIS_X);
     float currentY = motion.getAbsoluteAxisPosition(AXIS_Y);
 
+    if (_overlap) {
+        noteSegmentsDone(ClearCore::TimingMgr.Milliseconds());
+    }
+
     // State machine
     switch (_state) {
     case SEQUENCE_MOVING_TO_RETRACT:
-        updateMovingToRetract();
+        _overlap ? updateMovingToRetractOverlapped() : updateMovingToRetract();
         break;
     case SEQUENCE_MOVING_TO_X:
-        updateMovingToX();
+        _overlap ? updateMovingToXOverlapped() : updateMovingToX();
         break;
     case SEQUENCE_MOVING_TO_START:
-        updateMovingToStart();
+        _overlap ? updateMovingToStartOverlapped() : updateMovingToStart();
         break;
     case SEQUENCE_CUTTING:
         updateCutting();
         break;
     case SEQUENCE_RETRACTING:
-        updateRetracting();
+        _overlap ? updateRetractingOverlapped() : updateRetracting();
         break;
     default:
         break;
@@ -270,7 +319,7 @@ void CutSequenceController::updateMovingToRetract() {
     // Check if already at retract position
     if (isAtPosition(_yRetract, currentY)) {
         _state = SEQUENCE_MOVING_TO_X;
-        ClearCore::ConnectorUsb.SendLine("[CutSeq] Already at retract height");
+        LOG_INFO(Seq, "[CutSeq] Already at retract height");
         return;
     }
 
@@ -283,7 +332,7 @@ void CutSequenceController::updateMovingToRetract() {
     // Check if reached retract position
     if (isAtPosition(_yRetract, currentY)) {
         _state = SEQUENCE_MOVING_TO_X;
-        ClearCore::ConnectorUsb.SendLine("[CutSeq] At retract height");
+        LOG_INFO(Seq, "[CutSeq] At retract height");
     }
 }
 
@@ -303,8 +352,7 @@ void CutSequenceController::updateMovingToX() {
     // Check if at X position
     if (isAtPosition(targetX, _currentXPosition)) {
         _state = SEQUENCE_MOVING_TO_START;
-        ClearCore::ConnectorUsb.Send("[CutSeq] At X position ");
-        ClearCore::ConnectorUsb.SendLine(targetX);
+        LOG_INFO(Seq, "[CutSeq] At X position ", targetX);
     }
 }
 
@@ -320,19 +368,23 @@ void CutSequenceController::updateMovingToStart() {
 
     // Check if at start position
     if (isAtPosition(_yCutStart, currentY)) {
-        _state = SEQUENCE_CUTTING;
+        startCut();
+    }
+}
 
-        // Start torque-controlled feed
-        auto& posData = CutPositionData::Instance();
-        float cutPressure = 70.0f;  // Should get from settings
-        float feedRate = 0.5f;      // Should get from settings
+void CutSequenceController::startCut() {
+    auto& motion = MotionController::Instance();
+    _state = SEQUENCE_CUTTING;
 
-        motion.setTorqueTarget(AXIS_Y, cutPressure);
-        motion.startTorqueControlledFeed(AXIS_Y, _yCutStop, feedRate);
+    // Start torque-controlled feed
+    float cutPressure = 70.0f;  // Should get from settings
+    float feedRate = 0.5f;      // Should get from settings
 
-        ClearCore::ConnectorUsb.Send("[CutSeq] Starting cut at position ");
-        ClearCore::ConnectorUsb.SendLine(_currentIndex + 1); // 1-based for display
-    }
+    motion.setTorqueTarget(AXIS_Y, cutPressure);
+    motion.startTorqueControlledFeed(AXIS_Y, getYCutStopFor(_currentIndex), feedRate);
+    CycleTimeEstimator::Instance().cutStarted(_currentIndex);
+
+    LOG_INFO(Seq, "[CutSeq] Starting cut at position ", _currentIndex + 1); // 1-based for display
 }
 
 void CutSequenceController::updateCutting() {
@@ -340,15 +392,16 @@ void CutSequenceController::updateCutting() {
     float currentY = motion.getAbsoluteAxisPosition(AXIS_Y);
 
     // Check if cut is complete
-    if (!motion.isInTorqueControlledFeed(AXIS_Y) && isAtPosition(_yCutStop, currentY)) {
+    if (!motion.isInTorqueControlledFeed(AXIS_Y) && isAtPosition(getYCutStopFor(_currentIndex), currentY)) {
         // Mark this position as completed
         _batchCompletedCount++;
         _lastCompletedPosition = _currentIndex + 1; // Store as 1-based
         savePositionState();
+        CycleTimeEstimator::Instance().cutFinished(_currentIndex);
 
+        _yRetractId = 0;
         _state = SEQUENCE_RETRACTING;
-        ClearCore::ConnectorUsb.Send("[CutSeq] Cut completed at position ");
-        ClearCore::ConnectorUsb.SendLine(_lastCompletedPosition);
+        LOG_INFO(Seq, "[CutSeq] Cut completed at position ", _lastCompletedPosition);
     }
 }
 
@@ -372,16 +425,17 @@ void CutSequenceController::moveToNextBatchCut() {
     // Check if batch is complete
     if (_batchCompletedCount >= _batchSize || _currentIndex + 1 >= _xIncrements.size()) {
         _state = SEQUENCE_COMPLETED;
-        ClearCore::ConnectorUsb.Send("[CutSeq] Batch completed! Cut ");
-        ClearCore::ConnectorUsb.Send(_batchCompletedCount);
-        ClearCore::ConnectorUsb.SendLine(" positions");
+        LOG_INFO(Seq, "[CutSeq] Batch completed! Cut ", _batchCompletedCount, " positions");
+        CycleTimeEstimator::Instance().batchFinished();
+        if (_overlap) {
+            LOG_INFO(Seq, "[CutSeq] Overlapped indexing saved ", _batchSavedMs, " ms this batch");
+        }
     }
     else {
         // Move to next cut in batch
         _currentIndex++;
         _state = SEQUENCE_MOVING_TO_X;
-        ClearCore::ConnectorUsb.Send("[CutSeq] Moving to next cut: position ");
-        ClearCore::ConnectorUsb.SendLine(_currentIndex + 1);
+        LOG_INFO(Seq, "[CutSeq] Moving to next cut: position ", _currentIndex + 1);
     }
 }
 
@@ -395,8 +449,17 @@ void CutSequenceController::pause() {
         if (motion.isInTorqueControlledFeed(AXIS_Y)) {
             motion.pauseTorqueControlledFeed(AXIS_Y);
         }
+        else {
+            // Queued segments would keep issuing from the axis update
+            motion.stopAxis(AXIS_X);
+            motion.stopAxis(AXIS_Y);
+        }
+
+        // A paused cut says nothing about overlap savings or cycle time
+        _timing.valid = false;
+        CycleTimeEstimator::Instance().invalidateCut();
 
-        ClearCore::ConnectorUsb.SendLine("[CutSeq] Paused");
+        LOG_INFO(Seq, "[CutSeq] Paused");
     }
 }
 
@@ -408,8 +471,16 @@ void CutSequenceController::resume() {
         if (_state == SEQUENCE_CUTTING) {
             motion.resumeTorqueControlledFeed(AXIS_Y);
         }
+        else if (_overlap) {
+            // Pause stopped and cleared every move: issue them again. The
+            // approach waits on X, so a stopped approach goes back to X.
+            _yRetractId = _xIndexId = _yApproachId = 0;
+            if (_state == SEQUENCE_MOVING_TO_START) {
+                _state = SEQUENCE_MOVING_TO_X;
+            }
+        }
 
-        ClearCore::ConnectorUsb.SendLine("[CutSeq] Resumed");
+        LOG_INFO(Seq, "[CutSeq] Resumed");
     }
 }
 
@@ -419,7 +490,12 @@ void CutSequenceController::abort() {
     auto& motion = MotionController::Instance();
     motion.abortTorqueControlledFeed(AXIS_Y);
 
-    ClearCore::ConnectorUsb.SendLine("[CutSeq] Aborted");
+    // Moves already running finish; queued ones never start
+    motion.clearQueue(AXIS_X);
+    motion.clearQueue(AXIS_Y);
+    CycleTimeEstimator::Instance().batchStopped();
+
+    LOG_INFO(Seq, "[CutSeq] Aborted");
 }
 
 bool CutSequenceController::isActive() const {
@@ -443,4 +519,156 @@ float CutSequenceController::getBatchTargetX(int batchPosition) const {
 
 bool CutSequenceController::isAtPosition(float target, float current, float tolerance) {
     return fabs(target - current) <= tolerance;
-}
\ No newline at end of file
+}
+
+// === OVERLAPPED SEQUENCING ===
+//
+// The strict sequence waits for each axis before moving the next: retract Y,
+// then index X, then approach with Y. Overlapped, each move is queued as soon
+// as it is safe:
+//   - X indexes once Y is back past the blade-clearance point, while Y is
+//     still travelling to retract;
+//   - the Y approach is queued once X is inside CUT_SEQ_X_ENVELOPE of its
+//     target, and starts as soon as the retract ends;
+//   - the feed still waits for both axes to stop on target.
+// The approach only brings the stock up to the cut start, so it never meets
+// the blade while X is settling.
+
+void CutSequenceController::setOverlapMode(bool enabled) {
+    if (isActive()) {
+        LOG_WARN(Seq, "[CutSeq] Overlap mode can't change while a sequence runs");
+        return;
+    }
+    _overlap = enabled;
+    LOG_INFO(Seq, "[CutSeq] Overlapped indexing ", enabled ? "on" : "off");
+}
+
+float CutSequenceController::getBladeClearanceY() const {
+    // Retract is behind the cut start; a retract shorter than the margin
+    // means X waits for the full retract
+    float clear = _yCutStart - CUT_SEQ_BLADE_CLEARANCE;
+    return clear < _yRetract ? _yRetract : clear;
+}
+
+uint16_t CutSequenceController::enqueueOrAbort(AxisId axis, float position) {
+    uint16_t id = MotionController::Instance().enqueueMove(axis, position, 1.0f, false);
+    if (!id) {
+        LOG_ERROR(Seq, "[CutSeq] Move to ", position, " refused on axis ", static_cast<int>(axis));
+        abort();
+    }
+    return id;
+}
+
+void CutSequenceController::noteSegmentsDone(uint32_t now) {
+    if (!_timing.valid) return;
+    auto& motion = MotionController::Instance();
+    if (!_timing.retractDone && _yRetractId && motion.isSegmentDone(AXIS_Y, _yRetractId))
+        _timing.retractDone = now;
+    if (!_timing.xDone && _xIndexId && motion.isSegmentDone(AXIS_X, _xIndexId))
+        _timing.xDone = now;
+    if (!_timing.approachDone && _yApproachId && motion.isSegmentDone(AXIS_Y, _yApproachId))
+        _timing.approachDone = now;
+}
+
+void CutSequenceController::updateMovingToRetractOverlapped() {
+    auto& motion = MotionController::Instance();
+    float currentY = motion.getAbsoluteAxisPosition(AXIS_Y);
+
+    // First cut: Y starts wherever it was left, so nothing to compare against
+    if (!_yRetractId) {
+        _timing.valid = false;
+        _yRetractId = enqueueOrAbort(AXIS_Y, _yRetract);
+        if (!_yRetractId) return;
+        _targetY = _yRetract;
+    }
+
+    if (currentY <= getBladeClearanceY()) {
+        _xIndexId = 0;
+        _state = SEQUENCE_MOVING_TO_X;
+        LOG_INFO(Seq, "[CutSeq] Blade clear, indexing X");
+        updateMovingToXOverlapped();
+    }
+}
+
+void CutSequenceController::updateRetractingOverlapped() {
+    auto& motion = MotionController::Instance();
+    float currentY = motion.getAbsoluteAxisPosition(AXIS_Y);
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+
+    if (!_yRetractId) {
+        _yRetractId = enqueueOrAbort(AXIS_Y, _yRetract);
+        if (!_yRetractId) return;
+        _targetY = _yRetract;
+        _timing = IndexTiming();
+        _timing.valid = true;
+        _timing.retractStart = now;
+    }
+
+    if (currentY > getBladeClearanceY()) return;
+
+    bool batchDone = _batchCompletedCount >= _batchSize || _currentIndex + 1 >= _xIncrements.size();
+    if (batchDone) {
+        // Nothing to overlap with: finish the retract
+        if (motion.isSegmentDone(AXIS_Y, _yRetractId)) {
+            moveToNextBatchCut();
+        }
+        return;
+    }
+
+    _xIndexId = 0;
+    moveToNextBatchCut();
+    updateMovingToXOverlapped();
+}
+
+void CutSequenceController::updateMovingToXOverlapped() {
+    auto& motion = MotionController::Instance();
+    if (_currentIndex >= _xIncrements.size()) return;
+    float targetX = _xIncrements[_currentIndex];
+
+    if (!_xIndexId) {
+        _xIndexId = enqueueOrAbort(AXIS_X, targetX);
+        if (!_xIndexId) return;
+        _targetX = targetX;
+        _timing.xStart = ClearCore::TimingMgr.Milliseconds();
+    }
+
+    // Close enough that the approach can't outrun it: queue the approach
+    if (std::fabs(targetX - motion.getAbsoluteAxisPosition(AXIS_X)) <= CUT_SEQ_X_ENVELOPE) {
+        _yApproachId = enqueueOrAbort(AXIS_Y, _yCutStart);
+        if (!_yApproachId) return;
+        _targetY = _yCutStart;
+        _timing.approachQueued = ClearCore::TimingMgr.Milliseconds();
+        _state = SEQUENCE_MOVING_TO_START;
+        LOG_DEBUG(Seq, "[CutSeq] X inside envelope, Y approach queued");
+    }
+}
+
+void CutSequenceController::updateMovingToStartOverlapped() {
+    auto& motion = MotionController::Instance();
+    if (!motion.isSegmentDone(AXIS_X, _xIndexId) || !motion.isSegmentDone(AXIS_Y, _yApproachId)) return;
+
+    float currentY = motion.getAbsoluteAxisPosition(AXIS_Y);
+    if (!isAtPosition(_targetX, _currentXPosition) || !isAtPosition(_yCutStart, currentY)) return;
+
+    reportIndexTime(ClearCore::TimingMgr.Milliseconds());
+    startCut();
+}
+
+void CutSequenceController::reportIndexTime(uint32_t now) {
+    if (!_timing.valid) return;
+    _timing.valid = false;
+
+    // The same three moves from rest, one after another. The approach can't
+    // start before the retract ends, so it is timed from whichever is later.
+    uint32_t approachStart = _timing.approachQueued > _timing.retractDone
+        ? _timing.approachQueued : _timing.retractDone;
+    uint32_t sequential = (_timing.retractDone - _timing.retractStart)
+        + (_timing.xDone - _timing.xStart)
+        + (_timing.approachDone - approachStart);
+    uint32_t actual = now - _timing.retractStart;
+
+    _lastSavedMs = static_cast<int32_t>(sequential - actual);
+    _batchSavedMs += _lastSavedMs;
+    LOG_INFO(Seq, "[CutSeq] Index to position ", _currentIndex + 1, ": ", actual,
+        " ms, sequential ", sequential, " ms, saved ", _lastSavedMs, " ms");
+}
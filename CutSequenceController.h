@@ -3,6 +3,8 @@
 #include <vector>
 #include <cmath>
 #include <stdint.h>  // Add this include for uint32_t
+#include "MotionController.h"
+#include "CutPlanner.h"
 
 class CutSequenceController {
 public:
@@ -40,6 +42,19 @@ public:
     int getTotalCuts() const;
 
     void buildXPositions(float stockZero, float increment, int totalSlices);
+
+    // Arbitrary cut list: positions in execution order, each with its own
+    // Y stop. buildXPositions and setXIncrements go back to one Y stop.
+    void setCutList(const std::vector<float>& xPositions, const std::vector<float>& yStops);
+    float getYCutStopFor(int idx) const;
+
+    // Plan an order for cutData.cutPositions (CutPlanner) and load it
+    bool planCutList(const CutData& cutData, const CutPlanner::Options& options);
+    const CutPlanner::Plan& getLastPlan() const { return _plan; }
+    // A planned list is loaded; buildXPositions or setXIncrements replaces it
+    bool hasPlannedList() const { return _plan.count > 0; }
+    // "plan" USB console command (CutSequenceCommands.cpp)
+    void registerCommands();
     int getClosestIndexForPosition(float x, float tolerance = 0.005f) const;
 
     // X position tracking and comparison
@@ -83,11 +98,26 @@ public:
     // Get target X for a given batch position (0-based within batch)
     float getBatchTargetX(int batchPosition) const;
 
+    // === OVERLAPPED SEQUENCING ===
+    // Overlap the X index with the Y retract and approach (CUT_SEQ_OVERLAP)
+    void setOverlapMode(bool enabled);
+    bool isOverlapMode() const { return _overlap; }
+
+    // Y at or below this has the blade clear of the stock, so X may index
+    float getBladeClearanceY() const;
+
+    // Time the last index saved over retract, index and approach run one
+    // after another, and the total for this batch (ms; 0 when not measured)
+    int32_t getLastCutTimeSavedMs() const { return _lastSavedMs; }
+    int32_t getBatchTimeSavedMs() const { return _batchSavedMs; }
+
 private:
     CutSequenceController();
 
     // === EXISTING MEMBERS ===
     std::vector<float> _xIncrements;
+    std::vector<float> _yCutStops;   // Per cut, parallel to _xIncrements; empty = _yCutStop
+    CutPlanner::Plan _plan;
     float _yCutStart = 0.0f;
     float _yCutStop = 0.0f;
     float _yRetract = 0.0f;
@@ -108,6 +138,24 @@ private:
     float _targetX = 0.0f;
     float _targetY = 0.0f;
 
+    // Overlapped sequencing: queued segment ids, 0 = not issued yet
+    bool _overlap;
+    uint16_t _yRetractId = 0;
+    uint16_t _xIndexId = 0;
+    uint16_t _yApproachId = 0;
+
+    // When each overlapped move started and finished (ms), to work out
+    // what the same moves would have taken one after another
+    struct IndexTiming {
+        bool valid;
+        uint32_t retractStart, retractDone;
+        uint32_t xStart, xDone;
+        uint32_t approachQueued, approachDone;
+    };
+    IndexTiming _timing = {};
+    int32_t _lastSavedMs = 0;
+    int32_t _batchSavedMs = 0;
+
     // Persistence key for EEPROM - only declare once
     static constexpr uint32_t POSITION_STATE_KEY = 0x50534354; // "PSCT"
 
@@ -118,7 +166,17 @@ private:
     void updateCutting();
     void updateRetracting();
 
+    // Overlapped variants
+    void updateMovingToRetractOverlapped();
+    void updateMovingToXOverlapped();
+    void updateMovingToStartOverlapped();
+    void updateRetractingOverlapped();
+    void noteSegmentsDone(uint32_t now);
+    void reportIndexTime(uint32_t now);
+    uint16_t enqueueOrAbort(AxisId axis, float position);
+
     // Helper methods
     bool isAtPosition(float target, float current, float tolerance = 0.01f);
     void moveToNextBatchCut();
+    void startCut();
 };
\ No newline at end of file
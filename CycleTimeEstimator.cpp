@@ -0,0 +1,245 @@
+// CycleTimeEstimator.cpp
+#include "CycleTimeEstimator.h"
+#include "CutSequenceController.h"
+#include "MotionController.h"
+#include "MoveProfile.h"
+#include "SettingsManager.h"
+#include "UsbConsole.h"
+#include "Config.h"
+#include "Log.h"
+#include <ClearCore.h>
+#include <math.h>
+
+namespace {
+
+    constexpr float FEED_IPS_MIN = 0.01f;
+    constexpr float FEED_IPS_MAX = 5.0f;
+    constexpr float INDEX_SCALE_MIN = 0.5f;
+    constexpr float INDEX_SCALE_MAX = 3.0f;
+
+    uint32_t toMs(float seconds) {
+        return static_cast<uint32_t>(seconds * 1000.0f + 0.5f);
+    }
+
+    float clampf(float v, float lo, float hi) {
+        return v < lo ? lo : v > hi ? hi : v;
+    }
+}
+
+CycleTimeEstimator& CycleTimeEstimator::Instance() {
+    static CycleTimeEstimator instance;
+    return instance;
+}
+
+CycleTimeEstimator::CycleTimeEstimator() {
+    // Settings feed rate is inches/min
+    float ipm = SettingsManager::Instance().settings().feedRate;
+    _feedIps = clampf(ipm / 60.0f, FEED_IPS_MIN, FEED_IPS_MAX);
+}
+
+void CycleTimeEstimator::planBatch() {
+    auto& seq = CutSequenceController::Instance();
+    auto& motion = MotionController::Instance();
+    const MoveProfile::Limits fence = MoveProfile::fence();
+    const MoveProfile::Limits table = MoveProfile::table();
+
+    int start = seq.isActive() ? seq.getCurrentIndex() : seq.getLastCompletedPosition();
+    int count = seq.getTotalCuts() - start;
+    if (count > seq.getBatchSize()) count = seq.getBatchSize();
+
+    float x = motion.getAbsoluteAxisPosition(AXIS_X);
+    float y = motion.getAbsoluteAxisPosition(AXIS_Y);
+    const float yRetract = seq.getYRetract();
+    const float yStart = seq.getYCutStart();
+    const float yClear = seq.getBladeClearanceY();
+    const bool overlap = seq.isOverlapMode();
+
+    _cuts.clear();
+    if (count > 0) _cuts.reserve(count);
+    for (int k = 0; k < count; k++) {
+        CutEstimate c;
+        c.index = start + k;
+        float xCut = seq.getXForIndex(c.index);
+        float yStop = seq.getYCutStopFor(c.index);
+
+        MoveProfile::Profile retract = MoveProfile::plan(y - yRetract, table);
+        MoveProfile::Profile index = MoveProfile::plan(xCut - x, fence);
+        MoveProfile::Profile approach = MoveProfile::plan(yStart - yRetract, table);
+        float tRetract = MoveProfile::seconds(retract);
+        float tIndex = MoveProfile::seconds(index);
+        float tApproach = MoveProfile::seconds(approach);
+        c.retractMs = toMs(tRetract);
+        c.indexMs = toMs(tIndex);
+        c.approachMs = toMs(tApproach);
+
+        if (overlap) {
+            // X starts once Y is past the clearance point; the approach
+            // follows the retract once X is inside the envelope; the feed
+            // waits for both
+            float xStart = y > yClear ? MoveProfile::secondsToCover(retract, y - yClear, table) : 0.0f;
+            float dx = fabsf(xCut - x);
+            float xInEnvelope = xStart + (dx > CUT_SEQ_X_ENVELOPE
+                ? MoveProfile::secondsToCover(index, dx - CUT_SEQ_X_ENVELOPE, fence) : 0.0f);
+            float approachStart = tRetract > xInEnvelope ? tRetract : xInEnvelope;
+            float feedStart = approachStart + tApproach;
+            if (feedStart < xStart + tIndex) feedStart = xStart + tIndex;
+            c.overlapMs = toMs(feedStart);
+        }
+        else {
+            c.overlapMs = c.retractMs + c.indexMs + c.approachMs;
+        }
+
+        c.feedInches = yStop > yStart ? yStop - yStart : 0.0f;
+        _cuts.push_back(c);
+        x = xCut;
+        y = yStop;
+    }
+    _finalRetractMs = count > 0 ? toMs(MoveProfile::seconds(MoveProfile::plan(y - yRetract, table))) : 0;
+}
+
+const CycleTimeEstimator::CutEstimate* CycleTimeEstimator::find(int index) const {
+    for (const CutEstimate& c : _cuts) {
+        if (c.index == index) return &c;
+    }
+    return nullptr;
+}
+
+uint32_t CycleTimeEstimator::predictedCutMs(const CutEstimate& cut) const {
+    return toMs(cut.overlapMs * _indexScale / 1000.0f + cut.feedInches / _feedIps);
+}
+
+uint32_t CycleTimeEstimator::remainingMs() {
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    if (!_active && (_plannedAtMs == 0 || now - _plannedAtMs > 1000)) {
+        planBatch();
+        _plannedAtMs = now ? now : 1;
+    }
+    if (_cuts.empty()) return 0;
+
+    uint32_t total = toMs(_finalRetractMs * _indexScale / 1000.0f);
+    for (size_t i = _active ? _doneInBatch : 0; i < _cuts.size(); i++) {
+        total += predictedCutMs(_cuts[i]);
+    }
+
+    // Take off what the current cut has already used
+    if (_active && _doneInBatch < static_cast<int>(_cuts.size())) {
+        const CutEstimate& cur = _cuts[_doneInBatch];
+        uint32_t indexPart = toMs(cur.overlapMs * _indexScale / 1000.0f);
+        uint32_t feedPart = predictedCutMs(cur) - indexPart;
+        uint32_t elapsed = now - _phaseStartMs;
+        uint32_t used = _feeding
+            ? indexPart + (elapsed < feedPart ? elapsed : feedPart)
+            : (elapsed < indexPart ? elapsed : indexPart);
+        total = total > used ? total - used : 0;
+    }
+    return total;
+}
+
+void CycleTimeEstimator::beginBatch() {
+    planBatch();
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    _active = true;
+    _doneInBatch = 0;
+    _feeding = false;
+    _cutValid = true;
+    _batchStartMs = now;
+    _phaseStartMs = now;
+    _batchPredictedMs = remainingMs();
+    LOG_INFO(Seq, "[CycleTime] Batch of ", static_cast<int>(_cuts.size()), " cuts predicted ",
+        _batchPredictedMs, " ms (feed ", Log::fixed(_feedIps, 3), " in/s, index x",
+        Log::fixed(_indexScale, 2), ")");
+}
+
+void CycleTimeEstimator::cutStarted(int index) {
+    if (!_active) return;
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    const CutEstimate* cut = find(index);
+    if (cut && _cutValid) {
+        uint32_t actual = now - _phaseStartMs;
+        LOG_INFO(Seq, "[CycleTime] Cut ", index + 1, " index ", actual, " ms, predicted ",
+            toMs(cut->overlapMs * _indexScale / 1000.0f));
+        if (cut->overlapMs > 0) {
+            float ratio = static_cast<float>(actual) / cut->overlapMs;
+            _indexScale = clampf(_indexScale + CYCLE_EST_LEARN_RATE * (ratio - _indexScale),
+                INDEX_SCALE_MIN, INDEX_SCALE_MAX);
+        }
+    }
+    _feeding = true;
+    _phaseStartMs = now;
+}
+
+void CycleTimeEstimator::cutFinished(int index) {
+    if (!_active) return;
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    const CutEstimate* cut = find(index);
+    if (cut && _cutValid && _feeding) {
+        uint32_t actual = now - _phaseStartMs;
+        LOG_INFO(Seq, "[CycleTime] Cut ", index + 1, " feed ", actual, " ms, predicted ",
+            toMs(cut->feedInches / _feedIps));
+        if (actual > 0 && cut->feedInches > 0.0f) {
+            float ips = cut->feedInches * 1000.0f / actual;
+            _feedIps = clampf(_feedIps + CYCLE_EST_LEARN_RATE * (ips - _feedIps),
+                FEED_IPS_MIN, FEED_IPS_MAX);
+        }
+    }
+    _doneInBatch++;
+    _feeding = false;
+    _cutValid = true;
+    _phaseStartMs = now;
+}
+
+void CycleTimeEstimator::batchFinished() {
+    if (!_active) return;
+    LOG_INFO(Seq, "[CycleTime] Batch took ", ClearCore::TimingMgr.Milliseconds() - _batchStartMs,
+        " ms, predicted ", _batchPredictedMs, " ms");
+    _active = false;
+    _plannedAtMs = 0;
+}
+
+void CycleTimeEstimator::batchStopped() {
+    _active = false;
+    _plannedAtMs = 0;
+}
+
+void CycleTimeEstimator::invalidateCut() {
+    _cutValid = false;
+}
+
+void CycleTimeEstimator::logBreakdown() const {
+    ClearCore::ConnectorUsb.Send("[Cycle] feed ");
+    ClearCore::ConnectorUsb.Send(_feedIps, 3);
+    ClearCore::ConnectorUsb.Send(" in/s, index scale ");
+    ClearCore::ConnectorUsb.SendLine(_indexScale, 2);
+    ClearCore::ConnectorUsb.SendLine("[Cycle] cut: retract / index / approach / sequenced / feed ms");
+    for (const CutEstimate& c : _cuts) {
+        ClearCore::ConnectorUsb.Send("[Cycle] ");
+        ClearCore::ConnectorUsb.Send(c.index + 1);
+        ClearCore::ConnectorUsb.Send(": ");
+        ClearCore::ConnectorUsb.Send(c.retractMs);
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.Send(c.indexMs);
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.Send(c.approachMs);
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.Send(c.overlapMs);
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.SendLine(toMs(c.feedInches / _feedIps));
+    }
+    ClearCore::ConnectorUsb.Send("[Cycle] final retract ");
+    ClearCore::ConnectorUsb.Send(_finalRetractMs);
+    ClearCore::ConnectorUsb.SendLine(" ms");
+}
+
+static void cycleCommand(const char*) {
+    auto& est = CycleTimeEstimator::Instance();
+    uint32_t remaining = est.remainingMs();
+    est.logBreakdown();
+    ClearCore::ConnectorUsb.Send("[Cycle] remaining ");
+    ClearCore::ConnectorUsb.Send(remaining);
+    ClearCore::ConnectorUsb.SendLine(" ms");
+}
+
+void CycleTimeEstimator::registerCommands() {
+    UsbConsole::Instance().registerCommand("cycle", cycleCommand,
+        "predicted batch time with per-cut breakdown");
+}
@@ -0,0 +1,77 @@
+// CycleTimeEstimator.h
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+/// Predicted and measured time for a cut batch.
+///
+/// Each cut is retract, X index, Y approach, feed, priced with the axes'
+/// move profiles (MoveProfile) from the sequencer's cut list and Y setup.
+/// In overlap mode the index follows CutSequenceController: X starts once Y
+/// passes the blade-clearance point and the approach follows the retract.
+/// The torque-controlled feed has no profile, so it is length over a feed
+/// speed estimate, seeded from Settings::feedRate.
+///
+/// CutSequenceController reports when each cut's feed starts and ends. Every
+/// finished cut is logged against its prediction and nudges two learned
+/// terms by CYCLE_EST_LEARN_RATE: the feed speed, and a scale on the index
+/// moves (settle time, scheduling). Both start over at power-up.
+class CycleTimeEstimator {
+public:
+    static CycleTimeEstimator& Instance();
+
+    struct CutEstimate {
+        int index;              // Into the sequencer's cut list
+        uint32_t retractMs;     // Y back to retract before this cut
+        uint32_t indexMs;       // X from the previous cut
+        uint32_t approachMs;    // Y retract to cut start
+        uint32_t overlapMs;     // Retract, index and approach as sequenced
+        float feedInches;
+    };
+
+    /// Sequencer hooks
+    void beginBatch();
+    void cutStarted(int index);
+    void cutFinished(int index);
+    void batchFinished();
+    void batchStopped();        // Aborted
+    void invalidateCut();       // Paused: don't learn from this cut
+
+    /// Predicted time left in the running batch, or for the next batch when
+    /// idle (replanned at most once a second)
+    uint32_t remainingMs();
+
+    uint32_t predictedCutMs(const CutEstimate& cut) const;
+    float feedSpeed() const { return _feedIps; }     // Inches/s
+    float indexScale() const { return _indexScale; }
+
+    /// Per-cut breakdown over USB
+    void logBreakdown() const;
+
+    /// Hook the "cycle" command into the USB console
+    void registerCommands();
+
+private:
+    CycleTimeEstimator();
+    CycleTimeEstimator(const CycleTimeEstimator&) = delete;
+    CycleTimeEstimator& operator=(const CycleTimeEstimator&) = delete;
+
+    void planBatch();
+    const CutEstimate* find(int index) const;
+
+    std::vector<CutEstimate> _cuts;
+    uint32_t _finalRetractMs = 0;
+
+    float _feedIps;             // Learned feed speed
+    float _indexScale = 1.0f;   // Learned scale on the index moves
+
+    bool _active = false;
+    bool _cutValid = false;
+    int _doneInBatch = 0;       // Cuts of _cuts finished
+    uint32_t _batchStartMs = 0;
+    uint32_t _batchPredictedMs = 0;
+    uint32_t _phaseStartMs = 0; // Index phase or feed start of the current cut
+    bool _feeding = false;
+    uint32_t _plannedAtMs = 0;
+};
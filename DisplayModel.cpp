@@ -0,0 +1,374 @@
+// DisplayModel.cpp
+#include "DisplayModel.h"
+#include "UsbConsole.h"
+#include "LatencyProfiler.h"
+#include "Log.h"
+#include <ClearCore.h>
+#include <string.h>
+
+extern Genie genie;
+
+static const char* const LANE_NAMES[DisplayModel::LANE_COUNT] = {
+    "critical", "form", "button", "numeric", "gauge"
+};
+
+DisplayModel& DisplayModel::Instance() {
+    static DisplayModel inst;
+    return inst;
+}
+
+DisplayModel::DisplayModel() {
+    for (int i = 0; i < LANE_COUNT; i++) {
+        _lanes[i].head = NO_SLOT;
+        _lanes[i].tail = NO_SLOT;
+    }
+}
+
+DisplayModel::Lane DisplayModel::defaultLane(uint8_t object) {
+    switch (object) {
+    case GENIE_OBJ_WINBUTTON:
+    case GENIE_OBJ_ANIBUTTON:
+    case GENIE_OBJ_USERBUTTON:
+    case GENIE_OBJ_LED:
+    case GENIE_OBJ_USER_LED:
+    case GENIE_OBJ_ILED:
+    case GENIE_OBJ_STRINGS:
+        return LANE_BUTTON;
+    case GENIE_OBJ_LED_DIGITS:
+    case GENIE_OBJ_CUSTOM_DIGITS:
+    case GENIE_OBJ_ILED_DIGITS_H:
+    case GENIE_OBJ_ILED_DIGITS_L:
+        return LANE_NUMERIC;
+    default:
+        return LANE_GAUGE;
+    }
+}
+
+uint16_t DisplayModel::find(uint16_t key, bool create) {
+    // Open addressing; fields are never removed, so a free slot ends the probe
+    uint16_t slot = static_cast<uint16_t>((key * 40503u) >> 7) & (SLOTS - 1);
+    for (uint16_t n = 0; n < SLOTS; n++) {
+        Field& f = _fields[slot];
+        if (f.used && f.key == key) return slot;
+        if (!f.used) {
+            if (!create) return NO_SLOT;
+            f.used = 1;
+            f.key = key;
+            f.known = 0;
+            f.dirty = 0;
+            f.burst = 0;
+            f.lane = defaultLane(static_cast<uint8_t>(key >> 8));
+            return slot;
+        }
+        slot = (slot + 1) & (SLOTS - 1);
+    }
+    return NO_SLOT;
+}
+
+void DisplayModel::enqueue(uint16_t slot) {
+    Field& f = _fields[slot];
+    LaneQueue& q = _lanes[queueOf(f)];
+    f.next = NO_SLOT;
+    if (q.tail == NO_SLOT) q.head = slot;
+    else _fields[q.tail].next = slot;
+    q.tail = slot;
+    q.depth++;
+    if (q.depth > q.maxDepth) q.maxDepth = q.depth;
+}
+
+uint16_t DisplayModel::dequeue(Lane lane) {
+    LaneQueue& q = _lanes[lane];
+    uint16_t slot = q.head;
+    if (slot == NO_SLOT) return NO_SLOT;
+    q.head = _fields[slot].next;
+    if (q.head == NO_SLOT) q.tail = NO_SLOT;
+    q.depth--;
+    return slot;
+}
+
+void DisplayModel::requeueFront(uint16_t slot) {
+    LaneQueue& q = _lanes[queueOf(_fields[slot])];
+    _fields[slot].next = q.head;
+    q.head = slot;
+    if (q.tail == NO_SLOT) q.tail = slot;
+    q.depth++;
+}
+
+void DisplayModel::set(uint8_t object, uint8_t index, uint16_t value) {
+    _sets++;
+    uint16_t slot = find(static_cast<uint16_t>(object << 8 | index), true);
+    if (slot == NO_SLOT) {
+        // Table full - write through rather than drop the update
+        _uncached++;
+        genie.WriteObject(object, index, value);
+        return;
+    }
+
+    Field& f = _fields[slot];
+    if (f.dirty) {
+        // Not sent yet; the newest value wins in place
+        f.pending = value;
+        _lanes[queueOf(f)].coalesced++;
+        return;
+    }
+    if (f.known && f.sent == value) {
+        _suppressed++;
+        return;
+    }
+
+    f.pending = value;
+    f.dirty = 1;
+    f.burst = _burstOpen;
+    f.queuedUs = ClearCore::TimingMgr.Microseconds();
+    enqueue(slot);
+}
+
+void DisplayModel::setLane(uint8_t object, uint8_t index, Lane lane) {
+    uint16_t slot = find(static_cast<uint16_t>(object << 8 | index), true);
+    // A field already queued keeps its place; the lane applies from its next change
+    if (slot != NO_SLOT && !_fields[slot].dirty) {
+        _fields[slot].lane = lane;
+    }
+}
+
+void DisplayModel::showForm(uint8_t formId) {
+    invalidate();
+    genie.WriteObject(GENIE_OBJ_FORM, formId, 0);
+
+    // A form shown before the last one finished loading just restarts the clock
+    _burstOpen = true;
+    _ttiPending = true;
+    _ttiArmed = false;
+    _burstForm = formId;
+    _burstStartUs = ClearCore::TimingMgr.Microseconds();
+}
+
+void DisplayModel::endBurst() {
+    _burstOpen = false;
+}
+
+void DisplayModel::noteEvent(const genieFrame& e) {
+    if (e.reportObject.cmd == GENIE_READY) {
+        // Display (re)connected with its objects at their power-up state
+        invalidate();
+        return;
+    }
+    if (e.reportObject.cmd != GENIE_REPORT_EVENT) return;
+    uint16_t slot = find(static_cast<uint16_t>(e.reportObject.object << 8 | e.reportObject.index), false);
+    if (slot != NO_SLOT) {
+        _fields[slot].known = 0;
+    }
+}
+
+void DisplayModel::invalidate() {
+    for (uint16_t i = 0; i < SLOTS; i++) {
+        _fields[i].known = 0;
+    }
+}
+
+int DisplayModel::pickLane(uint32_t nowUs) const {
+    // A lane that has waited too long goes first, lowest lane checked first
+    // since it is the one most likely to be starved
+    for (int i = LANE_COUNT - 1; i > 0; i--) {
+        uint16_t head = _lanes[i].head;
+        if (head != NO_SLOT && nowUs - _fields[head].queuedUs > DISPLAY_LANE_MAX_WAIT_MS * 1000UL) {
+            return i;
+        }
+    }
+    for (int i = 0; i < LANE_COUNT; i++) {
+        if (_lanes[i].head != NO_SLOT) return i;
+    }
+    return -1;
+}
+
+bool DisplayModel::send(Field& f) {
+    // Keep it here while the library's queue is full - it would overwrite its oldest frame
+    if (genie._outgoing_queue.size() >= genie._outgoing_queue.capacity()) return false;
+    if (!genie.WriteObject(static_cast<uint8_t>(f.key >> 8), static_cast<uint8_t>(f.key), f.pending)) {
+        return false;   // Display offline - leave it queued
+    }
+    f.sent = f.pending;
+    f.known = 1;
+    f.dirty = 0;
+    f.burst = 0;
+    return true;
+}
+
+void DisplayModel::sendBurst(uint32_t nowUs) {
+    // The screen is blank until these land, so they go out as fast as the
+    // library will take them rather than at the metered rate
+    LaneQueue& q = _lanes[LANE_FORM];
+    while (q.head != NO_SLOT && genie._outgoing_queue.size() < DISPLAY_FORM_BURST_FRAMES) {
+        uint16_t slot = dequeue(LANE_FORM);
+        Field& f = _fields[slot];
+        if (f.known && f.sent == f.pending) {
+            f.dirty = 0;
+            f.burst = 0;
+            continue;
+        }
+        if (!send(f)) {
+            requeueFront(slot);
+            break;
+        }
+        q.writes++;
+        uint32_t waited = nowUs - f.queuedUs;
+        if (waited > q.worstUs) q.worstUs = waited;
+    }
+}
+
+void DisplayModel::updateInteractive(uint32_t nowUs) {
+    if (!_ttiPending || _burstOpen || _lanes[LANE_FORM].head != NO_SLOT) return;
+
+    if (!_ttiArmed) {
+        // The burst's last frame is the newest in the library, so it is
+        // through once everything pending now has been ACKed
+        _ttiFrames = genie.GetTxFrames() + genie.GetTxPending();
+        _ttiArmed = true;
+    }
+    if (!genie.IsIdle() && static_cast<int32_t>(genie.GetTxFrames() - _ttiFrames) < 0) return;
+
+    _ttiPending = false;
+    uint32_t tti = nowUs - _burstStartUs;
+    if (_burstForm < MAX_FORMS) {
+        FormTiming& t = _forms[_burstForm];
+        t.lastUs = tti;
+        if (tti > t.worstUs) t.worstUs = tti;
+        t.shows++;
+    }
+    LOG_INFO(Genie, "[Display] form ", _burstForm, " interactive in ", tti / 1000, " ms");
+}
+
+void DisplayModel::updateLinkRate() {
+    uint32_t baud = genie.GetBaud();
+    if (baud == 0 || baud == _baud) return;
+    _baud = baud;
+    _frameUs = frameUs(baud);
+    _maxCreditUs = _frameUs * DISPLAY_BURST_FRAMES;
+    if (_creditUs > _maxCreditUs) _creditUs = _maxCreditUs;
+}
+
+void DisplayModel::flush() {
+    LATENCY_PROBE("display");
+    updateLinkRate();
+
+    // Earn link time at the baud rate, up to a short burst
+    uint32_t nowUs = ClearCore::TimingMgr.Microseconds();
+    uint32_t elapsed = nowUs - _lastFlushUs;
+    _lastFlushUs = nowUs;
+    _creditUs = (elapsed >= _maxCreditUs || _creditUs + elapsed >= _maxCreditUs) ?
+        _maxCreditUs : _creditUs + elapsed;
+
+    while (_creditUs >= _frameUs) {
+        int lane = pickLane(nowUs);
+        if (lane < 0) break;
+
+        uint16_t slot = dequeue(static_cast<Lane>(lane));
+        Field& f = _fields[slot];
+        if (f.known && f.sent == f.pending) {
+            // Changed and changed back before it went out
+            f.dirty = 0;
+            f.burst = 0;
+            _suppressed++;
+            continue;
+        }
+        if (!send(f)) {
+            requeueFront(slot);
+            break;
+        }
+
+        LaneQueue& q = _lanes[lane];
+        q.writes++;
+        uint32_t waited = nowUs - f.queuedUs;
+        if (waited > q.worstUs) q.worstUs = waited;
+        _creditUs -= _frameUs;
+    }
+
+    sendBurst(nowUs);
+    updateInteractive(nowUs);
+}
+
+void DisplayModel::resetStats() {
+    for (int i = 0; i < LANE_COUNT; i++) {
+        _lanes[i].maxDepth = _lanes[i].depth;
+        _lanes[i].writes = 0;
+        _lanes[i].coalesced = 0;
+        _lanes[i].worstUs = 0;
+    }
+    _sets = 0;
+    _suppressed = 0;
+    _uncached = 0;
+    for (int i = 0; i < MAX_FORMS; i++) {
+        _forms[i] = FormTiming();
+    }
+    _statsStartMs = ClearCore::TimingMgr.Milliseconds();
+    _statsStartFrames = genie.GetTxFrames();
+}
+
+void DisplayModel::logStats() const {
+    ClearCore::ConnectorUsb.Send("[Display] sets ");
+    ClearCore::ConnectorUsb.Send(_sets);
+    ClearCore::ConnectorUsb.Send(", unchanged ");
+    ClearCore::ConnectorUsb.Send(_suppressed);
+    ClearCore::ConnectorUsb.Send(", uncached ");
+    ClearCore::ConnectorUsb.Send(_uncached);
+    ClearCore::ConnectorUsb.Send(", frame ");
+    ClearCore::ConnectorUsb.Send(_frameUs);
+    ClearCore::ConnectorUsb.SendLine("us");
+
+    // What the link actually delivered - ACKed frames, not what was offered
+    uint32_t elapsedMs = ClearCore::TimingMgr.Milliseconds() - _statsStartMs;
+    uint32_t frames = genie.GetTxFrames() - _statsStartFrames;
+    ClearCore::ConnectorUsb.Send("  link ");
+    ClearCore::ConnectorUsb.Send(_baud);
+    ClearCore::ConnectorUsb.Send(" baud (");
+    ClearCore::ConnectorUsb.Send(genie.GetBaudState() == GENIE_BAUD_ACTIVE ? "negotiated" :
+        genie.GetBaudState() == GENIE_BAUD_FAILED ? "fallback" : "boot rate");
+    ClearCore::ConnectorUsb.Send("), ");
+    ClearCore::ConnectorUsb.Send(static_cast<uint32_t>(elapsedMs ? frames * 1000ULL / elapsedMs : 0));
+    ClearCore::ConnectorUsb.Send(" frames/s achieved, ");
+    ClearCore::ConnectorUsb.Send(1000000UL / _frameUs);
+    ClearCore::ConnectorUsb.Send(" budgeted, ");
+    ClearCore::ConnectorUsb.Send(genie.GetTxTimeouts());
+    ClearCore::ConnectorUsb.SendLine(" ACK timeouts");
+
+    for (int i = 0; i < LANE_COUNT; i++) {
+        const LaneQueue& q = _lanes[i];
+        ClearCore::ConnectorUsb.Send("  ");
+        ClearCore::ConnectorUsb.Send(LANE_NAMES[i]);
+        ClearCore::ConnectorUsb.Send(": depth ");
+        ClearCore::ConnectorUsb.Send(static_cast<uint32_t>(q.depth));
+        ClearCore::ConnectorUsb.Send(" (max ");
+        ClearCore::ConnectorUsb.Send(static_cast<uint32_t>(q.maxDepth));
+        ClearCore::ConnectorUsb.Send("), writes ");
+        ClearCore::ConnectorUsb.Send(q.writes);
+        ClearCore::ConnectorUsb.Send(", coalesced ");
+        ClearCore::ConnectorUsb.Send(q.coalesced);
+        ClearCore::ConnectorUsb.Send(", worst wait ");
+        ClearCore::ConnectorUsb.Send(q.worstUs);
+        ClearCore::ConnectorUsb.SendLine("us");
+    }
+
+    ClearCore::ConnectorUsb.Send("  time to interactive (last/worst ms):");
+    for (uint8_t i = 0; i < MAX_FORMS; i++) {
+        if (!_forms[i].shows) continue;
+        ClearCore::ConnectorUsb.Send(" form ");
+        ClearCore::ConnectorUsb.Send(static_cast<uint32_t>(i));
+        ClearCore::ConnectorUsb.Send(" ");
+        ClearCore::ConnectorUsb.Send(_forms[i].lastUs / 1000);
+        ClearCore::ConnectorUsb.Send("/");
+        ClearCore::ConnectorUsb.Send(_forms[i].worstUs / 1000);
+    }
+    ClearCore::ConnectorUsb.SendLine("");
+}
+
+static void dispCommand(const char* args) {
+    if (strcmp(args, "reset") == 0) {
+        DisplayModel::Instance().resetStats();
+    }
+    DisplayModel::Instance().logStats();
+}
+
+void DisplayModel::registerCommands() {
+    UsbConsole::Instance().registerCommand("disp", dispCommand,
+        "display lane statistics; 'disp reset' clears them");
+}
@@ -0,0 +1,143 @@
+// DisplayModel.h
+#pragma once
+
+#include <stdint.h>
+#include <genieArduinoDEV.h>
+#include "Config.h"
+
+/// Shadow copy of what the Genie display is showing, and the scheduler
+/// that decides what goes down the link next.
+/// Screens stage object values with set(); a value only goes out when it
+/// differs from what the display last got, and a field changed again
+/// before it is sent goes out once with the latest value. Queued fields
+/// wait in one of four priority lanes, so a feed-hold button never waits
+/// behind gauge traffic. flush() meters frames against the baud rate the
+/// link negotiated, serving the highest lane first; a lane whose oldest
+/// field has waited DISPLAY_LANE_MAX_WAIT_MS is served ahead of that so
+/// lower lanes still move during heavy updates.
+/// A form change opens a burst: the new screen's starting values go out
+/// ahead of other traffic and outside the link budget, and the time until
+/// the display has acknowledged all of them is recorded per form.
+class DisplayModel {
+public:
+    enum Lane : uint8_t {
+        LANE_CRITICAL = 0,  // Safety-relevant state (feed hold, cycle stop)
+        LANE_FORM,          // A new form's starting state (burst only)
+        LANE_BUTTON,        // Buttons and LEDs
+        LANE_NUMERIC,       // LED digit readouts
+        LANE_GAUGE,         // Gauges and meters
+        LANE_COUNT
+    };
+
+    static DisplayModel& Instance();
+
+    /// Stage an object value - the display-side equivalent of genie.WriteObject
+    void set(uint8_t object, uint8_t index, uint16_t value);
+
+    /// Override the lane picked from the object type (call at startup)
+    void setLane(uint8_t object, uint8_t index, Lane lane);
+
+    /// Change form now (not metered) and forget the cached values, since
+    /// the new form redraws its objects from its own state. Opens the form's
+    /// burst: fields set() until endBurst() are sent ahead of other lanes.
+    void showForm(uint8_t formId);
+    void endBurst();
+
+    /// The user touched an object, or the display came online; our copy of
+    /// it can't be trusted any more
+    void noteEvent(const genieFrame& e);
+
+    /// Forget every cached value so the next set() of each field is sent
+    void invalidate();
+
+    /// Send queued fields as link time allows - call from the genie task
+    void flush();
+
+    void resetStats();
+    void logStats() const;
+    void registerCommands();
+
+private:
+    DisplayModel();
+    DisplayModel(const DisplayModel&) = delete;
+    DisplayModel& operator=(const DisplayModel&) = delete;
+
+    struct Field {
+        uint16_t key;       // object << 8 | index
+        uint16_t sent;      // Last value written to the display
+        uint16_t pending;   // Latest staged value
+        uint16_t next;      // Lane queue link
+        uint32_t queuedUs;  // When it first went dirty
+        uint8_t  lane : 3;
+        uint8_t  used : 1;
+        uint8_t  known : 1; // `sent` matches the display
+        uint8_t  dirty : 1; // In a lane queue
+        uint8_t  burst : 1; // Queued in LANE_FORM rather than its own lane
+    };
+
+    struct LaneQueue {
+        uint16_t head;
+        uint16_t tail;
+        uint16_t depth;
+        // Stats
+        uint16_t maxDepth;
+        uint32_t writes;
+        uint32_t coalesced;
+        uint32_t worstUs;
+    };
+
+    // Time from form change until the display has ACKed the burst
+    struct FormTiming {
+        uint32_t lastUs;
+        uint32_t worstUs;
+        uint16_t shows;
+    };
+
+    static constexpr uint8_t MAX_FORMS = 16;
+    static constexpr uint16_t SLOTS = DISPLAY_MODEL_SLOTS;
+    static constexpr uint16_t NO_SLOT = 0xFFFF;
+    static_assert((SLOTS & (SLOTS - 1)) == 0, "DISPLAY_MODEL_SLOTS must be a power of two");
+
+    // Link time one write costs: 6-byte frame plus the ACK, 10 bits a byte,
+    // scaled so writes only use DISPLAY_LINK_SHARE_PCT of the link
+    static constexpr uint32_t frameUs(uint32_t baud) {
+        return (6 + 1) * 10 * 1000000UL / baud * 100 / DISPLAY_LINK_SHARE_PCT;
+    }
+
+    static Lane defaultLane(uint8_t object);
+    static Lane queueOf(const Field& f) { return f.burst ? LANE_FORM : static_cast<Lane>(f.lane); }
+    uint16_t find(uint16_t key, bool create);
+    void enqueue(uint16_t slot);
+    uint16_t dequeue(Lane lane);
+    void requeueFront(uint16_t slot);
+    int pickLane(uint32_t nowUs) const;
+    bool send(Field& f);
+    void sendBurst(uint32_t nowUs);
+    void updateInteractive(uint32_t nowUs);
+    void updateLinkRate();
+
+    Field _fields[SLOTS] = {};
+    LaneQueue _lanes[LANE_COUNT] = {};
+
+    uint32_t _baud = GENIE_BAUD;
+    uint32_t _frameUs = frameUs(GENIE_BAUD);
+    uint32_t _maxCreditUs = frameUs(GENIE_BAUD) * DISPLAY_BURST_FRAMES;
+    uint32_t _creditUs = 0;
+    uint32_t _lastFlushUs = 0;
+
+    // Form burst
+    bool _burstOpen = false;
+    bool _ttiPending = false;   // Waiting for the burst to be ACKed
+    bool _ttiArmed = false;     // Burst handed to the library; _ttiFrames is set
+    uint8_t _burstForm = 0;
+    uint32_t _burstStartUs = 0;
+    uint32_t _ttiFrames = 0;    // Library ACK count at which the burst is through
+    FormTiming _forms[MAX_FORMS] = {};
+
+    // Stats
+    uint32_t _sets = 0;
+    uint32_t _suppressed = 0;
+    uint32_t _uncached = 0;
+    uint32_t _statsStartMs = 0;
+    uint32_t _statsStartFrames = 0;
+};
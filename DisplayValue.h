@@ -0,0 +1,118 @@
+// DisplayValue.h
+#pragma once
+
+#include <stdint.h>
+#include "Config.h"
+#include "DisplayModel.h"
+
+/// Numbers on their way to LED digits. The display shows a 16-bit integer and
+/// places the decimal point itself, so every LEDDIGITS object has a fixed
+/// number of decimals set in the display project. That number lives here, in
+/// one table keyed by object, and every screen and the field editor scale
+/// through it - a value shown on two forms can't come out with two scalings,
+/// and no pow()/round() is needed on the UI path.
+///
+///   DisplayValue::show(LEDDIGITS_THICKNESS_F2, cutData.thickness);
+///   DisplayValue::showCount(LEDDIGITS_TOTAL_SLICES_F5, totalSlices);
+///   DisplayValue::showSigned(LEDDIGITS_SAW_POSITION, LED_NEGATIVE_INDICATOR, x);
+namespace DisplayValue {
+
+    /// Decimals per LEDDIGITS object, in Config.h index order
+    constexpr uint8_t DECIMALS[] = {
+        3,  //  0 SAW_POSITION
+        3,  //  1 STOCK_LENGTH
+        3,  //  2 CUT_THICKNESS
+        3,  //  3 INCREMENT
+        0,  //  4 TOTAL_SLICES
+        0,  //  5 SLICE_COUNTER
+        0,  //  6 RPM_DISPLAY
+        2,  //  7 FEED_OVERRIDE
+        1,  //  8 DIAMETER_SETTINGS
+        3,  //  9 THICKNESS_SETTINGS
+        0,  // 10 RPM_SETTINGS
+        1,  // 11 FEEDRATE_SETTINGS
+        1,  // 12 RAPID_SETTINGS
+        2,  // 13 FEED_OVERRIDE_F5
+        0,  // 14 RPM_F5
+        3,  // 15 STOCK_LENGTH_F5
+        3,  // 16 THICKNESS_F5
+        0,  // 17 CUTTING_POSITION_F5
+        3,  // 18 DISTANCE_TO_GO_F5
+        3,  // 19 STOCK_END_Y
+        3,  // 20 TABLE_POSITION_Y
+        3,  // 21 CUT_LENGTH_Y
+        3,  // 22 CUT_STOP_Y
+        0,  // 23 MANUAL_RPM
+        0,  // 24 ROTARY_RPM
+        3,  // 25 RETRACT_DISTANCE
+        0,  // 26 CUT_PRESSURE_SETTINGS
+        1,  // 27 CUT_PRESSURE
+        3,  // 28 THICKNESS_F2
+        3,  // 29 DISTANCE_TO_GO_F2
+        1,  // 30 CUT_PRESSURE_F5
+        0,  // 31 TOTAL_SLICES_F5
+        2,  // 32 TARGET_FEEDRATE
+        0,  // 33 TOTAL_POSITIONS_F9
+        0,  // 34 START_POSITION_F9
+        3,  // 35 THICKNESS_F9
+        3,  // 36 STOCK_LENGTH_F9
+        0,  // 37 SLICES_TO_CUT_F9
+        0,  // 38 JOB_REMAINING_F5
+    };
+    constexpr uint8_t DECIMALS_COUNT = sizeof(DECIMALS) / sizeof(DECIMALS[0]);
+    static_assert(DECIMALS_COUNT == LEDDIGITS_JOB_REMAINING_F5 + 1,
+        "DisplayValue::DECIMALS needs an entry for every LEDDIGITS object");
+
+    constexpr int32_t SCALE[] = { 1, 10, 100, 1000 };
+
+    /// Largest value one LED digits write can carry
+    constexpr int32_t DIGITS_MAX = 0xFFFF;
+
+    constexpr uint8_t decimalsOf(uint8_t led) {
+        return led < DECIMALS_COUNT ? DECIMALS[led] : 0;
+    }
+
+    constexpr int32_t scaleOf(uint8_t led) {
+        return SCALE[decimalsOf(led)];
+    }
+
+    /// Clamp a scaled value into what the digits can show
+    constexpr uint16_t toDigits(int32_t scaled) {
+        return scaled < 0 ? 0
+            : scaled > DIGITS_MAX ? static_cast<uint16_t>(DIGITS_MAX)
+            : static_cast<uint16_t>(scaled);
+    }
+
+    /// Value in the LED's fixed-point units, rounded half away from zero
+    inline int32_t toScaled(float value, uint8_t led) {
+        float s = value * scaleOf(led);
+        if (s > 1.0e9f) s = 1.0e9f;
+        else if (s < -1.0e9f) s = -1.0e9f;
+        return static_cast<int32_t>(s < 0.0f ? s - 0.5f : s + 0.5f);
+    }
+
+    inline float fromScaled(int32_t scaled, uint8_t led) {
+        return static_cast<float>(scaled) / scaleOf(led);
+    }
+
+    /// Write a value already in the LED's units; negatives show as 0
+    inline void showScaled(uint8_t led, int32_t scaled) {
+        DisplayModel::Instance().set(GENIE_OBJ_LED_DIGITS, led, toDigits(scaled));
+    }
+
+    inline void show(uint8_t led, float value) {
+        showScaled(led, toScaled(value, led));
+    }
+
+    /// Whole numbers - slices, positions, RPM
+    inline void showCount(uint8_t led, int32_t count) {
+        showScaled(led, count * scaleOf(led));
+    }
+
+    /// Show the magnitude and light negativeLed when the value is below zero
+    inline void showSigned(uint8_t led, uint8_t negativeLed, float value) {
+        int32_t scaled = toScaled(value, led);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, negativeLed, scaled < 0 ? 1 : 0);
+        showScaled(led, scaled < 0 ? -scaled : scaled);
+    }
+}
@@ -1,6 +1,11 @@
 #include "DynamicFeed.h"
 #include "YAxis.h"
 #include "Config.h"
+#include "LoopWatchdog.h"
+#include "BinLog.h"
+#include "CutRecorder.h"
+#include "MotionController.h"
+#include "SettingsManager.h"
 #include <ClearCore.h>
 
 static constexpr float MAX_VELOCITY = 10000.0f;  // steps/s
@@ -23,8 +28,7 @@ void DynamicFeed::setAccelerationFactor(float factor) {
     _accelFactor = (factor < 0.2f) ? 0.2f :
         (factor > 2.0f) ? 2.0f : factor;
 
-    ClearCore::ConnectorUsb.Send("[DynamicFeed] Acceleration factor set to: ");
-    ClearCore::ConnectorUsb.SendLine(_accelFactor);
+    BINLOG(FEED_ACCEL_FACTOR, _accelFactor);
 }
 
 float DynamicFeed::getAccelerationFactor() const {
@@ -37,11 +41,7 @@ void DynamicFeed::setRampingParameters(float startRampTime, float endRampTime) {
     _endRampDuration = (endRampTime < 0.1f) ? 0.1f :
         (endRampTime > 1.0f) ? 1.0f : endRampTime;
 
-    ClearCore::ConnectorUsb.Send("[DynamicFeed] Ramping parameters set: start=");
-    ClearCore::ConnectorUsb.Send(_startRampDuration);
-    ClearCore::ConnectorUsb.Send("s, end=");
-    ClearCore::ConnectorUsb.Send(_endRampDuration);
-    ClearCore::ConnectorUsb.SendLine("s");
+    BINLOG(FEED_RAMP_PARAMS, _startRampDuration, _endRampDuration);
 }
 
 void DynamicFeed::configureAccelerationProfile(float startRatio, float endRatio) {
@@ -53,13 +53,13 @@ void DynamicFeed::configureAccelerationProfile(float startRatio, float endRatio)
 
 bool DynamicFeed::start(float targetPosition, float initialVelocityScale) {
     if (!_motor) {
-        ClearCore::ConnectorUsb.SendLine("[DynamicFeed] Cannot start: no motor available");
+        BINLOG(FEED_NO_MOTOR);
         return false;
     }
 
     float desired = targetPosition;
     if (desired < 0.0f || desired > MAX_Y_INCHES) {
-        ClearCore::ConnectorUsb.SendLine("[DynamicFeed] Target out of bounds");
+        BINLOG(FEED_TARGET_OOB);
         return false;
     }
 
@@ -73,13 +73,18 @@ bool DynamicFeed::start(float targetPosition, float initialVelocityScale) {
 
     // Start with lower initial feed rate for gradual ramp-up
     _currentFeedRate = min(0.15f * _maxFeedRate, _maxFeedRate);
-    _torqueErrorAccumulator = 0.0f;
-    _lastTorqueUpdateTime = ClearCore::TimingMgr.Milliseconds();
-    _rampStartTime = _lastTorqueUpdateTime;
+    scheduleGains();
+    restartLaw();
+    _rampStartTime = ClearCore::TimingMgr.Milliseconds();
+    _feedAccelRestored = false;
 
     // Store original acceleration value
     _originalAccelValue = MAX_ACCELERATION; // Using our defined constant
 
+    // This start sets its own acceleration, so drop any pending restore
+    _accelRestorePending = false;
+    _rampStep = 0;
+
     // Start velocity move in the correct direction
     float direction = (_targetPos > _startPos) ? 1.0f : -1.0f;
     _feedDirection = direction;
@@ -89,82 +94,107 @@ bool DynamicFeed::start(float targetPosition, float initialVelocityScale) {
     _motor->VelMax(static_cast<uint32_t>(MAX_VELOCITY * _maxFeedRate));
 
     // Reduce acceleration rate for smoother starts
-    _motor->AccelMax(static_cast<uint32_t>(_originalAccelValue * _accelFactor * _startAccelRatio));
+    _feedAccel = static_cast<uint32_t>(_originalAccelValue * _accelFactor * _startAccelRatio);
+    _motor->AccelMax(_feedAccel);
 
     // Start with reduced speed for initial ramp-up
     _motor->MoveVelocity(static_cast<int32_t>(direction * _currentFeedRate * _stepsPerInch));
 
-    ClearCore::ConnectorUsb.Send("[DynamicFeed] Starting torque-controlled feed to ");
-    ClearCore::ConnectorUsb.Send(_targetPos);
-    ClearCore::ConnectorUsb.Send(" inches with gentle ramp-up at ");
-    ClearCore::ConnectorUsb.Send(_currentFeedRate * 100.0f, 0);
-    ClearCore::ConnectorUsb.Send("% initial speed, target torque: ");
-    ClearCore::ConnectorUsb.Send(_torqueTarget, 1);
-    ClearCore::ConnectorUsb.SendLine("%");
+    // Hand the velocity over to the interrupt loop when it's enabled
+    publishIsrSetpoint(true, true);
+
+    CutRecorder::Instance().beginCut(_startPos, _targetPos, _maxFeedRate);
+
+    BINLOG(FEED_START, _targetPos, _currentFeedRate * 100.0f, _torqueTarget);
 
     return true;
 }
 
 void DynamicFeed::abort() {
+    // Take the velocity back from the interrupt loop before stopping
+    publishIsrSetpoint(false, false);
+
     // First reduce acceleration for gentler stop
     _motor->AccelMax(static_cast<uint32_t>(_originalAccelValue * _accelFactor * _endAccelRatio));
 
     // Then use decelerated stop
     _motor->MoveStopDecel();
 
-    // Restore original acceleration after a brief delay
-    Delay_ms(100);
-    _motor->AccelMax(_originalAccelValue);
+    // Restore original acceleration once the stop is under way
+    scheduleAccelRestore(_originalAccelValue, RAMP_STEP_MS);
 
+    _rampStep = 0;
     _state = State::Idle;
-    ClearCore::ConnectorUsb.SendLine("[DynamicFeed] Operation aborted with controlled deceleration");
+    CutRecorder::Instance().trigger(CutRecorder::Trigger::Abort);
+    CutRecorder::Instance().endCut();
+    BINLOG(FEED_ABORT);
 }
 
 bool DynamicFeed::update(float currentPos) {
+    LOOP_WATCHDOG_MARK();
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    serviceAccelRestore(now);
+
     switch (_state) {
     case State::Idle:
         return false;
 
     case State::Feeding: {
         // Gradually restore normal acceleration after startup ramp
-        uint32_t now = ClearCore::TimingMgr.Milliseconds();
-        if (now - _rampStartTime < _startRampDuration * 1000) {
+        if (!_feedAccelRestored && now - _rampStartTime < _startRampDuration * 1000) {
             // Still in startup ramp, maintain reduced acceleration
             float progressRatio = static_cast<float>(now - _rampStartTime) / (_startRampDuration * 1000);
             float accelRatio = _startAccelRatio + progressRatio * (1.0f - _startAccelRatio);
             uint32_t targetAccel = static_cast<uint32_t>(_originalAccelValue * _accelFactor * accelRatio);
 
             // Don't update too frequently - only when there's a meaningful change
-            static uint32_t lastAccelUpdate = 0;
-            if (now - lastAccelUpdate > 100) {
-                lastAccelUpdate = now;
-                _motor->AccelMax(targetAccel);
+            if (now - _lastAccelUpdate > 100) {
+                _lastAccelUpdate = now;
+                setFeedAccel(targetAccel);
             }
         }
-        else {
-            // Once ramp time has passed, restore to normal acceleration with factor applied
-            _motor->AccelMax(static_cast<uint32_t>(_originalAccelValue * _accelFactor));
+        else if (!_feedAccelRestored) {
+            // Once ramp time has passed, restore to normal acceleration with factor applied (once)
+            setFeedAccel(static_cast<uint32_t>(_originalAccelValue * _accelFactor));
+            _feedAccelRestored = true;
         }
 
         // Continue with normal feed rate adjustment
-        adjustFeedRateBasedOnTorque();
+        if (isrLoopActive()) {
+            pullIsrTelemetry(now);
+        }
+        else {
+            adjustFeedRateBasedOnTorque();
+        }
+        CutRecorder::Instance().sample(currentPos, _torquePct, _smoothedTorque, _torqueTarget,
+            _currentFeedRate);
+
         float direction = (_targetPos > _startPos) ? 1.0f : -1.0f;
 
         // Check if we've reached or passed the target position
         if ((direction > 0 && currentPos >= _targetPos) ||
             (direction < 0 && currentPos <= _targetPos)) {
-            ClearCore::ConnectorUsb.SendLine("[DynamicFeed] Feed complete, preparing for smooth retract");
+            BINLOG(FEED_COMPLETE);
+            CutRecorder::Instance().endCut();
 
-            // Smoothly transition to stop before retracting
+            // Smoothly transition to stop; retract starts once deceleration settles
+            publishIsrSetpoint(false, false);
             _motor->MoveStopDecel();
-            Delay_ms(200); // Wait for deceleration to complete
+            _stepStartTime = now;
+            _state = State::Stopping;
+        }
+        break;
+    }
 
+    case State::Stopping:
+        if (now - _stepStartTime >= STOP_SETTLE_MS) {
             startRetract();
         }
         break;
-    }
 
     case State::Retracting: {
+        advanceRetractRamp(now);
+
         float direction = (_startPos > _targetPos) ? 1.0f : -1.0f;
         // Check if we've reached or passed the start position
         if ((direction > 0 && currentPos >= _startPos) ||
@@ -176,17 +206,21 @@ bool DynamicFeed::update(float currentPos) {
             // Slow deceleration stop
             _motor->MoveStopDecel();
 
-            // Restore original acceleration
-            Delay_ms(100);
-            _motor->AccelMax(_originalAccelValue);
+            // Restore original acceleration once the stop is under way
+            scheduleAccelRestore(_originalAccelValue, RAMP_STEP_MS);
 
+            _rampStep = 0;
             _state = State::Idle;
-            ClearCore::ConnectorUsb.SendLine("[DynamicFeed] Retract complete with smooth stop, ready");
+            BINLOG(FEED_RETRACT_DONE);
             return true; // Entire cycle complete
         }
         break;
     }
 
+    case State::Resuming:
+        advanceResumeRamp(now);
+        break;
+
     case State::Paused:
         // Do nothing while paused
         break;
@@ -201,9 +235,10 @@ bool DynamicFeed::isActive() const {
 void DynamicFeed::setTorqueTarget(float targetPercent) {
     _torqueTarget = (targetPercent < 1.0f) ? 1.0f :
         (targetPercent > 95.0f) ? 95.0f : targetPercent;
-    ClearCore::ConnectorUsb.Send("[DynamicFeed] Torque target set to ");
-    ClearCore::ConnectorUsb.Send(_torqueTarget, 1);
-    ClearCore::ConnectorUsb.SendLine("%");
+    if (_state == State::Feeding) {
+        publishIsrSetpoint(true, false);
+    }
+    BINLOG(FEED_TORQUE_TARGET, _torqueTarget);
 }
 
 float DynamicFeed::getTorqueTarget() const {
@@ -218,6 +253,14 @@ void DynamicFeed::updateFeedRate(float newVelocityScale) {
 }
 
 float DynamicFeed::updateTorqueMeasurement() {
+    // The interrupt loop samples and filters torque at its own rate
+    TorqueFeedLoop::Telemetry t;
+    if (isrLoopActive() && TorqueFeedLoop::Instance().telemetry(t)) {
+        _torquePct = t.torquePct;
+        _smoothedTorque = t.smoothedTorque;
+        return _smoothedTorque;
+    }
+
     float newTorque = 0.0f;
     if (_motor->HlfbState() == MotorDriver::HLFB_HAS_MEASUREMENT) {
         newTorque = _motor->HlfbPercent();
@@ -276,53 +319,48 @@ float DynamicFeed::getRapidVelocityScale() const {
 void DynamicFeed::adjustFeedRateBasedOnTorque() {
     if (_state != State::Feeding) return;
 
-    uint32_t now = ClearCore::TimingMgr.Milliseconds();
-    float dt = static_cast<float>(now - _lastTorqueUpdateTime) / 1000.0f;
-    _lastTorqueUpdateTime = now;
-    if (dt < 0.005f || dt > 0.5f) dt = 0.01f;
-
-    float torqueError = _torqueTarget - _torquePct;
-
-    static float previousTorqueError = 0.0f;
-    float torqueErrorDerivative = (torqueError - previousTorqueError) / dt;
-    previousTorqueError = torqueError;
+    // Fixed period. A late pass runs one step and resyncs rather than
+    // stepping the same measurement several times to catch up.
+    uint32_t nowUs = ClearCore::TimingMgr.Microseconds();
+    if (static_cast<int32_t>(nowUs - _nextLawUs) < 0) return;
+    _nextLawUs += TORQUE_PID_PERIOD_US;
+    if (static_cast<int32_t>(nowUs - _nextLawUs) >= 0) {
+        _nextLawUs = nowUs + TORQUE_PID_PERIOD_US;
+    }
 
-    _torqueErrorAccumulator += torqueError * dt;
-    _torqueErrorAccumulator = (_torqueErrorAccumulator > 5.0f) ? 5.0f :
-        (_torqueErrorAccumulator < -5.0f) ? -5.0f : _torqueErrorAccumulator;
+    _currentFeedRate = _law.step(_torqueTarget, _torquePct, _minFeedRate, _maxFeedRate);
 
-    float feedAdjustment = (TORQUE_Kp * torqueError) +
-        (TORQUE_Ki * _torqueErrorAccumulator) +
-        (TORQUE_Kd * torqueErrorDerivative);
+    // A velocity move holds until replaced, so only re-command on a change
+    if (fabsf(_currentFeedRate - _lastWrittenRate) > TORQUE_PID_WRITE_DEADBAND) {
+        _motor->MoveVelocity(static_cast<int32_t>(_feedDirection * _currentFeedRate * _stepsPerInch));
+        _lastWrittenRate = _currentFeedRate;
+    }
 
-    float targetFeedRate = _currentFeedRate + feedAdjustment * dt;
-    targetFeedRate = (targetFeedRate < _minFeedRate) ? _minFeedRate :
-        (targetFeedRate > _maxFeedRate) ? _maxFeedRate : targetFeedRate;
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    if (now - _lastRateLogTime >= 100) {
+        _lastRateLogTime = now;
+        BINLOG(FEED_RATE, _currentFeedRate * 100.0f,
+            (_currentFeedRate - _lastLoggedRate) * 100.0f, _torqueTarget - _torquePct);
+        _lastLoggedRate = _currentFeedRate;
+    }
+}
 
-    // Reduced rate of change for smoother transitions (5.0 instead of 15.0)
-    float rateOfChange = 5.0f;
-    float previousFeedRate = _currentFeedRate;
-    _currentFeedRate += (targetFeedRate - _currentFeedRate) * min(1.0f, dt * rateOfChange);
+void DynamicFeed::scheduleGains() {
+    // Commanded spindle speed, or the one it will be started at
+    float rpm = MotionController::Instance().getSpindleRPM();
+    if (rpm <= 0.0f) rpm = SettingsManager::Instance().settings().spindleRPM;
+    float diameter = SettingsManager::Instance().settings().bladeDiameter;
 
-    static uint32_t lastVelocityUpdateTime = 0;
-    bool significantChange = fabs(_currentFeedRate - previousFeedRate) > 0.002f;
-    bool timeToUpdate = (now - lastVelocityUpdateTime) > 20;
+    _gains = TorqueLaw::schedule(diameter, rpm);
+    _law.configure(_gains, TORQUE_PID_PERIOD_US / 1000000.0f);
+    BINLOG(FEED_GAINS, diameter, rpm, _gains.kp, _gains.ki, _gains.kd);
+}
 
-    if (significantChange || timeToUpdate) {
-        lastVelocityUpdateTime = now;
-        float currentPos = static_cast<float>(_motor->PositionRefCommanded()) / _stepsPerInch;
-        float direction = (_targetPos > _startPos) ? 1.0f : -1.0f;
-        int32_t velocitySteps = static_cast<int32_t>(direction * _currentFeedRate * _stepsPerInch);
-        _motor->MoveVelocity(velocitySteps);
-
-        ClearCore::ConnectorUsb.Send("[DynamicFeed] Feed rate updated: ");
-        ClearCore::ConnectorUsb.Send(_currentFeedRate * 100.0f, 1);
-        ClearCore::ConnectorUsb.Send("%, change: ");
-        ClearCore::ConnectorUsb.Send((_currentFeedRate - previousFeedRate) * 100.0f, 2);
-        ClearCore::ConnectorUsb.Send("%, error: ");
-        ClearCore::ConnectorUsb.Send(torqueError, 2);
-        ClearCore::ConnectorUsb.SendLine("");
-    }
+void DynamicFeed::restartLaw() {
+    _law.reset(_currentFeedRate, _torquePct);
+    _lastWrittenRate = _currentFeedRate;
+    _lastLoggedRate = _currentFeedRate;
+    _nextLawUs = ClearCore::TimingMgr.Microseconds() + TORQUE_PID_PERIOD_US;
 }
 
 void DynamicFeed::startRetract() {
@@ -335,43 +373,91 @@ void DynamicFeed::startRetract() {
     float direction = (_startPos > _targetPos) ? 1.0f : -1.0f;
     _motor->VelMax(static_cast<uint32_t>(MAX_VELOCITY * _rapidFeedRate));
 
-    // Start at 30% speed
+    // Start at 30% speed; advanceRetractRamp() steps to 60% and then full speed
     _motor->MoveVelocity(static_cast<int32_t>(direction * 0.3f * _rapidFeedRate * _stepsPerInch));
-    Delay_ms(100);
+    _rampStep = 1;
+    _stepStartTime = ClearCore::TimingMgr.Milliseconds();
 
-    // Ramp to 60% speed 
-    _motor->MoveVelocity(static_cast<int32_t>(direction * 0.6f * _rapidFeedRate * _stepsPerInch));
-    Delay_ms(100);
-
-    // Final ramp to full retract speed
-    _motor->MoveVelocity(static_cast<int32_t>(direction * _rapidFeedRate * _stepsPerInch));
-
-    // Restore normal acceleration after starting the retract
-    Delay_ms(100);
-    _motor->AccelMax(static_cast<uint32_t>(_originalAccelValue * _accelFactor));
-
-    ClearCore::ConnectorUsb.Send("[DynamicFeed] Retracting to ");
-    ClearCore::ConnectorUsb.Send(_startPos);
-    ClearCore::ConnectorUsb.Send(" inches with smooth acceleration at ");
-    ClearCore::ConnectorUsb.Send(_rapidFeedRate * 100.0f, 0);
-    ClearCore::ConnectorUsb.SendLine("% rapid speed");
+    BINLOG(FEED_RETRACT, _startPos, _rapidFeedRate * 100.0f);
 }
 
 void DynamicFeed::stopAll() {
+    publishIsrSetpoint(false, false);
+
     // Use controlled deceleration instead of abrupt stop
     _motor->AccelMax(static_cast<uint32_t>(_originalAccelValue * _accelFactor * _endAccelRatio));
     _motor->MoveStopDecel();
 
-    // Delay to allow for deceleration before state change
-    Delay_ms(100);
-
-    // Restore original acceleration
-    _motor->AccelMax(_originalAccelValue);
+    // Restore original acceleration once the stop is under way
+    scheduleAccelRestore(_originalAccelValue, RAMP_STEP_MS);
+    _rampStep = 0;
     _state = State::Idle;
+    CutRecorder::Instance().endCut();
+}
+
+void DynamicFeed::advanceRetractRamp(uint32_t now) {
+    if (_rampStep == 0 || now - _stepStartTime < RAMP_STEP_MS) return;
+
+    float direction = (_startPos > _targetPos) ? 1.0f : -1.0f;
+    switch (_rampStep) {
+    case 1:
+        // Ramp to 60% speed
+        _motor->MoveVelocity(static_cast<int32_t>(direction * 0.6f * _rapidFeedRate * _stepsPerInch));
+        _rampStep = 2;
+        break;
+    case 2:
+        // Final ramp to full retract speed
+        _motor->MoveVelocity(static_cast<int32_t>(direction * _rapidFeedRate * _stepsPerInch));
+        _rampStep = 3;
+        break;
+    default:
+        // Restore normal acceleration after starting the retract
+        _motor->AccelMax(static_cast<uint32_t>(_originalAccelValue * _accelFactor));
+        _rampStep = 0;
+        break;
+    }
+    _stepStartTime = now;
+}
+
+void DynamicFeed::advanceResumeRamp(uint32_t now) {
+    if (now - _stepStartTime < RAMP_STEP_MS) return;
+
+    if (_rampStep == 1) {
+        // Gradually increase to target speed
+        _motor->MoveVelocity(static_cast<int32_t>(_feedDirection * _currentFeedRate * 0.7f * _stepsPerInch));
+        _rampStep = 2;
+        _stepStartTime = now;
+        return;
+    }
+
+    // Full speed - hand back to the torque loop
+    _motor->MoveVelocity(static_cast<int32_t>(_feedDirection * _currentFeedRate * _stepsPerInch));
+    _rampStep = 0;
+    restartLaw();
+    _state = State::Feeding;
+    publishIsrSetpoint(true, false);
+
+    BINLOG(FEED_RESUMED, _currentFeedRate * 100.0f);
+}
+
+void DynamicFeed::scheduleAccelRestore(uint32_t accel, uint32_t delayMs) {
+    _accelRestoreValue = accel;
+    _accelRestoreTime = ClearCore::TimingMgr.Milliseconds() + delayMs;
+    _accelRestorePending = true;
+}
+
+void DynamicFeed::serviceAccelRestore(uint32_t now) {
+    if (_accelRestorePending && static_cast<int32_t>(now - _accelRestoreTime) >= 0) {
+        _accelRestorePending = false;
+        _motor->AccelMax(_accelRestoreValue);
+    }
 }
 
 void DynamicFeed::pause() {
-    if (_state == State::Feeding) {
+    if (_state == State::Feeding || _state == State::Resuming) {
+        publishIsrSetpoint(false, false);
+        _rampStep = 0;
+
         // Store feed direction before pausing (1 for forward, -1 for reverse)
         _feedDirection = (_targetPos > _startPos) ? 1.0f : -1.0f;
 
@@ -383,39 +469,30 @@ void DynamicFeed::pause() {
 
         // Save the previous state and enter paused state
         _state = State::Paused;
+        CutRecorder::Instance().trigger(CutRecorder::Trigger::FeedHold);
 
-        ClearCore::ConnectorUsb.SendLine("[DynamicFeed] Feed paused with gentle deceleration");
+        BINLOG(FEED_PAUSED);
     }
 }
 
 void DynamicFeed::resume() {
     if (_state == State::Paused) {
-        // Return to feeding state
-        _state = State::Feeding;
+        // Step back up to speed; advanceResumeRamp() returns to Feeding
+        _state = State::Resuming;
         _rampStartTime = ClearCore::TimingMgr.Milliseconds();
+        _feedAccelRestored = false;
 
         // Configure gentler acceleration for resumption
-        _motor->AccelMax(static_cast<uint32_t>(_originalAccelValue * _accelFactor * _startAccelRatio));
+        _feedAccel = static_cast<uint32_t>(_originalAccelValue * _accelFactor * _startAccelRatio);
+        _motor->AccelMax(_feedAccel);
 
         // Start with lower speed then ramp up
         float initialResumeRate = _currentFeedRate * 0.5f;
 
         // Resume velocity using stored direction and gradual feed rate ramp
         _motor->MoveVelocity(static_cast<int32_t>(_feedDirection * initialResumeRate * _stepsPerInch));
-        Delay_ms(100);
-
-        // Gradually increase to target speed
-        _motor->MoveVelocity(static_cast<int32_t>(_feedDirection * _currentFeedRate * 0.7f * _stepsPerInch));
-        Delay_ms(100);
-
-        // Full speed
-        _motor->MoveVelocity(static_cast<int32_t>(_feedDirection * _currentFeedRate * _stepsPerInch));
-
-        _lastTorqueUpdateTime = ClearCore::TimingMgr.Milliseconds();
-
-        ClearCore::ConnectorUsb.Send("[DynamicFeed] Feed resumed with smooth acceleration at ");
-        ClearCore::ConnectorUsb.Send(_currentFeedRate * 100.0f, 1);
-        ClearCore::ConnectorUsb.SendLine("% feed rate");
+        _rampStep = 1;
+        _stepStartTime = _rampStartTime;
     }
 }
 
@@ -423,24 +500,53 @@ bool DynamicFeed::isPaused() const {
     return _state == State::Paused;
 }
 
-void DynamicFeed::executeRampToVelocity(float targetVelocityScale, float rampTime) {
-    float direction = _feedDirection;
+bool DynamicFeed::isrLoopActive() const {
+    return TorqueFeedLoop::Instance().running();
+}
 
-    uint32_t startTime = ClearCore::TimingMgr.Milliseconds();
-    float startVelocity = 0.2f * targetVelocityScale; // Start at 20% of target
+void DynamicFeed::publishIsrSetpoint(bool active, bool restart) {
+    if (!isrLoopActive()) return;
+
+    if (restart) _isrGeneration++;
+
+    TorqueFeedLoop::Setpoint sp;
+    sp.active = active;
+    sp.generation = _isrGeneration;
+    sp.torqueTarget = _torqueTarget;
+    sp.gains = _gains;
+    sp.startRate = _currentFeedRate;
+    sp.minRate = _minFeedRate;
+    sp.maxRate = _maxFeedRate;
+    sp.direction = _feedDirection;
+    sp.stepsPerInch = _stepsPerInch;
+    sp.accelMax = _feedAccel;
+    TorqueFeedLoop::Instance().publish(sp);
+}
 
-    // Start with lower speed
-    _motor->MoveVelocity(static_cast<int32_t>(direction * startVelocity * _stepsPerInch));
+// While the interrupt loop owns the velocity it is the only writer of the
+// motor's move settings; an AccelMax from here could interleave with its
+// MoveVelocity, so the acceleration goes through the setpoint instead
+void DynamicFeed::setFeedAccel(uint32_t accel) {
+    _feedAccel = accel;
+    if (isrLoopActive()) {
+        publishIsrSetpoint(true, false);
+    }
+    else {
+        _motor->AccelMax(accel);
+    }
+}
 
-    // Ramp up in small increments
-    uint32_t steps = 5; // Number of steps in ramp
-    uint32_t stepTime = static_cast<uint32_t>((rampTime * 1000.0f) / steps);
+void DynamicFeed::pullIsrTelemetry(uint32_t now) {
+    TorqueFeedLoop::Telemetry t;
+    if (!TorqueFeedLoop::Instance().telemetry(t)) return;
 
-    for (uint32_t i = 1; i <= steps; i++) {
-        float ratio = static_cast<float>(i) / steps;
-        float velocity = startVelocity + (targetVelocityScale - startVelocity) * ratio;
+    _currentFeedRate = t.feedRate;
+    _torquePct = t.torquePct;
+    _smoothedTorque = t.smoothedTorque;
 
-        Delay_ms(stepTime);
-        _motor->MoveVelocity(static_cast<int32_t>(direction * velocity * _stepsPerInch));
+    // The interrupt can't log; report from here at a readable rate
+    if (now - _lastIsrLogTime >= 500) {
+        _lastIsrLogTime = now;
+        BINLOG(FEED_ISR_RATE, _currentFeedRate * 100.0f, t.error, t.maxTickUs);
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ClearCore.h>
+#include "TorqueFeedLoop.h"
 
 class YAxis; // Forward declaration
 
@@ -22,7 +23,8 @@ public:
     // Abort an in-progress operation
     void abort();
 
-    // Update the dynamic feed controller (call regularly)
+    // Update the dynamic feed controller (call every loop, also when idle,
+    // so deferred acceleration restores complete)
     // Returns true if the entire feed+retract cycle is complete
     bool update(float currentPos);
 
@@ -78,8 +80,10 @@ private:
     enum class State {
         Idle,
         Feeding,
+        Stopping,   // Decelerating at end of feed before the retract starts
         Retracting,
-        Paused    // Add this state for feed hold support
+        Paused,     // Add this state for feed hold support
+        Resuming    // Stepped velocity ramp back into Feeding
     };
 
     YAxis* _owner;
@@ -100,12 +104,17 @@ private:
     float _torqueTarget = 10.0f;
     float _torquePct = 0.0f;
 
-    // PID control variables
-    float _torqueErrorAccumulator = 0.0f;
-    uint32_t _lastTorqueUpdateTime = 0;
-    static constexpr float TORQUE_Kp = 0.00004f;
-    static constexpr float TORQUE_Ki = 0.01f;
-    static constexpr float TORQUE_Kd = 0.02f;
+    // Torque law, stepped every TORQUE_PID_PERIOD_US from the main loop
+    TorqueLaw _law;
+    TorqueLaw::Gains _gains = { TorqueLaw::KP, TorqueLaw::KI, TorqueLaw::KD };
+    uint32_t _nextLawUs = 0;
+    float _lastWrittenRate = 0.0f;     // Last feed rate sent with MoveVelocity
+    uint32_t _lastRateLogTime = 0;
+    float _lastLoggedRate = 0.0f;
+
+    // Interrupt-driven torque loop (TORQUE_LOOP_IN_ISR)
+    uint32_t _isrGeneration = 0;
+    uint32_t _lastIsrLogTime = 0;
 
     // Moving average buffer for torque smoothing
     static constexpr size_t TORQUE_AVG_BUFFER_SIZE = 64;
@@ -124,10 +133,31 @@ private:
     float _endAccelRatio = 0.6f;   // Final deceleration ratio (vs. max)
     uint32_t _originalAccelValue = 0; // Store original acceleration value
     uint32_t _rampStartTime = 0;      // Track ramp start time for smooth transitions
+    uint32_t _lastAccelUpdate = 0;    // Last startup-ramp AccelMax write
+    bool _feedAccelRestored = false;  // Full acceleration sent after the startup ramp
+    uint32_t _feedAccel = 0;          // Feed acceleration, published to the interrupt loop
+
+    // Timed steps that replace the old blocking delays
+    static constexpr uint32_t STOP_SETTLE_MS = 200;  // End-of-feed decel before retract
+    static constexpr uint32_t RAMP_STEP_MS = 100;    // Spacing of stepped velocity ramps
+    uint8_t  _rampStep = 0;                // 0 = no stepped ramp in progress
+    uint32_t _stepStartTime = 0;           // When the current step/settle began
+    bool     _accelRestorePending = false;
+    uint32_t _accelRestoreValue = 0;
+    uint32_t _accelRestoreTime = 0;
 
     // Private methods
     void adjustFeedRateBasedOnTorque();
+    void scheduleGains();
+    void restartLaw();
+    bool isrLoopActive() const;
+    void publishIsrSetpoint(bool active, bool restart);
+    void setFeedAccel(uint32_t accel);
+    void pullIsrTelemetry(uint32_t now);
     void startRetract();
     void stopAll();
-    void executeRampToVelocity(float targetVelocityScale, float rampTime);
+    void advanceRetractRamp(uint32_t now);
+    void advanceResumeRamp(uint32_t now);
+    void scheduleAccelRestore(uint32_t accel, uint32_t delayMs);
+    void serviceAccelRestore(uint32_t now);
 };
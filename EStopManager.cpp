@@ -1,6 +1,7 @@
 ﻿// core/EStopManager.cpp
 #include "EStopManager.h"
 #include "Config.h"
+#include "Log.h"
 #include "MotionController.h"
 #include <ClearCore.h>
 
@@ -34,8 +35,7 @@ void EStopManager::setup() {
     _relayEnabled = safe;
     SAFETY_RELAY_OUTPUT.State(_relayEnabled);
 
-    ClearCore::ConnectorUsb.Send("EStopManager started, safe? ");
-    ClearCore::ConnectorUsb.SendLine(safe ? "YES" : "NO");
+    LOG_INFO(Sys, "EStopManager started, safe? ", safe ? "YES" : "NO");
 }
 
 void EStopManager::update() {
@@ -45,12 +45,12 @@ void EStopManager::update() {
     if (!safe && _relayEnabled) {
         _relayEnabled = false;
         SAFETY_RELAY_OUTPUT.State(false);
-        ClearCore::ConnectorUsb.SendLine("!! E-STOP ACTIVATED !!");
+        LOG_ERROR(Sys, "!! E-STOP ACTIVATED !!");
         emergencyStop();
     }
     // Edge: just released
     else if (safe && !_prevSafeState) {
-        ClearCore::ConnectorUsb.SendLine("E-STOP button released");
+        LOG_WARN(Sys, "E-STOP button released");
         if (_autoReset) _resetRequested = true;
     }
     // Safe again and reset was requested → re-energize
@@ -58,7 +58,7 @@ void EStopManager::update() {
         _relayEnabled = true;
         _resetRequested = false;
         SAFETY_RELAY_OUTPUT.State(true);
-        ClearCore::ConnectorUsb.SendLine("Safety relay re-enabled");
+        LOG_INFO(Sys, "Safety relay re-enabled");
     }
 
     _prevSafeState = safe;
@@ -1,7 +1,9 @@
 // EncoderPositionTracker.cpp
 #include "EncoderPositionTracker.h"
+#include "LatencyProfiler.h"
 #include "Config.h"
 #include <ClearCore.h>
+#include "Log.h"
 
 EncoderPositionTracker& EncoderPositionTracker::Instance() {
     static EncoderPositionTracker instance;
@@ -25,7 +27,7 @@ void EncoderPositionTracker::setup(float xStepsPerInch, float yStepsPerInch) {
     
     _isInitialized = true;
     
-    ClearCore::ConnectorUsb.SendLine("[EncoderTracker] Setup complete");
+    BINLOG(ENC_SETUP);
 }
 
 void EncoderPositionTracker::resetPositionAfterHoming() {
@@ -41,10 +43,11 @@ void EncoderPositionTracker::resetPositionAfterHoming() {
     _positionErrorX = false;
     _positionErrorY = false;
     
-    ClearCore::ConnectorUsb.SendLine("[EncoderTracker] Position reset after homing");
+    BINLOG(ENC_RESET);
 }
 
 void EncoderPositionTracker::update() {
+    LATENCY_PROBE("encoder");
     if (!_isInitialized) return;
     
     // Read current encoder values
@@ -70,12 +73,9 @@ void EncoderPositionTracker::update() {
     // Log significant position changes (reduce noise)
     static uint32_t lastLogTime = 0;
     uint32_t now = ClearCore::TimingMgr.Milliseconds();
-    if (now - lastLogTime > 1000) { // Log every second
+    if (LOG_ENABLED(Motion, Debug) && now - lastLogTime > ENCODER_LOG_INTERVAL) {
         lastLogTime = now;
-        ClearCore::ConnectorUsb.Send("[EncoderTracker] X: ");
-        ClearCore::ConnectorUsb.Send(_absolutePositionXInches, 4);
-        ClearCore::ConnectorUsb.Send(" inches, Y: ");
-        ClearCore::ConnectorUsb.SendLine(_absolutePositionYInches, 4);
+        BINLOG(ENC_POSITION, _absolutePositionXInches, _absolutePositionYInches);
     }
 }
 
@@ -92,12 +92,8 @@ bool EncoderPositionTracker::verifyPositionX(float expectedInches, float toleran
     
     if (!isValid && !_positionErrorX) {
         _positionErrorX = true;
-        ClearCore::ConnectorUsb.Send("[EncoderTracker] ERROR: X position mismatch. Expected: ");
-        ClearCore::ConnectorUsb.Send(expectedInches, 4);
-        ClearCore::ConnectorUsb.Send(", Actual: ");
-        ClearCore::ConnectorUsb.Send(_absolutePositionXInches, 4);
-        ClearCore::ConnectorUsb.Send(", Diff: ");
-        ClearCore::ConnectorUsb.SendLine(fabs(_absolutePositionXInches - expectedInches), 4);
+        BINLOG(ENC_MISMATCH_X, expectedInches, _absolutePositionXInches,
+            fabs(_absolutePositionXInches - expectedInches));
     }
     
     return isValid;
@@ -108,12 +104,8 @@ bool EncoderPositionTracker::verifyPositionY(float expectedInches, float toleran
     
     if (!isValid && !_positionErrorY) {
         _positionErrorY = true;
-        ClearCore::ConnectorUsb.Send("[EncoderTracker] ERROR: Y position mismatch. Expected: ");
-        ClearCore::ConnectorUsb.Send(expectedInches, 4);
-        ClearCore::ConnectorUsb.Send(", Actual: ");
-        ClearCore::ConnectorUsb.Send(_absolutePositionYInches, 4);
-        ClearCore::ConnectorUsb.Send(", Diff: ");
-        ClearCore::ConnectorUsb.SendLine(fabs(_absolutePositionYInches - expectedInches), 4);
+        BINLOG(ENC_MISMATCH_Y, expectedInches, _absolutePositionYInches,
+            fabs(_absolutePositionYInches - expectedInches));
     }
     
     return isValid;
@@ -134,5 +126,5 @@ bool EncoderPositionTracker::hasPositionError() const {
 void EncoderPositionTracker::clearPositionError() {
     _positionErrorX = false;
     _positionErrorY = false;
-    ClearCore::ConnectorUsb.SendLine("[EncoderTracker] Position errors cleared");
+    BINLOG(ENC_ERRORS_CLEARED);
 }
@@ -0,0 +1,146 @@
+// EventRouter.cpp
+#include "EventRouter.h"
+#include "Config.h"
+#include "DisplayModel.h"
+#include "LatencyProfiler.h"
+#include "Log.h"
+#include "ScreenManager.h"
+
+extern Genie genie;
+
+namespace {
+
+    using EventRouter::Route;
+    using EventRouter::FORM_ANY;
+
+    /// A button on one form calls a member of that form's screen. The route's
+    /// form guard has already matched, so the current screen is an S.
+    template <typename S, void (S::*Action)()>
+    void screenAction(const genieFrame&) {
+        (static_cast<S*>(ScreenManager::Instance().currentScreen())->*Action)();
+    }
+
+    // Every form's settings button: release it and open Settings
+    void openSettings(const genieFrame& e) {
+        if (ScreenManager::Instance().currentForm() == FORM_SETTINGS) return;
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, e.reportObject.index, 0);
+        ScreenManager::Instance().ShowSettings();
+    }
+
+#define BUTTON(form, id, S, action) \
+    { GENIE_OBJ_WINBUTTON, id, form, &screenAction<S, &S::action> }
+#define BUTTON_ANY_FORM(id, handler) \
+    { GENIE_OBJ_WINBUTTON, id, FORM_ANY, handler }
+
+    // Sorted by object then index
+    constexpr Route ROUTES[] = {
+        BUTTON(FORM_JOG_X, WINBUTTON_CAPTURE_ZERO, JogXScreen, captureZero),                        //  0
+        BUTTON(FORM_JOG_X, WINBUTTON_CAPTURE_STOCK_LENGTH, JogXScreen, captureStockLength),         //  1
+        BUTTON(FORM_JOG_X, WINBUTTON_ACTIVATE_JOG, JogXScreen, toggleJog),                          //  2
+        BUTTON(FORM_JOG_X, WINBUTTON_CAPTURE_INCREMENT, JogXScreen, captureIncrement),              //  3
+        BUTTON(FORM_JOG_X, WINBUTTON_INC_PLUS, JogXScreen, incrementPlus),                          //  4
+        BUTTON(FORM_JOG_X, WINBUTTON_INC_MINUS, JogXScreen, incrementMinus),                        //  5
+        BUTTON(FORM_JOG_X, WINBUTTON_DIVIDE_SET, JogXScreen, divideStock),                          //  6
+        BUTTON(FORM_JOG_X, WINBUTTON_SET_STOCK_LENGTH, JogXScreen, editStockLength),                //  7
+        BUTTON(FORM_JOG_X, WINBUTTON_SET_CUT_THICKNESS, JogXScreen, editCutThickness),              //  8
+        BUTTON(FORM_JOG_X, WINBUTTON_SET_TOTAL_SLICES, JogXScreen, editTotalSlices),                //  9
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_SPINDLE_ON, SemiAutoScreen, toggleSpindle),                // 10
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_FEED_TO_STOP, SemiAutoScreen, feedToStopPressed),          // 11
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_FEED_HOLD, SemiAutoScreen, feedHoldPressed),               // 12
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_EXIT_FEED_HOLD, SemiAutoScreen, exitFeedHoldPressed),      // 13
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_INC_PLUS_F2, SemiAutoScreen, advanceIncrement),            // 14
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_STOCK_ZERO, SemiAutoScreen, goToStockZero),                // 15
+        BUTTON_ANY_FORM(WINBUTTON_SETTINGS_SEMI, openSettings),                                     // 16
+        BUTTON(FORM_SETTINGS, WINBUTTON_SET_RPM_SETTINGS, SettingsScreen, editRpm),                 // 17
+        BUTTON(FORM_SETTINGS, WINBUTTON_SET_FEEDRATE_SETTINGS, SettingsScreen, editFeedRate),       // 18
+        BUTTON(FORM_SETTINGS, WINBUTTON_SET_RAPID_SETTINGS, SettingsScreen, editRapid),             // 19
+        BUTTON(FORM_SETTINGS, WINBUTTON_SET_DIAMETER_SETTINGS, SettingsScreen, editDiameter),       // 20
+        BUTTON(FORM_SETTINGS, WINBUTTON_SET_THICKNESS_SETTINGS, SettingsScreen, editThickness),     // 21
+        BUTTON(FORM_AUTOCUT, WINBUTTON_END_CYCLE_F5, AutoCutScreen, cancelCycle),                   // 22
+        BUTTON(FORM_AUTOCUT, WINBUTTON_SLIDE_HOLD_F5, AutoCutScreen, togglePauseResume),            // 23
+        BUTTON(FORM_AUTOCUT, WINBUTTON_SPINDLE_F5, AutoCutScreen, toggleSpindle),                   // 24
+        BUTTON(FORM_AUTOCUT, WINBUTTON_START_AUTOFEED_F5, AutoCutScreen, startCycle),               // 25
+        BUTTON_ANY_FORM(WINBUTTON_SETTINGS_F5, openSettings),                                       // 26
+        BUTTON(FORM_JOG_Y, WINBUTTON_CAPTURE_CUT_END_F6, JogYScreen, captureCutEnd),                // 27
+        BUTTON(FORM_JOG_Y, WINBUTTON_ACTIVATE_JOG_Y_F6, JogYScreen, toggleJogMode),                 // 28
+        BUTTON(FORM_JOG_Y, WINBUTTON_SET_WITH_MPG_F6, JogYScreen, setLengthWithMPG),                // 29
+        BUTTON(FORM_JOG_Y, WINBUTTON_CAPTURE_CUT_START_F6, JogYScreen, captureCutStart),            // 30
+        BUTTON(FORM_MANUAL_MODE, WINBUTTON_SPINDLE_TOGGLE_F7, ManualModeScreen, toggleSpindle),     // 31
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_ADJUST_MAX_SPEED, SemiAutoScreen, adjustMaxFeedRate),      // 32
+        BUTTON(FORM_MANUAL_MODE, WINBUTTON_ACTIVATE_HOMING, ManualModeScreen, activateHoming),      // 33
+        BUTTON(FORM_JOG_Y, WINBUTTON_JOG_TO_START, JogYScreen, jogToStartPosition),                 // 34
+        BUTTON_ANY_FORM(WINBUTTON_SETTINGS_F7, openSettings),                                       // 35
+        BUTTON(FORM_SETTINGS, WINBUTTON_BACK, SettingsScreen, back),                                // 38
+        BUTTON(FORM_JOG_Y, WINBUTTON_SET_RETRACT_WITH_MPG_F6, JogYScreen, setRetractWithMPG),       // 39
+        BUTTON(FORM_SETTINGS, WINBUTTON_SET_CUT_PRESSURE_F3, SettingsScreen, adjustCutPressure),    // 40
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_ADJUST_CUT_PRESSURE, SemiAutoScreen, adjustCutPressure),   // 41
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_HOME_F2, SemiAutoScreen, goToZero),                        // 42
+        BUTTON(FORM_AUTOCUT, WINBUTTON_ADJUST_CUT_PRESSURE_F5, AutoCutScreen, adjustCutPressure),   // 43
+        BUTTON(FORM_AUTOCUT, WINBUTTON_MOVE_TO_START_POSITION, AutoCutScreen, moveToStartPosition), // 44
+        BUTTON(FORM_AUTOCUT, WINBUTTON_ADJUST_MAX_SPEED_F5, AutoCutScreen, adjustMaxSpeed),         // 45
+        BUTTON(FORM_AUTOCUT, WINBUTTON_SETUP_AUTOCUT_F5, AutoCutScreen, openSetupAutocutScreen),    // 46
+        BUTTON(FORM_JOG_X, WINBUTTON_GO_TO_ZERO, JogXScreen, goToZero),                             // 47
+        BUTTON(FORM_JOG_Y, WINBUTTON_JOG_TO_END, JogYScreen, jogToEndPosition),                     // 48
+        BUTTON(FORM_JOG_Y, WINBUTTON_JOG_TO_RETRACT, JogYScreen, jogToRetractPosition),             // 49
+        BUTTON(FORM_SEMI_AUTO, WINBUTTON_INC_MINUS_F2, SemiAutoScreen, retreatIncrement),           // 50
+        BUTTON(FORM_JOG_X, WINBUTTON_SET_STOCK_SLICES_X_INC, JogXScreen, setStockSlicesTimesIncrement), // 51
+        BUTTON_ANY_FORM(WINBUTTON_SETTINGS_F9, openSettings),                                       // 52
+        BUTTON(FORM_SETUP_AUTOCUT, WINBUTTON_SLICES_TO_CUT_F9, SetupAutocutScreen, setSlicesToCut), // 53
+        BUTTON(FORM_SETUP_AUTOCUT, WINBUTTON_RETURN_TO_AUTOCUT_F9, SetupAutocutScreen, returnToAutoCut), // 54
+    };
+
+#undef BUTTON
+#undef BUTTON_ANY_FORM
+
+    constexpr size_t ROUTE_COUNT = sizeof(ROUTES) / sizeof(ROUTES[0]);
+
+    constexpr uint16_t keyOf(uint8_t object, uint8_t index) {
+        return static_cast<uint16_t>(object << 8 | index);
+    }
+
+    constexpr bool ascending(const Route* r, size_t n) {
+        return n < 2 || (keyOf(r[0].object, r[0].index) < keyOf(r[1].object, r[1].index)
+            && ascending(r + 1, n - 1));
+    }
+
+    static_assert(ascending(ROUTES, ROUTE_COUNT),
+        "EventRouter ROUTES must be sorted by object then index, with no duplicates");
+}
+
+const Route* EventRouter::find(uint8_t object, uint8_t index) {
+    uint16_t key = keyOf(object, index);
+    size_t lo = 0, hi = ROUTE_COUNT;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        uint16_t k = keyOf(ROUTES[mid].object, ROUTES[mid].index);
+        if (k == key) return &ROUTES[mid];
+        if (k < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return nullptr;
+}
+
+bool EventRouter::dispatch(const genieFrame& e) {
+    if (e.reportObject.cmd != GENIE_REPORT_EVENT) return false;
+
+    const Route* r = find(e.reportObject.object, e.reportObject.index);
+    if (!r || (r->form != FORM_ANY && r->form != ScreenManager::Instance().currentForm())) {
+        LOG_DEBUG(UI, "[EV] unrouted object ", e.reportObject.object, " index ", e.reportObject.index);
+        return false;
+    }
+    r->handler(e);
+    return true;
+}
+
+void EventRouter::onGenieEvent() {
+    LATENCY_PROBE("event");
+    genieFrame evt;
+    genie.DequeueEvent(&evt);
+    DisplayModel::Instance().noteEvent(evt);
+    if (evt.reportObject.cmd == GENIE_READY) {
+        // Detected late or reset: it is showing its power-up form
+        ScreenManager::Instance().Redraw();
+        return;
+    }
+    dispatch(evt);
+}
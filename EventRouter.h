@@ -0,0 +1,38 @@
+// EventRouter.h
+#pragma once
+
+#include <stdint.h>
+#include <genieArduinoDEV.h>
+
+/// Genie touch events, dispatched through one compile-time table.
+///
+/// Every button the firmware acts on has a Route: the object type and index
+/// it reports with, the form it lives on (or FORM_ANY for buttons that act
+/// the same wherever they are), and the function to call. Object indices are
+/// unique per type across the whole display project, so (object, index)
+/// finds the route and the form is a guard: a route whose form isn't showing
+/// does nothing. The table is sorted by (object, index) - a static_assert
+/// keeps it that way - so any event, routed or not, costs one binary search.
+namespace EventRouter {
+
+    typedef void (*Handler)(const genieFrame& e);
+
+    constexpr uint8_t FORM_ANY = 0xFF;
+
+    struct Route {
+        uint8_t object;
+        uint8_t index;
+        uint8_t form;           // FORM_* or FORM_ANY
+        Handler handler;
+    };
+
+    /// Route for an object, nullptr if nothing handles it
+    const Route* find(uint8_t object, uint8_t index);
+
+    /// Run the route for one event; returns false if nothing acted on it
+    bool dispatch(const genieFrame& e);
+
+    /// Genie event callback: dequeue one event and dispatch it, timed into
+    /// the "event" latency channel
+    void onGenieEvent();
+}
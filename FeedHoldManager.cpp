@@ -2,9 +2,11 @@
 #include "MotionController.h"
 #include "ClearCore.h"  // For ClearCore::ConnectorUsb
 #include "Spindle.h"    // For controlling the spindle
+#include "LoopWatchdog.h"
+#include "Log.h"
 
 FeedHoldManager::FeedHoldManager()
-    : _paused(false), _feedStartPos(0.0f)
+    : _paused(false), _feedStartPos(0.0f), _exitStep(EXIT_IDLE), _exitStepStart(0)
 {
 }
 
@@ -15,8 +17,7 @@ void FeedHoldManager::toggleFeedHold() {
         // feed begins, so we don't overwrite it here during pause
 
         // Log the stored start position for reference
-        ClearCore::ConnectorUsb.Send("[FeedHoldManager] Feed paused. Stored start position: ");
-        ClearCore::ConnectorUsb.SendLine(_feedStartPos);
+        LOG_INFO(Feed, "[FeedHoldManager] Feed paused. Stored start position: ", _feedStartPos);
 
         // Pause the feed (this calls the YAxis methods via MotionController)
         motion.pauseTorqueControlledFeed(AXIS_Y);
@@ -26,42 +27,64 @@ void FeedHoldManager::toggleFeedHold() {
         // Resume the feed without changing the stored start position
         motion.resumeTorqueControlledFeed(AXIS_Y);
         _paused = false;
-        ClearCore::ConnectorUsb.SendLine("[FeedHoldManager] Feed resumed.");
+        LOG_INFO(Feed, "[FeedHoldManager] Feed resumed.");
     }
 }
 
 void FeedHoldManager::exitFeedHold() {
-    if (_paused) {
-        MotionController& motion = MotionController::Instance();
-
+    if (_paused && _exitStep == EXIT_IDLE) {
         // Log the operation with the stored position
-        ClearCore::ConnectorUsb.Send("[FeedHoldManager] Exiting feed hold, returning to position: ");
-        ClearCore::ConnectorUsb.SendLine(_feedStartPos);
+        LOG_INFO(Feed, "[FeedHoldManager] Exiting feed hold, returning to position: ", _feedStartPos);
+
+        // First make sure motion has fully stopped; update() does the rest
+        _exitStep = EXIT_SETTLING;
+        _exitStepStart = ClearCore::TimingMgr.Milliseconds();
+    }
+}
 
-        // First make sure motion has fully stopped - use correct ClearCore delay function
-        Delay_ms(150);
+void FeedHoldManager::update() {
+    LOOP_WATCHDOG_MARK();
+    if (_exitStep == EXIT_IDLE) return;
 
-        // Abort the torque-controlled feed
-        motion.abortTorqueControlledFeed(AXIS_Y);
+    MotionController& motion = MotionController::Instance();
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+
+    switch (_exitStep) {
+    case EXIT_SETTLING:
+        if (now - _exitStepStart >= EXIT_SETTLE_MS) {
+            // Abort the torque-controlled feed
+            motion.abortTorqueControlledFeed(AXIS_Y);
+            _exitStep = EXIT_ABORTING;
+            _exitStepStart = now;
+        }
+        break;
 
-        // Small delay to ensure complete abort before starting new motion
-        Delay_ms(100);
+    case EXIT_ABORTING:
+        // Short wait to ensure complete abort before starting new motion
+        if (now - _exitStepStart >= EXIT_ABORT_MS) {
+            // Use smoother return motion with reduced velocity scale (0.7f instead of 1.0f)
+            // for gentler movement back to start position
+            motion.moveTo(AXIS_Y, _feedStartPos, 0.7f);
 
-        // Use smoother return motion with reduced velocity scale (0.7f instead of 1.0f)
-        // for gentler movement back to start position
-        motion.moveTo(AXIS_Y, _feedStartPos, 0.7f);
+            // Turn off the spindle if it is running
+            if (motion.IsSpindleRunning()) {
+                motion.StopSpindle();
+                LOG_INFO(Feed, "[FeedHoldManager] Spindle stopped.");
+            }
 
-        // Turn off the spindle if it is running
-        if (motion.IsSpindleRunning()) {
-            motion.StopSpindle();
-            ClearCore::ConnectorUsb.SendLine("[FeedHoldManager] Spindle stopped.");
+            _paused = false;
+            _exitStep = EXIT_IDLE;
         }
+        break;
 
-        _paused = false;
+    default:
+        _exitStep = EXIT_IDLE;
+        break;
     }
 }
 
 void FeedHoldManager::reset() {
     _paused = false;
+    _exitStep = EXIT_IDLE;
     _feedStartPos = 0.0f;
 }
@@ -1,6 +1,8 @@
 #ifndef FEED_HOLD_MANAGER_H
 #define FEED_HOLD_MANAGER_H
 
+#include <stdint.h>
+
 // FeedHoldManager centralizes feed hold (pause/resume/abort) logic for all screens.
 // UI screens should delegate feed hold button events to this class.
 class FeedHoldManager {
@@ -11,8 +13,15 @@ public:
     void toggleFeedHold();
 
     // Exit feed hold: abort feed and move Y axis to the original start position.
+    // Runs as timed steps - call update() every loop until isExiting() is false.
     void exitFeedHold();
 
+    // Advance the exit sequence (call from the owning screen's update()).
+    void update();
+
+    // True while the exit sequence is still settling/aborting.
+    bool isExiting() const { return _exitStep != EXIT_IDLE; }
+
     // Reset the manager state (e.g. when feed finishes).
     void reset();
 
@@ -26,8 +35,19 @@ public:
     float getStartPosition() const { return _feedStartPos; }
 
 private:
+    enum ExitStep {
+        EXIT_IDLE,
+        EXIT_SETTLING,   // Let the paused feed finish decelerating
+        EXIT_ABORTING    // Feed aborted, wait before commanding the return move
+    };
+
+    static constexpr uint32_t EXIT_SETTLE_MS = 150;
+    static constexpr uint32_t EXIT_ABORT_MS = 100;
+
     bool _paused;
     float _feedStartPos;
+    ExitStep _exitStep;
+    uint32_t _exitStepStart;
 };
 
 #endif // FEED_HOLD_MANAGER_H
@@ -3,6 +3,7 @@
 #include <SD.h>
 #include "Config.h"
 #include "FileManager.h"
+#include "Log.h"
 
 FileManager& FileManager::Instance() {
     static FileManager inst;
@@ -10,13 +11,14 @@ FileManager& FileManager::Instance() {
 }
 
 bool FileManager::init() {
-    // Mirror the ReadWrite example:
-    Serial.print("Initializing SD card...");
+    // Mirror the ReadWrite example. CutRecorder calls this at run time too,
+    // so only a failure is worth more than a debug line.
+    LOG_DEBUG(Sys, "[SD] Initializing SD card");
     if (!SD.begin()) {
-        Serial.println("initialization failed!");
+        LOG_WARN(Sys, "[SD] Initialization failed");
         return false;
     }
-    Serial.println("initialization done.");
+    LOG_DEBUG(Sys, "[SD] Initialization done");
     return true;
 }
 
@@ -24,13 +26,11 @@ bool FileManager::loadSettings(Settings& s) {
     // Ensure the card is up
     if (!init()) return false;
 
-    Serial.print("Opening ");
-    Serial.print(SETTINGS_FILE);
-    Serial.println(" for read...");
+    LOG_DEBUG(Sys, "[SD] Opening ", SETTINGS_FILE, " for read");
 
     File myFile = SD.open(SETTINGS_FILE, FILE_READ);
     if (!myFile) {
-        Serial.println("error opening settings file");
+        LOG_ERROR(Sys, "[SD] Error opening settings file");
         return false;
     }
 
@@ -54,24 +54,22 @@ bool FileManager::loadSettings(Settings& s) {
         s.feedRate = vals[3];
         s.rapidRate = vals[4];
         s.manualOverrideRPM = vals[5];
-        Serial.println("Settings loaded from SD");
+        LOG_INFO(Sys, "[SD] Settings loaded");
         return true;
     }
 
-    Serial.println("Settings parse error");
+    LOG_WARN(Sys, "[SD] Settings parse error");
     return false;
 }
 
 bool FileManager::saveSettings(const Settings& s) {
     if (!init()) return false;
 
-    Serial.print("Opening ");
-    Serial.print(SETTINGS_FILE);
-    Serial.println(" for write...");
+    LOG_DEBUG(Sys, "[SD] Opening ", SETTINGS_FILE, " for write");
 
     File myFile = SD.open(SETTINGS_FILE, FILE_WRITE);
     if (!myFile) {
-        Serial.println("error opening settings file for write");
+        LOG_ERROR(Sys, "[SD] Error opening settings file for write");
         return false;
     }
 
@@ -84,6 +82,6 @@ bool FileManager::saveSettings(const Settings& s) {
     myFile.print(s.manualOverrideRPM); myFile.println();
 
     myFile.close();
-    Serial.println("Settings saved to SD");
+    LOG_INFO(Sys, "[SD] Settings saved");
     return true;
 }
@@ -2,6 +2,7 @@
 // HomingHelper.cpp
 #include "HomingHelper.h"
 #include "ScreenManager.h"
+#include "Log.h"
 #include <ClearCore.h>
 
 HomingHelper::HomingHelper(const HomingParams& p)
@@ -52,7 +53,7 @@ void HomingHelper::process() {
 
     // Global timeout
     if (now - _stamp > _p.timeoutMs) {
-        ClearCore::ConnectorUsb.SendLine("[Homing] TIMEOUT  aborting");
+        LOG_ERROR(Homing, "[Homing] TIMEOUT  aborting");
         ScreenManager::Instance().ShowManualMode();
         _state = State::Failed;
         return;
@@ -63,23 +64,17 @@ void HomingHelper::process() {
         uint32_t elapsed = now - _startTime;
         switch (_state) {
         case State::FastApproach:
-            ClearCore::ConnectorUsb.Send("[Homing][+"); ClearCore::ConnectorUsb.Send(elapsed);
-            ClearCore::ConnectorUsb.SendLine("ms] FastApproach"); break;
+            LOG_INFO(Homing, "[Homing][+", elapsed, "ms] FastApproach"); break;
         case State::Dwell:
-            ClearCore::ConnectorUsb.Send("[Homing][+"); ClearCore::ConnectorUsb.Send(elapsed);
-            ClearCore::ConnectorUsb.SendLine("ms] Dwell"); break;
+            LOG_INFO(Homing, "[Homing][+", elapsed, "ms] Dwell"); break;
         case State::SlowApproach:
-            ClearCore::ConnectorUsb.Send("[Homing][+"); ClearCore::ConnectorUsb.Send(elapsed);
-            ClearCore::ConnectorUsb.SendLine("ms] SlowApproach"); break;
+            LOG_INFO(Homing, "[Homing][+", elapsed, "ms] SlowApproach"); break;
         case State::WaitForStop:
-            ClearCore::ConnectorUsb.Send("[Homing][+"); ClearCore::ConnectorUsb.Send(elapsed);
-            ClearCore::ConnectorUsb.SendLine("ms] WaitForStop"); break;
+            LOG_INFO(Homing, "[Homing][+", elapsed, "ms] WaitForStop"); break;
         case State::Backoff:
-            ClearCore::ConnectorUsb.Send("[Homing][+"); ClearCore::ConnectorUsb.Send(elapsed);
-            ClearCore::ConnectorUsb.SendLine("ms] Backoff"); break;
+            LOG_INFO(Homing, "[Homing][+", elapsed, "ms] Backoff"); break;
         case State::Finalize:
-            ClearCore::ConnectorUsb.Send("[Homing][+"); ClearCore::ConnectorUsb.Send(elapsed);
-            ClearCore::ConnectorUsb.SendLine("ms] Finalize"); break;
+            LOG_INFO(Homing, "[Homing][+", elapsed, "ms] Finalize"); break;
         default: break;
         }
         _lastState = _state;
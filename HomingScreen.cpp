@@ -1,6 +1,8 @@
 // core/HomingScreen.cpp
 #include "HomingScreen.h"
+#include "LatencyProfiler.h"
 #include "Config.h"
+#include "Log.h"
 #include "ScreenManager.h"
 #include <ClearCore.h>
 #include "MotionController.h"
@@ -13,6 +15,8 @@ static bool gHomingDelayDone = false;
 static bool gHomingSequenceStarted = false;
 static bool gXHomingComplete = false;
 static bool gYHomingComplete = false;
+static uint32_t gXHomedTime = 0;
+static constexpr uint32_t gAxisPauseMs = 500;     // brief pause between axes
 
 void HomingScreen::onShow() {
     _xDone = false;
@@ -22,10 +26,11 @@ void HomingScreen::onShow() {
     gXHomingComplete = false;
     gYHomingComplete = false;
     gHomingStartTime = ClearCore::TimingMgr.Milliseconds();
-    ClearCore::ConnectorUsb.SendLine("[HOMING] Waiting 2 seconds before homing move");
+    LOG_INFO(Homing, "[HOMING] Waiting 2 seconds before homing move");
 }
 
 void HomingScreen::update() {
+    LATENCY_PROBE("screen.homing");
     uint32_t now = ClearCore::TimingMgr.Milliseconds();
     auto& mc = MotionController::Instance();
 
@@ -33,7 +38,7 @@ void HomingScreen::update() {
     if (!gHomingDelayDone) {
         if (now - gHomingStartTime >= gHomingDelayMs) {
             gHomingDelayDone = true;
-            ClearCore::ConnectorUsb.SendLine("[HOMING] Delay elapsed, starting sequential homing");
+            LOG_INFO(Homing, "[HOMING] Delay elapsed, starting sequential homing");
             gHomingSequenceStarted = true;
         }
         return;
@@ -44,7 +49,7 @@ void HomingScreen::update() {
         // Home X first
         if (!gXHomingComplete) {
             if (!_xDone) {
-                ClearCore::ConnectorUsb.SendLine("[HOMING] Starting X-axis homing");
+                LOG_INFO(Homing, "[HOMING] Starting X-axis homing");
                 mc.StartHomingAxis(AXIS_X);
                 _xDone = true;  // Mark as started
             }
@@ -53,14 +58,15 @@ void HomingScreen::update() {
             MotionController::MotionStatus status = mc.getStatus();
             if (status.xHomed) {
                 gXHomingComplete = true;
-                ClearCore::ConnectorUsb.SendLine("[HOMING] X axis homing complete");
-                Delay_ms(500);  // Give a brief pause between axes
+                LOG_INFO(Homing, "[HOMING] X axis homing complete");
+                gXHomedTime = now;  // Y starts after a brief pause
             }
         }
         // Once X is done, start Y
         else if (!gYHomingComplete) {
             if (!_yDone) {
-                ClearCore::ConnectorUsb.SendLine("[HOMING] Starting Y-axis homing");
+                if (now - gXHomedTime < gAxisPauseMs) return;
+                LOG_INFO(Homing, "[HOMING] Starting Y-axis homing");
                 mc.StartHomingAxis(AXIS_Y);
                 _yDone = true;  // Mark as started
             }
@@ -69,17 +75,17 @@ void HomingScreen::update() {
             MotionController::MotionStatus status = mc.getStatus();
             if (status.yHomed) {
                 gYHomingComplete = true;
-                ClearCore::ConnectorUsb.SendLine("[HOMING] Y axis homing complete");
+                LOG_INFO(Homing, "[HOMING] Y axis homing complete");
             }
         }
 
         // If both are complete, continue to manual mode
         if (gXHomingComplete && gYHomingComplete) {
-            ClearCore::ConnectorUsb.SendLine("[HOMING] Both axes homed  returning to Manual Mode");
+            LOG_INFO(Homing, "[HOMING] Both axes homed  returning to Manual Mode");
             
             // Reset encoder position tracking after all axes complete homing
             EncoderPositionTracker::Instance().resetPositionAfterHoming();
-            ClearCore::ConnectorUsb.SendLine("[HomingScreen] All axes homed, encoder positions reset");
+            LOG_INFO(Homing, "[HomingScreen] All axes homed, encoder positions reset");
 
             ScreenManager::Instance().ShowManualMode();
         }
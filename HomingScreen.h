@@ -9,7 +9,6 @@ class HomingScreen : public Screen {
 public:
     void onShow() override;
     void onHide() override {}
-    void handleEvent(const genieFrame&) override {}
     void update() override;
 
 private:
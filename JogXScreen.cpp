@@ -1,4 +1,7 @@
 #include "JogXScreen.h"
+#include "DisplayModel.h"
+#include "DisplayValue.h"
+#include "LatencyProfiler.h"
 #include "MotionController.h"
 #include "ScreenManager.h"
 #include "UIInputManager.h"
@@ -7,6 +10,7 @@
 #include "JogUtilities.h"
 #include <cmath>
 #include "Config.h"
+#include "Log.h"
 #include <vector>
 #include "CutSequenceController.h"
 
@@ -14,12 +18,30 @@
 #define LED_NEGATIVE_INDICATOR 0
 #endif
 
-extern Genie genie;
-
 float JogXScreen::m_cutThickness = 0.0f; // Initialize static member
+float JogXScreen::_tempSlices = 10.0f;
 
 JogXScreen::JogXScreen(ScreenManager& mgr) : _mgr(mgr) {}
 
+// Capture zero and the MPG jog button follow the machine, so onShow() sets them
+static const Screen::FieldInit JOG_X_INITIAL[] = {
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_CAPTURE_STOCK_LENGTH, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_CAPTURE_INCREMENT, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_INC_PLUS, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_INC_MINUS, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_DIVIDE_SET, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_STOCK_LENGTH, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_CUT_THICKNESS, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_TOTAL_SLICES, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_GO_TO_ZERO, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_STOCK_SLICES_X_INC, 0 },
+};
+
+const Screen::FieldInit* JogXScreen::initialState(uint8_t& count) const {
+    count = sizeof(JOG_X_INITIAL) / sizeof(JOG_X_INITIAL[0]);
+    return JOG_X_INITIAL;
+}
+
 void JogXScreen::onShow() {
     // Setup MPG mode
     MPGJogManager::Instance().setEnabled(true);
@@ -39,7 +61,7 @@ void JogXScreen::onHide() {
     }
 
     // Only use GENIE_OBJ_LED, not USER_LED
-    genie.WriteObject(GENIE_OBJ_LED, LED_NEGATIVE_INDICATOR, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_NEGATIVE_INDICATOR, 0);
 
     UIInputManager::Instance().unbindField();
 }
@@ -51,24 +73,15 @@ void JogXScreen::updatePositionDisplay() {
     float current = MotionController::Instance().getAbsoluteAxisPosition(AXIS_X);
 
     float display = cutData.useStockZero ? (current - cutData.positionZero) : current;
-    bool negative = (display < 0.0f);
+    bool negative = DisplayValue::toScaled(display, LEDDIGITS_SAW_POSITION) < 0;
     static bool lastNeg = false;
 
-    // Only use GENIE_OBJ_LED, not USER_LED
-    genie.WriteObject(GENIE_OBJ_LED, LED_NEGATIVE_INDICATOR, negative ? 1 : 0);
-
     if (negative != lastNeg) {
         lastNeg = negative;
-        ClearCore::ConnectorUsb.Send("Position: ");
-        ClearCore::ConnectorUsb.Send(display);
-        ClearCore::ConnectorUsb.Send(" Absolute: ");
-        ClearCore::ConnectorUsb.Send(current);
-        ClearCore::ConnectorUsb.Send(" isNegative: ");
-        ClearCore::ConnectorUsb.SendLine(negative ? "YES" : "NO");
+        LOG_INFO(UI, "Position: ", display, " Absolute: ", current,
+            " isNegative: ", negative ? "YES" : "NO");
     }
-    int32_t scaled = static_cast<int32_t>(round(fabs(display) * 1000.0f));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_SAW_POSITION,
-        static_cast<uint16_t>(scaled));
+    DisplayValue::showSigned(LEDDIGITS_SAW_POSITION, LED_NEGATIVE_INDICATOR, display);
 }
 
 void JogXScreen::setStockSlicesTimesIncrement() {
@@ -77,33 +90,21 @@ void JogXScreen::setStockSlicesTimesIncrement() {
     // Skip if increment is zero or invalid
     if (cutData.increment <= 0.0f || cutData.totalSlices <= 0) {
         // Visual feedback for invalid operation
-        showButtonSafe(WINBUTTON_SET_STOCK_SLICES_X_INC, 1);
-        delay(50);
-        showButtonSafe(WINBUTTON_SET_STOCK_SLICES_X_INC, 0);
-        delay(50);
-        showButtonSafe(WINBUTTON_SET_STOCK_SLICES_X_INC, 1);
-        delay(50);
-        showButtonSafe(WINBUTTON_SET_STOCK_SLICES_X_INC, 0);
+        blinkButton(WINBUTTON_SET_STOCK_SLICES_X_INC);
         return;
     }
 
     // Calculate new stock length by multiplying increment by total slices
     float newStockLength = cutData.increment * cutData.totalSlices;
 
-    ClearCore::ConnectorUsb.Send("Setting stock length to: ");
-    ClearCore::ConnectorUsb.Send(cutData.increment);
-    ClearCore::ConnectorUsb.Send(" x ");
-    ClearCore::ConnectorUsb.Send(cutData.totalSlices);
-    ClearCore::ConnectorUsb.Send(" = ");
-    ClearCore::ConnectorUsb.SendLine(newStockLength);
+    LOG_INFO(UI, "Setting stock length to: ", cutData.increment, " x ", cutData.totalSlices,
+        " = ", newStockLength);
 
     // Set the new stock length
     cutData.stockLength = newStockLength;
 
     // Visual feedback for successful operation
-    showButtonSafe(WINBUTTON_SET_STOCK_SLICES_X_INC, 1);
-    delay(200);
-    showButtonSafe(WINBUTTON_SET_STOCK_SLICES_X_INC, 0);
+    flashButton(WINBUTTON_SET_STOCK_SLICES_X_INC);
 
     // Update displays
     updateStockLengthDisplay();
@@ -111,150 +112,108 @@ void JogXScreen::setStockSlicesTimesIncrement() {
     updateSliceCounterDisplay();
 }
 
-void JogXScreen::handleEvent(const genieFrame& e) {
-    if (e.reportObject.cmd != GENIE_REPORT_EVENT || e.reportObject.object != GENIE_OBJ_WINBUTTON)
+void JogXScreen::incrementPlus() {
+    JogUtilities::Increment(_mgr.GetCutData(), AXIS_X);
+    flashButton(WINBUTTON_INC_PLUS, 100);
+}
+
+void JogXScreen::incrementMinus() {
+    auto& cutData = _mgr.GetCutData();
+    // Use absolute position from encoder tracker
+    float cur = MotionController::Instance().getAbsoluteAxisPosition(AXIS_X);
+    MotionController::Instance().moveTo(AXIS_X, cur - cutData.increment, 1.0f);
+    flashButton(WINBUTTON_INC_MINUS, 100);
+}
+
+void JogXScreen::divideStock() {
+    auto& cutData = _mgr.GetCutData();
+    if (cutData.totalSlices <= 0 || cutData.stockLength <= 0.0f) {
+        blinkButton(WINBUTTON_DIVIDE_SET);
         return;
+    }
+    setIncrement(cutData.stockLength / cutData.totalSlices);
+    flashButton(WINBUTTON_DIVIDE_SET);
+}
 
+void JogXScreen::toggleJog() {
+    auto& mpg = MPGJogManager::Instance();
+    bool enabled = !mpg.isEnabled();
+    mpg.setEnabled(enabled);
+    mpg.setAxis(AXIS_X);
+
+    // Reset the encoder baseline so the first jog has no phantom jump
+    UIInputManager::Instance().resetRaw();
+    showButtonSafe(WINBUTTON_ACTIVATE_JOG, enabled ? 1 : 0);
+}
+
+void JogXScreen::stopJogForEdit() {
+    auto& mpg = MPGJogManager::Instance();
+    if (mpg.isEnabled()) {
+        mpg.setEnabled(false);
+        showButtonSafe(WINBUTTON_ACTIVATE_JOG, 0);
+    }
+}
+
+void JogXScreen::editStockLength() {
     auto& cutData = _mgr.GetCutData();
     auto& ui = UIInputManager::Instance();
-    auto& mpg = MPGJogManager::Instance();
-    static float tempSlices = 10.0f;
-    float newIncrement;
-
-    switch (e.reportObject.index) {
-    case WINBUTTON_CAPTURE_ZERO:
-        captureZero();
-        break;
-
-    case WINBUTTON_CAPTURE_STOCK_LENGTH:
-        captureStockLength();
-        break;
-
-    case WINBUTTON_CAPTURE_INCREMENT:
-        captureIncrement();
-        break;
-
-    case WINBUTTON_INC_PLUS: {
-        // Replace old code with JogUtilities::Increment
-        JogUtilities::Increment(cutData, AXIS_X);
-        showButtonSafe(WINBUTTON_INC_PLUS, 1);
-        delay(100);
-        showButtonSafe(WINBUTTON_INC_PLUS, 0);
-        break;
+
+    if (ui.isEditing() && ui.isFieldActive(WINBUTTON_SET_STOCK_LENGTH)) {
+        ui.unbindField();
+        showButtonSafe(WINBUTTON_SET_STOCK_LENGTH, 0);
+        calculateTotalSlices();
+        updateTotalSlicesDisplay();
+        updateSliceCounterDisplay();
     }
+    else if (!ui.isEditing()) {
+        stopJogForEdit();
+        ui.bindField(WINBUTTON_SET_STOCK_LENGTH, LEDDIGITS_STOCK_LENGTH,
+            &cutData.stockLength, 0.0f, 100.0f, 0.001f);
+        showButtonSafe(WINBUTTON_SET_STOCK_LENGTH, 1);
+    }
+}
 
-    case WINBUTTON_INC_MINUS: {
-        // Use absolute position from encoder tracker
-        float cur = MotionController::Instance().getAbsoluteAxisPosition(AXIS_X);
-        MotionController::Instance().moveTo(AXIS_X, cur - cutData.increment, 1.0f);
-        showButtonSafe(WINBUTTON_INC_MINUS, 1);
-        delay(100);
-        showButtonSafe(WINBUTTON_INC_MINUS, 0);
-        break;
+void JogXScreen::editCutThickness() {
+    auto& cutData = _mgr.GetCutData();
+    auto& ui = UIInputManager::Instance();
+
+    if (ui.isEditing() && ui.isFieldActive(WINBUTTON_SET_CUT_THICKNESS)) {
+        ui.unbindField();
+        showButtonSafe(WINBUTTON_SET_CUT_THICKNESS, 0);
+        if (cutData.thickness < 0.0f) cutData.thickness = 0.0f;
+        float blade = SettingsManager::Instance().settings().bladeThickness;
+        setIncrement(cutData.thickness + blade);
+    }
+    else if (!ui.isEditing()) {
+        stopJogForEdit();
+        if (cutData.thickness < 0.0f) cutData.thickness = 0.0f;
+        DisplayValue::show(LEDDIGITS_CUT_THICKNESS, cutData.thickness);
+        ui.bindField(WINBUTTON_SET_CUT_THICKNESS, LEDDIGITS_CUT_THICKNESS,
+            &cutData.thickness, 0.0f, 10.0f, 0.001f);
+        showButtonSafe(WINBUTTON_SET_CUT_THICKNESS, 1);
     }
+}
 
-    case WINBUTTON_GO_TO_ZERO:
-        goToZero();
-        break;
-
-    case WINBUTTON_DIVIDE_SET:
-        if (cutData.totalSlices <= 0 || cutData.stockLength <= 0.0f) {
-            for (int i = 0; i < 2; ++i) {
-                showButtonSafe(WINBUTTON_DIVIDE_SET, 1);
-                delay(50);
-                showButtonSafe(WINBUTTON_DIVIDE_SET, 0);
-                delay(50);
-            }
-            break;
-        }
-        newIncrement = cutData.stockLength / cutData.totalSlices;
-        setIncrement(newIncrement);
-        showButtonSafe(WINBUTTON_DIVIDE_SET, 1);
-        delay(200);
-        showButtonSafe(WINBUTTON_DIVIDE_SET, 0);
-        break;
-
-    case WINBUTTON_SET_STOCK_SLICES_X_INC:
-        setStockSlicesTimesIncrement();
-        break;
-
-    case WINBUTTON_ACTIVATE_JOG:
-        if (mpg.isEnabled()) {
-            mpg.setEnabled(false);
-            showButtonSafe(WINBUTTON_ACTIVATE_JOG, 0);
-        }
-        else {
-            mpg.setEnabled(true);
-            mpg.setAxis(AXIS_X);
-            showButtonSafe(WINBUTTON_ACTIVATE_JOG, 1);
-        }
-        break;
-
-    case WINBUTTON_SET_STOCK_LENGTH:
-        if (ui.isEditing() && ui.isFieldActive(WINBUTTON_SET_STOCK_LENGTH)) {
-            ui.unbindField();
-            showButtonSafe(WINBUTTON_SET_STOCK_LENGTH, 0);
-            calculateTotalSlices();
-            updateTotalSlicesDisplay();
-            updateSliceCounterDisplay();
-        }
-        else if (!ui.isEditing()) {
-            if (mpg.isEnabled()) {
-                mpg.setEnabled(false);
-                showButtonSafe(WINBUTTON_ACTIVATE_JOG, 0);
-            }
-            ui.bindField(WINBUTTON_SET_STOCK_LENGTH, LEDDIGITS_STOCK_LENGTH,
-                &cutData.stockLength, 0.0f, 100.0f, 0.001f, 3);
-            showButtonSafe(WINBUTTON_SET_STOCK_LENGTH, 1);
-        }
-        break;
-
-    case WINBUTTON_SET_CUT_THICKNESS:
-        if (ui.isEditing() && ui.isFieldActive(WINBUTTON_SET_CUT_THICKNESS)) {
-            ui.unbindField();
-            showButtonSafe(WINBUTTON_SET_CUT_THICKNESS, 0);
-            if (cutData.thickness < 0.0f) cutData.thickness = 0.0f;
-            float blade = SettingsManager::Instance().settings().bladeThickness;
-            newIncrement = cutData.thickness + blade;
-            setIncrement(newIncrement);
-        }
-        else if (!ui.isEditing()) {
-            if (mpg.isEnabled()) {
-                mpg.setEnabled(false);
-                showButtonSafe(WINBUTTON_ACTIVATE_JOG, 0);
-            }
-            if (cutData.thickness < 0.0f) cutData.thickness = 0.0f;
-            int32_t scaled = static_cast<int32_t>(round(cutData.thickness * 1000.0f));
-            genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_CUT_THICKNESS, static_cast<uint16_t>(scaled));
-            ui.bindField(WINBUTTON_SET_CUT_THICKNESS, LEDDIGITS_CUT_THICKNESS,
-                &cutData.thickness, 0.0f, 10.0f, 0.001f, 3);
-            showButtonSafe(WINBUTTON_SET_CUT_THICKNESS, 1);
-        }
-        break;
-
-    case WINBUTTON_SET_TOTAL_SLICES:
-        if (ui.isEditing() && ui.isFieldActive(WINBUTTON_SET_TOTAL_SLICES)) {
-            cutData.totalSlices = static_cast<int>(roundf(tempSlices));
-            ui.unbindField();
-            showButtonSafe(WINBUTTON_SET_TOTAL_SLICES, 0);
-            
-            // RESET POSITION TRACKING when total slices changes
-            CutSequenceController::Instance().reset();
-            ClearCore::ConnectorUsb.SendLine("Position tracking reset due to total slices change");
-        }
-        else if (!ui.isEditing()) {
-            if (mpg.isEnabled()) {
-                mpg.setEnabled(false);
-                showButtonSafe(WINBUTTON_ACTIVATE_JOG, 0);
-            }
-            tempSlices = (cutData.totalSlices > 0 ? cutData.totalSlices : 10);
-            genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_TOTAL_SLICES,
-                static_cast<uint16_t>(tempSlices));
-            ui.bindField(WINBUTTON_SET_TOTAL_SLICES, LEDDIGITS_TOTAL_SLICES,
-                &tempSlices, 1.0f, 1000.0f, 1.0f, 0);
-            showButtonSafe(WINBUTTON_SET_TOTAL_SLICES, 1);
-        }
-        break;
+void JogXScreen::editTotalSlices() {
+    auto& cutData = _mgr.GetCutData();
+    auto& ui = UIInputManager::Instance();
+
+    if (ui.isEditing() && ui.isFieldActive(WINBUTTON_SET_TOTAL_SLICES)) {
+        cutData.totalSlices = DisplayValue::toScaled(_tempSlices, LEDDIGITS_TOTAL_SLICES);
+        ui.unbindField();
+        showButtonSafe(WINBUTTON_SET_TOTAL_SLICES, 0);
+
+        // RESET POSITION TRACKING when total slices changes
+        CutSequenceController::Instance().reset();
+        LOG_INFO(UI, "Position tracking reset due to total slices change");
+    }
+    else if (!ui.isEditing()) {
+        stopJogForEdit();
+        _tempSlices = (cutData.totalSlices > 0 ? cutData.totalSlices : 10);
+        DisplayValue::show(LEDDIGITS_TOTAL_SLICES, _tempSlices);
+        ui.bindField(WINBUTTON_SET_TOTAL_SLICES, LEDDIGITS_TOTAL_SLICES,
+            &_tempSlices, 1.0f, 1000.0f, 1.0f);
+        showButtonSafe(WINBUTTON_SET_TOTAL_SLICES, 1);
     }
 }
 
@@ -265,16 +224,15 @@ void JogXScreen::captureZero() {
     if (cutData.useStockZero) {
         // Use absolute position from encoder tracker
         cutData.positionZero = MotionController::Instance().getAbsoluteAxisPosition(AXIS_X);
-        ClearCore::ConnectorUsb.Send("Zero position captured (absolute): ");
-        ClearCore::ConnectorUsb.SendLine(cutData.positionZero);
+        LOG_INFO(UI, "Zero position captured (absolute): ", cutData.positionZero);
         showButtonSafe(WINBUTTON_CAPTURE_ZERO, 1);
         
         // RESET POSITION TRACKING when zero changes
         CutSequenceController::Instance().reset();
-        ClearCore::ConnectorUsb.SendLine("Position tracking reset due to zero position change");
+        LOG_INFO(UI, "Position tracking reset due to zero position change");
     }
     else {
-        ClearCore::ConnectorUsb.SendLine("Zero offset removed, reverting to machine coordinates");
+        LOG_INFO(UI, "Zero offset removed, reverting to machine coordinates");
         showButtonSafe(WINBUTTON_CAPTURE_ZERO, 0);
     }
     updatePositionDisplay();
@@ -284,15 +242,13 @@ void JogXScreen::goToZero() {
     auto& cutData = _mgr.GetCutData();
     if (cutData.useStockZero) {
         MotionController::Instance().moveToWithRate(AXIS_X, cutData.positionZero, 0.5f);
-        ClearCore::ConnectorUsb.SendLine("Moving to captured zero position");
+        LOG_INFO(UI, "Moving to captured zero position");
     }
     else {
         MotionController::Instance().moveToWithRate(AXIS_X, 0.0f, 0.5f);
-        ClearCore::ConnectorUsb.SendLine("Moving to absolute machine zero");
+        LOG_INFO(UI, "Moving to absolute machine zero");
     }
-    showButtonSafe(WINBUTTON_GO_TO_ZERO, 1);
-    delay(200);
-    showButtonSafe(WINBUTTON_GO_TO_ZERO, 0);
+    flashButton(WINBUTTON_GO_TO_ZERO);
 }
 
 void JogXScreen::captureStockLength() {
@@ -303,20 +259,16 @@ void JogXScreen::captureStockLength() {
 
     float display = cutData.useStockZero ? (current - cutData.positionZero) : current;
     if (display < 0.0f) {
-        ClearCore::ConnectorUsb.SendLine("Error: Cannot capture stock length when negative");
-        showButtonSafe(WINBUTTON_CAPTURE_STOCK_LENGTH, 1);
-        delay(50); showButtonSafe(WINBUTTON_CAPTURE_STOCK_LENGTH, 0);
-        delay(50); showButtonSafe(WINBUTTON_CAPTURE_STOCK_LENGTH, 1);
-        delay(50); showButtonSafe(WINBUTTON_CAPTURE_STOCK_LENGTH, 0);
+        LOG_ERROR(UI, "Error: Cannot capture stock length when negative");
+        blinkButton(WINBUTTON_CAPTURE_STOCK_LENGTH);
         return;
     }
     cutData.stockLength = display;
-    showButtonSafe(WINBUTTON_CAPTURE_STOCK_LENGTH, 1);
-    delay(200); showButtonSafe(WINBUTTON_CAPTURE_STOCK_LENGTH, 0);
+    flashButton(WINBUTTON_CAPTURE_STOCK_LENGTH);
     
     // RESET POSITION TRACKING when stock length changes
     CutSequenceController::Instance().reset();
-    ClearCore::ConnectorUsb.SendLine("Position tracking reset due to stock length change");
+    LOG_INFO(UI, "Position tracking reset due to stock length change");
     
     updateStockLengthDisplay();
     calculateTotalSlices();
@@ -332,15 +284,11 @@ void JogXScreen::captureIncrement() {
 
     float display = cutData.useStockZero ? (current - cutData.positionZero) : current;
     if (display < 0.0f) {
-        ClearCore::ConnectorUsb.SendLine("Error: Cannot capture increment when negative");
-        showButtonSafe(WINBUTTON_CAPTURE_INCREMENT, 1);
-        delay(50); showButtonSafe(WINBUTTON_CAPTURE_INCREMENT, 0);
-        delay(50); showButtonSafe(WINBUTTON_CAPTURE_INCREMENT, 1);
-        delay(50); showButtonSafe(WINBUTTON_CAPTURE_INCREMENT, 0);
+        LOG_ERROR(UI, "Error: Cannot capture increment when negative");
+        blinkButton(WINBUTTON_CAPTURE_INCREMENT);
         return;
     }
-    showButtonSafe(WINBUTTON_CAPTURE_INCREMENT, 1);
-    delay(200); showButtonSafe(WINBUTTON_CAPTURE_INCREMENT, 0);
+    flashButton(WINBUTTON_CAPTURE_INCREMENT);
     setIncrement(fabs(display));
 }
 
@@ -354,15 +302,13 @@ void JogXScreen::calculateTotalSlices() {
 
 void JogXScreen::setIncrement(float newIncrement) {
     auto& cutData = _mgr.GetCutData();
-    ClearCore::ConnectorUsb.SendLine("--------- SET INCREMENT ---------");
-    ClearCore::ConnectorUsb.Send("Previous increment: ");
-    ClearCore::ConnectorUsb.SendLine(cutData.increment);
-    ClearCore::ConnectorUsb.Send("New increment (raw): ");
-    ClearCore::ConnectorUsb.SendLine(newIncrement);
+    LOG_INFO(UI, "--------- SET INCREMENT ---------");
+    LOG_INFO(UI, "Previous increment: ", cutData.increment);
+    LOG_INFO(UI, "New increment (raw): ", newIncrement);
 
     if (newIncrement < 0.001f) {
         newIncrement = 0.001f;
-        ClearCore::ConnectorUsb.SendLine("WARNING: Minimum increment enforced");
+        LOG_WARN(UI, "WARNING: Minimum increment enforced");
     }
 
     cutData.increment = newIncrement;
@@ -370,38 +316,34 @@ void JogXScreen::setIncrement(float newIncrement) {
     cutData.thickness = cutData.increment - bladeThickness;
     if (cutData.thickness < 0.0f) {
         cutData.thickness = 0.0f;
-        ClearCore::ConnectorUsb.SendLine("WARNING: Cut thickness negative, set to 0");
+        LOG_WARN(UI, "WARNING: Cut thickness negative, set to 0");
     }
-    ClearCore::ConnectorUsb.Send("Calculated thickness: ");
-    ClearCore::ConnectorUsb.SendLine(cutData.thickness);
+    LOG_INFO(UI, "Calculated thickness: ", cutData.thickness);
 
     calculateTotalSlices();
-    ClearCore::ConnectorUsb.Send("Calculated total slices: ");
-    ClearCore::ConnectorUsb.SendLine(cutData.totalSlices);
+    LOG_INFO(UI, "Calculated total slices: ", cutData.totalSlices);
 
     // RESET POSITION TRACKING when increment changes
     CutSequenceController::Instance().reset();
-    ClearCore::ConnectorUsb.SendLine("Position tracking reset due to increment change");
+    LOG_INFO(UI, "Position tracking reset due to increment change");
 
     updateIncrementDisplay();
     updateThicknessDisplay();
     updateTotalSlicesDisplay();
     updateSliceCounterDisplay();
 
-    ClearCore::ConnectorUsb.SendLine("--------- SET INCREMENT COMPLETE ---------");
+    LOG_INFO(UI, "--------- SET INCREMENT COMPLETE ---------");
 }
 
 void JogXScreen::updateStockLengthDisplay() {
     auto& cutData = _mgr.GetCutData();
-    int32_t scaled = static_cast<int32_t>(round(cutData.stockLength * 1000.0f));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_STOCK_LENGTH, static_cast<uint16_t>(scaled));
+    DisplayValue::show(LEDDIGITS_STOCK_LENGTH, cutData.stockLength);
 }
 
 void JogXScreen::updateIncrementDisplay() {
     auto& cutData = _mgr.GetCutData();
     if (cutData.increment < 0.001f) cutData.increment = 0.001f;
-    int32_t scaled = static_cast<int32_t>(round(cutData.increment * 1000.0f));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_INCREMENT, static_cast<uint16_t>(scaled));
+    DisplayValue::show(LEDDIGITS_INCREMENT, cutData.increment);
 }
 
 // Updated to show thickness on all screens
@@ -413,22 +355,23 @@ void JogXScreen::updateThicknessDisplay() {
     // Store in static member for access by other screens
     m_cutThickness = cutData.thickness;
 
-    ClearCore::ConnectorUsb.Send("Updating thickness display to: ");
-    ClearCore::ConnectorUsb.SendLine(cutData.thickness);
-
-    // Calculate scaled value once
-    int32_t scaled = static_cast<int32_t>(round(cutData.thickness * 1000.0f));
-    uint16_t scaledValue = static_cast<uint16_t>(scaled);
+    LOG_INFO(UI, "Updating thickness display to: ", cutData.thickness);
 
     // Update all thickness displays across different forms
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_CUT_THICKNESS, scaledValue); // Form 1 (JogX)
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_THICKNESS_F2, scaledValue);  // Form 2 (SemiAuto)
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_THICKNESS_F5, scaledValue);  // Form 5 (AutoCut)
+    DisplayValue::show(LEDDIGITS_CUT_THICKNESS, cutData.thickness);    // Form 1 (JogX)
+    DisplayValue::show(LEDDIGITS_THICKNESS_F2, cutData.thickness);     // Form 2 (SemiAuto)
+    DisplayValue::show(LEDDIGITS_THICKNESS_F5, cutData.thickness);     // Form 5 (AutoCut)
 }
 
 void JogXScreen::updateTotalSlicesDisplay() {
     auto& cutData = _mgr.GetCutData();
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_TOTAL_SLICES, static_cast<uint16_t>(cutData.totalSlices));
+    DisplayValue::showCount(LEDDIGITS_TOTAL_SLICES, cutData.totalSlices);
+
+    // A planned cut list ('plan' on the USB console) stands until 'plan clear'
+    if (CutSequenceController::Instance().hasPlannedList()) {
+        LOG_INFO(UI, "Planned cut list loaded - uniform slices apply after 'plan clear'");
+        return;
+    }
 
     // Ensure CutSequenceController is rebuilt with the correct number of increments
     float stockZero = cutData.useStockZero ? cutData.positionZero : 0.0f;
@@ -445,7 +388,7 @@ void JogXScreen::updateSliceCounterDisplay() {
     int available = 0;
     if (cutData.increment > 0.0f)
         available = static_cast<int>(floorf(cutData.stockLength / cutData.increment));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_SLICE_COUNTER, static_cast<uint16_t>(available));
+    DisplayValue::showCount(LEDDIGITS_SLICE_COUNTER, available);
 }
 
 void JogXScreen::updateCutSequencePositions() {
@@ -453,13 +396,14 @@ void JogXScreen::updateCutSequencePositions() {
     float stockZero = cutData.useStockZero ? cutData.positionZero : 0.0f;
     float increment = cutData.increment;
     int totalSlices = cutData.totalSlices;
-    // Always rebuild with current values
-    if (increment > 0.0f && totalSlices > 0) {
+    // Rebuild with current values unless a planned list is loaded
+    if (increment > 0.0f && totalSlices > 0 && !CutSequenceController::Instance().hasPlannedList()) {
         CutSequenceController::Instance().buildXPositions(stockZero, increment, totalSlices);
     }
 }
 
 void JogXScreen::update() {
+    LATENCY_PROBE("screen.jogX");
     updatePositionDisplay();
     static uint32_t last = 0;
     uint32_t now = ClearCore::TimingMgr.Milliseconds();
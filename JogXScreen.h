@@ -22,8 +22,8 @@ class JogXScreen : public Screen {
 public:
     void onShow() override;
     void onHide() override;
-    void handleEvent(const genieFrame& e) override;
     void update() override;
+    const FieldInit* initialState(uint8_t& count) const override;
     JogXScreen(ScreenManager& mgr);
 
     // Add a static getter for cut thickness (adjust as needed)
@@ -36,14 +36,24 @@ public:
     // Add this to allow external update of the cut sequence positions if needed
     void updateCutSequencePositions();
 
-private:
-    // UI and logic helpers
+    // Button actions, routed here by EventRouter
     void captureZero();
     void captureStockLength();
     void captureIncrement();
-    void calculateTotalSlices();
+    void incrementPlus();
+    void incrementMinus();
+    void goToZero();
+    void divideStock();                  // Increment = stock length / slices
     void setStockSlicesTimesIncrement(); // Button 51 handler
-    void goToZero();  // "Go To Zero" button
+    void toggleJog();
+    void editStockLength();
+    void editCutThickness();
+    void editTotalSlices();
+
+private:
+    // UI and logic helpers
+    void calculateTotalSlices();
+    void stopJogForEdit();
 
     /// Set the global increment, enforce limits, recalc dependents & refresh all displays
     void setIncrement(float newIncrement);
@@ -58,6 +68,7 @@ private:
 
 protected:
     static float m_cutThickness; // Ensure this holds the current cut thickness
+    static float _tempSlices;    // Slice count while it is being edited
 
     ScreenManager& _mgr;
 };
@@ -1,15 +1,15 @@
 
 #include "Config.h"
+#include "DisplayModel.h"
+#include "DisplayValue.h"
+#include "LatencyProfiler.h"
+#include "Log.h"
 #include "MotionController.h"
 #include "MPGJogManager.h"
 #include "UIInputmanager.h"
 #include "screenmanager.h"
 
 
-#ifndef GENIE_OBJ_LEDDIGITS
-#define GENIE_OBJ_LEDDIGITS 15
-#endif
-
 #ifndef GENIE_OBJ_WINBUTTON
 #define GENIE_OBJ_WINBUTTON 10
 #endif
@@ -20,13 +20,23 @@
 
 #define MPG_FIXED_INCREMENT 0.005f
 
-extern Genie genie;
 
 float JogYScreen::_tempLength = 0.0f;
 float JogYScreen::_tempRetract = 0.0f;
 
 JogYScreen::JogYScreen(ScreenManager& mgr) : _mgr(mgr) {}
 
+static const Screen::FieldInit JOG_Y_INITIAL[] = {
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_WITH_MPG_F6, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RETRACT_WITH_MPG_F6, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_ACTIVATE_JOG_Y_F6, 0 },
+};
+
+const Screen::FieldInit* JogYScreen::initialState(uint8_t& count) const {
+    count = sizeof(JOG_Y_INITIAL) / sizeof(JOG_Y_INITIAL[0]);
+    return JOG_Y_INITIAL;
+}
+
 void JogYScreen::onShow() {
     // Reset modes
     _mpgSetLengthMode = false;
@@ -35,12 +45,13 @@ void JogYScreen::onShow() {
     // MPG disabled at start
     MPGJogManager::Instance().setEnabled(false);
 
-    // Let update() handle the rest
+    // Readouts go in the form burst; update() keeps position and LED current
+    updateAllDisplays();
 }
 
 void JogYScreen::onHide() {
     // Clear LED indicators before leaving screen
-    genie.WriteObject(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 0);
 
 
     auto& ui = UIInputManager::Instance();
@@ -55,39 +66,6 @@ void JogYScreen::onHide() {
     }
 }
 
-void JogYScreen::handleEvent(const genieFrame& e) {
-    if (e.reportObject.cmd != GENIE_REPORT_EVENT) return;
-
-    switch (e.reportObject.index) {
-    case WINBUTTON_CAPTURE_CUT_START_F6:
-        captureCutStart();
-        break;
-    case WINBUTTON_CAPTURE_CUT_END_F6:
-        captureCutEnd();
-        break;
-    case WINBUTTON_JOG_TO_START:
-        jogToStartPosition();
-        break;
-    case WINBUTTON_JOG_TO_END:
-        jogToEndPosition();
-        break;
-    case WINBUTTON_JOG_TO_RETRACT:
-        jogToRetractPosition();
-        break;
-    case WINBUTTON_SET_WITH_MPG_F6:
-        setLengthWithMPG();
-        break;
-    case WINBUTTON_SET_RETRACT_WITH_MPG_F6:
-        setRetractWithMPG();
-        break;
-    case WINBUTTON_ACTIVATE_JOG_Y_F6:
-        toggleJogMode();
-        break;
-    default:
-        break;
-    }
-}
-
 void JogYScreen::captureCutStart() {
     auto& cutData = _mgr.GetCutData();
     
@@ -97,16 +75,12 @@ void JogYScreen::captureCutStart() {
     cutData.cutLength = cutData.cutEndPoint - cutData.cutStartPoint;
     if (cutData.cutLength < 0) cutData.cutLength = 0;
 
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_STOCK_END_Y,
-        static_cast<uint16_t>(cutData.cutStartPoint * 1000));
+    DisplayValue::show(LEDDIGITS_STOCK_END_Y, cutData.cutStartPoint);
     updateCutLengthDisplay();
 
-    genie.WriteObject(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 1);
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 1);
 
-    showButtonSafe(WINBUTTON_CAPTURE_CUT_START_F6, 1);
-    delay(200);
-    showButtonSafe(WINBUTTON_CAPTURE_CUT_START_F6, 0);
+    flashButton(WINBUTTON_CAPTURE_CUT_START_F6);
 }
 
 void JogYScreen::captureCutEnd() {
@@ -118,14 +92,10 @@ void JogYScreen::captureCutEnd() {
     cutData.cutLength = cutData.cutEndPoint - cutData.cutStartPoint;
     if (cutData.cutLength < 0) cutData.cutLength = 0;
 
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_CUT_STOP_Y,
-        static_cast<uint16_t>(cutData.cutEndPoint * 1000));
+    DisplayValue::show(LEDDIGITS_CUT_STOP_Y, cutData.cutEndPoint);
     updateCutLengthDisplay();
 
-    showButtonSafe(WINBUTTON_CAPTURE_CUT_END_F6, 1);
-    delay(200);
-    showButtonSafe(WINBUTTON_CAPTURE_CUT_END_F6, 0);
+    flashButton(WINBUTTON_CAPTURE_CUT_END_F6);
 }
 
 void JogYScreen::captureRetractDistance() {
@@ -137,26 +107,20 @@ void JogYScreen::captureRetractDistance() {
     float distance = cutData.cutStartPoint - currentPos;
     cutData.retractDistance = (distance > 0) ? distance : 0.0f;
 
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_RETRACT_DISTANCE,
-        static_cast<uint16_t>(cutData.retractDistance * 1000));
+    DisplayValue::show(LEDDIGITS_RETRACT_DISTANCE, cutData.retractDistance);
 }
 
 void JogYScreen::jogToStartPosition() {
     auto& cutData = _mgr.GetCutData();
     MotionController::Instance().moveToWithRate(AXIS_Y, cutData.cutStartPoint, 0.5f);
-    genie.WriteObject(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 1);
-    showButtonSafe(WINBUTTON_JOG_TO_START, 1);
-    delay(200);
-    showButtonSafe(WINBUTTON_JOG_TO_START, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 1);
+    flashButton(WINBUTTON_JOG_TO_START);
 }
 
 void JogYScreen::jogToEndPosition() {
     auto& cutData = _mgr.GetCutData();
     MotionController::Instance().moveToWithRate(AXIS_Y, cutData.cutEndPoint, 0.5f);
-    showButtonSafe(WINBUTTON_JOG_TO_END, 1);
-    delay(200);
-    showButtonSafe(WINBUTTON_JOG_TO_END, 0);
+    flashButton(WINBUTTON_JOG_TO_END);
 }
 
 void JogYScreen::jogToRetractPosition() {
@@ -167,9 +131,7 @@ void JogYScreen::jogToRetractPosition() {
         desiredRetractPos = yHomePos;
     }
     MotionController::Instance().moveToWithRate(AXIS_Y, desiredRetractPos, 0.5f);
-    showButtonSafe(WINBUTTON_JOG_TO_RETRACT, 1);
-    delay(200);
-    showButtonSafe(WINBUTTON_JOG_TO_RETRACT, 0);
+    flashButton(WINBUTTON_JOG_TO_RETRACT);
 }
 
 void JogYScreen::toggleJogMode() {
@@ -191,6 +153,9 @@ void JogYScreen::toggleJogMode() {
         }
         mpg.setEnabled(true);
         mpg.setAxis(AXIS_Y);
+
+        // Reset the encoder baseline so the first jog has no phantom jump
+        ui.resetRaw();
         showButtonSafe(WINBUTTON_ACTIVATE_JOG_Y_F6, 1);
     }
     else {
@@ -219,16 +184,14 @@ void JogYScreen::setLengthWithMPG() {
         _tempLength = cutData.cutLength;
         showButtonSafe(WINBUTTON_SET_WITH_MPG_F6, 1);
         ui.bindField(WINBUTTON_SET_WITH_MPG_F6, LEDDIGITS_CUT_LENGTH_Y,
-            &_tempLength, 0.0f, 100.0f, MPG_FIXED_INCREMENT, 3);
+            &_tempLength, 0.0f, 100.0f, MPG_FIXED_INCREMENT);
     }
     else {
         if (ui.isFieldActive(WINBUTTON_SET_WITH_MPG_F6)) {
             cutData.cutLength = _tempLength;
             cutData.cutEndPoint = cutData.cutStartPoint + cutData.cutLength;
             ui.unbindField();
-            genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-                LEDDIGITS_CUT_STOP_Y,
-                static_cast<uint16_t>(cutData.cutEndPoint * 1000));
+            DisplayValue::show(LEDDIGITS_CUT_STOP_Y, cutData.cutEndPoint);
         }
         showButtonSafe(WINBUTTON_SET_WITH_MPG_F6, 0);
     }
@@ -239,13 +202,13 @@ void JogYScreen::setRetractWithMPG() {
     auto& ui = UIInputManager::Instance();
     auto& mpg = MPGJogManager::Instance();
 
-    ClearCore::ConnectorUsb.Send("[JogY] setRetractWithMPG button pressed, current mode: ");
-    ClearCore::ConnectorUsb.SendLine(_mpgSetRetractMode ? "ON" : "OFF");
+    LOG_INFO(UI, "[JogY] setRetractWithMPG button pressed, current mode: ",
+        _mpgSetRetractMode ? "ON" : "OFF");
 
     _mpgSetRetractMode = !_mpgSetRetractMode;
 
     if (_mpgSetRetractMode) {
-        ClearCore::ConnectorUsb.SendLine("[JogY] Entering retract MPG mode");
+        LOG_INFO(UI, "[JogY] Entering retract MPG mode");
         if (_mpgSetLengthMode) {
             ui.unbindField();
             _mpgSetLengthMode = false;
@@ -257,25 +220,21 @@ void JogYScreen::setRetractWithMPG() {
         }
         _tempRetract = cutData.retractDistance;
         showButtonSafe(WINBUTTON_SET_RETRACT_WITH_MPG_F6, 1);
-        ClearCore::ConnectorUsb.Send("[JogY] Binding field to button ID: ");
-        ClearCore::ConnectorUsb.Send(WINBUTTON_SET_RETRACT_WITH_MPG_F6);
-        ClearCore::ConnectorUsb.Send(", LED ID: ");
-        ClearCore::ConnectorUsb.SendLine(LEDDIGITS_RETRACT_DISTANCE);
+        LOG_DEBUG(UI, "[JogY] Binding field to button ID: ", WINBUTTON_SET_RETRACT_WITH_MPG_F6,
+            ", LED ID: ", LEDDIGITS_RETRACT_DISTANCE);
 
         ui.bindField(WINBUTTON_SET_RETRACT_WITH_MPG_F6, LEDDIGITS_RETRACT_DISTANCE,
-            &_tempRetract, 0.0f, 100.0f, MPG_FIXED_INCREMENT, 3);
+            &_tempRetract, 0.0f, 100.0f, MPG_FIXED_INCREMENT);
 
-        ClearCore::ConnectorUsb.Send("[JogY] Field active status: ");
-        ClearCore::ConnectorUsb.SendLine(ui.isFieldActive(WINBUTTON_SET_RETRACT_WITH_MPG_F6) ? "ACTIVE" : "NOT ACTIVE");
+        LOG_DEBUG(UI, "[JogY] Field active status: ",
+            ui.isFieldActive(WINBUTTON_SET_RETRACT_WITH_MPG_F6) ? "ACTIVE" : "NOT ACTIVE");
     }
     else {
-        ClearCore::ConnectorUsb.SendLine("[JogY] Exiting retract MPG mode");
+        LOG_INFO(UI, "[JogY] Exiting retract MPG mode");
         if (ui.isFieldActive(WINBUTTON_SET_RETRACT_WITH_MPG_F6)) {
             cutData.retractDistance = _tempRetract;
             ui.unbindField();
-            genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-                LEDDIGITS_RETRACT_DISTANCE,
-                static_cast<uint16_t>(cutData.retractDistance * 1000));
+            DisplayValue::show(LEDDIGITS_RETRACT_DISTANCE, cutData.retractDistance);
         }
         showButtonSafe(WINBUTTON_SET_RETRACT_WITH_MPG_F6, 0);
     }
@@ -286,30 +245,20 @@ void JogYScreen::updateCutLengthDisplay() {
     cutData.cutLength = cutData.cutEndPoint - cutData.cutStartPoint;
     if (cutData.cutLength < 0) cutData.cutLength = 0;
 
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_CUT_LENGTH_Y,
-        static_cast<uint16_t>(cutData.cutLength * 1000));
+    DisplayValue::show(LEDDIGITS_CUT_LENGTH_Y, cutData.cutLength);
 }
 
 void JogYScreen::updateAllDisplays() {
     auto& cutData = _mgr.GetCutData();
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_STOCK_END_Y,
-        static_cast<uint16_t>(cutData.cutStartPoint * 1000));
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_CUT_STOP_Y,
-        static_cast<uint16_t>(cutData.cutEndPoint * 1000));
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_RETRACT_DISTANCE,
-        static_cast<uint16_t>(cutData.retractDistance * 1000));
+    DisplayValue::show(LEDDIGITS_STOCK_END_Y, cutData.cutStartPoint);
+    DisplayValue::show(LEDDIGITS_CUT_STOP_Y, cutData.cutEndPoint);
+    DisplayValue::show(LEDDIGITS_RETRACT_DISTANCE, cutData.retractDistance);
     updateCutLengthDisplay();
 
     // Use absolute position from encoder tracker
     float currentPos = MotionController::Instance().getAbsoluteAxisPosition(AXIS_Y);
     
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_TABLE_POSITION_Y,
-        static_cast<uint16_t>(currentPos * 1000));
+    DisplayValue::show(LEDDIGITS_TABLE_POSITION_Y, currentPos);
 }
 
 // In JogYScreen.cpp
@@ -336,21 +285,20 @@ float JogYScreen::getRetractPosition() const {
 }
 
 void JogYScreen::update() {
+    LATENCY_PROBE("screen.jogY");
     auto& cutData = _mgr.GetCutData();
     
     // Use absolute position from encoder tracker
     float pos = MotionController::Instance().getAbsoluteAxisPosition(AXIS_Y);
     
-    genie.WriteObject(GENIE_OBJ_LEDDIGITS,
-        LEDDIGITS_TABLE_POSITION_Y,
-        static_cast<uint16_t>(pos * 1000));
+    DisplayValue::show(LEDDIGITS_TABLE_POSITION_Y, pos);
 
     float distanceToStart = fabs(pos - cutData.cutStartPoint);
     if (distanceToStart <= 0.002f) {
-        genie.WriteObject(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 1);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 1);
     }
     else {
-        genie.WriteObject(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 0);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 0);
     }
 
     static uint32_t lastCheckTime = 0;
@@ -359,14 +307,14 @@ void JogYScreen::update() {
     if (now - lastCheckTime > 500) {
         lastCheckTime = now;
         if (_mpgSetLengthMode) {
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_WITH_MPG_F6, 1);
+            DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_WITH_MPG_F6, 1);
         }
         if (_mpgSetRetractMode) {
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RETRACT_WITH_MPG_F6, 1);
+            DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RETRACT_WITH_MPG_F6, 1);
         }
         auto& mpg = MPGJogManager::Instance();
         if (mpg.isEnabled()) {
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_ACTIVATE_JOG_Y_F6, 1);
+            DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_ACTIVATE_JOG_Y_F6, 1);
         }
     }
 }
@@ -23,11 +23,11 @@ public:
 
     void onShow() override;
     void onHide() override;
-    void handleEvent(const genieFrame& e) override;
     void update() override;
+    const FieldInit* initialState(uint8_t& count) const override;
     JogYScreen(ScreenManager& mgr);
 
-private:
+    // Button actions, routed here by EventRouter
     // Input capture methods
     void captureCutStart();
     void captureCutEnd();
@@ -45,6 +45,7 @@ private:
     // Jog activation
     void toggleJogMode();
 
+private:
     // UI update helpers
     void updateCutLengthDisplay();
     void updateAllDisplays();
@@ -3,6 +3,16 @@
 
 JogZScreen::JogZScreen(ScreenManager& mgr) : _mgr(mgr) {}
 
+static const Screen::FieldInit JOG_Z_INITIAL[] = {
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RPM_F8, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_ENABLE_F8, 0 },
+};
+
+const Screen::FieldInit* JogZScreen::initialState(uint8_t& count) const {
+    count = sizeof(JOG_Z_INITIAL) / sizeof(JOG_Z_INITIAL[0]);
+    return JOG_Z_INITIAL;
+}
+
 void JogZScreen::onShow() {
     // Example: auto& cutData = _mgr.GetCutData();
     // Initialize Z screen state here
@@ -12,10 +22,6 @@ void JogZScreen::onHide() {
     // Cleanup or disable Z screen state here
 }
 
-void JogZScreen::handleEvent(const genieFrame& e) {
-    // Handle Z axis events here
-}
-
 void JogZScreen::setRPM(float value) {
     // Set spindle or tool RPM, using cutData if needed
 }
@@ -7,7 +7,7 @@ class JogZScreen : public Screen {
 public:
     void onShow() override;
     void onHide() override;
-    void handleEvent(const genieFrame& e) override;
+    const FieldInit* initialState(uint8_t& count) const override;
     JogZScreen(ScreenManager& mgr);
 private:
     void setRPM(float value);
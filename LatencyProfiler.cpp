@@ -0,0 +1,115 @@
+// LatencyProfiler.cpp
+#include "LatencyProfiler.h"
+#include "Log.h"
+#include "UsbConsole.h"
+#include <string.h>
+
+// --- LatencyHistogram ---
+
+int LatencyHistogram::bucketFor(uint32_t us) {
+    if (us < SUB_BUCKETS) return static_cast<int>(us);
+
+    // octave = index of the top set bit; the next two bits pick the sub-bucket
+    int octave = 31 - __builtin_clz(us);
+    if (octave >= MAX_OCTAVE) return NUM_BUCKETS - 1;
+    int sub = (us >> (octave - 2)) & (SUB_BUCKETS - 1);
+    return SUB_BUCKETS * (octave - 1) + sub;
+}
+
+uint32_t LatencyHistogram::bucketLow(int bucket) {
+    if (bucket < SUB_BUCKETS) return static_cast<uint32_t>(bucket);
+    int octave = bucket / SUB_BUCKETS + 1;
+    int sub = bucket % SUB_BUCKETS;
+    return static_cast<uint32_t>(SUB_BUCKETS + sub) << (octave - 2);
+}
+
+void LatencyHistogram::reset() {
+    memset(_counts, 0, sizeof(_counts));
+    _count = 0;
+    _max = 0;
+}
+
+uint32_t LatencyHistogram::percentile(uint8_t pct) const {
+    if (_count == 0) return 0;
+
+    // Rank of the sample we want, rounded up so p100 is the last sample
+    uint64_t rank = (static_cast<uint64_t>(_count) * pct + 99) / 100;
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (int b = 0; b < NUM_BUCKETS; b++) {
+        seen += _counts[b];
+        if (seen >= rank) {
+            uint32_t upper = (b + 1 < NUM_BUCKETS) ? bucketLow(b + 1) - 1 : _max;
+            return upper < _max ? upper : _max;
+        }
+    }
+    return _max;
+}
+
+// --- LatencyProfiler ---
+
+LatencyProfiler& LatencyProfiler::Instance() {
+    static LatencyProfiler inst;
+    return inst;
+}
+
+int LatencyProfiler::channel(const char* name) {
+    for (int i = 0; i < _numChannels; i++) {
+        if (strcmp(_channels[i].name, name) == 0) return i;
+    }
+    if (_numChannels >= MAX_CHANNELS) {
+        LOG_WARN(Sys, "[Latency] No free channel for ", name);
+        return -1;
+    }
+    _channels[_numChannels].name = name;
+    _channels[_numChannels].hist.reset();
+    return _numChannels++;
+}
+
+void LatencyProfiler::reset() {
+    for (int i = 0; i < _numChannels; i++) {
+        _channels[i].hist.reset();
+    }
+}
+
+void LatencyProfiler::dump() const {
+    ClearCore::ConnectorUsb.SendLine("[Latency] channel: count / p50 / p99 / max (us)");
+    for (int i = 0; i < _numChannels; i++) {
+        const LatencyHistogram& h = _channels[i].hist;
+        ClearCore::ConnectorUsb.Send("[Latency] ");
+        ClearCore::ConnectorUsb.Send(_channels[i].name);
+        ClearCore::ConnectorUsb.Send(": ");
+        ClearCore::ConnectorUsb.Send(h.count());
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.Send(h.percentile(50));
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.Send(h.percentile(99));
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.SendLine(h.maxUs());
+    }
+}
+
+static void latCommand(const char* args) {
+    auto& prof = LatencyProfiler::Instance();
+    if (strcmp(args, "reset") == 0) {
+        prof.reset();
+        ClearCore::ConnectorUsb.SendLine("[Latency] Histograms cleared");
+    }
+    else if (strcmp(args, "off") == 0) {
+        prof.setEnabled(false);
+        ClearCore::ConnectorUsb.SendLine("[Latency] Recording paused");
+    }
+    else if (strcmp(args, "on") == 0) {
+        prof.setEnabled(true);
+        ClearCore::ConnectorUsb.SendLine("[Latency] Recording resumed");
+    }
+    else {
+        prof.dump();
+    }
+}
+
+void LatencyProfiler::registerCommands() {
+    UsbConsole::Instance().registerCommand("lat", latCommand,
+        "latency histograms; 'lat reset', 'lat on', 'lat off'");
+}
@@ -0,0 +1,130 @@
+// LatencyProfiler.h
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__arm__)
+#include <ClearCore.h>
+#include <sam.h>
+#include "Config.h"
+#else
+#include <chrono>
+#endif
+
+#ifndef LATENCY_PROFILING
+#define LATENCY_PROFILING true
+#endif
+
+/// Cheap timestamp source for the probes. On the ClearCore this is the
+/// Cortex-M4 DWT cycle counter (enabled by SysManager at boot, 120 MHz,
+/// wraps every ~35 s - fine for deltas). Host builds use steady_clock.
+namespace LatencyClock {
+#if defined(__arm__)
+    inline uint32_t ticks() { return DWT->CYCCNT; }
+    inline uint32_t ticksToUs(uint32_t t) { return t / CYCLES_PER_MICROSECOND; }
+#else
+    inline uint32_t ticks() {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    inline uint32_t ticksToUs(uint32_t t) { return t / 1000; }
+#endif
+}
+
+/// Log-bucketed latency histogram in microseconds.
+/// Four buckets per power of two (<= 25% error on percentiles), 0 us to
+/// ~1 s, everything above lands in the last bucket. max is exact.
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKETS = 4;
+    static constexpr int MAX_OCTAVE = 20;       // 2^20 us ~ 1 s
+    static constexpr int NUM_BUCKETS = SUB_BUCKETS * MAX_OCTAVE;
+
+    void record(uint32_t us) {
+        _counts[bucketFor(us)]++;
+        _count++;
+        if (us > _max) _max = us;
+    }
+
+    void reset();
+
+    uint32_t count() const { return _count; }
+    uint32_t maxUs() const { return _max; }
+
+    /// Upper bound of the bucket holding the given percentile (0-100),
+    /// clamped to the exact max. Returns 0 when empty.
+    uint32_t percentile(uint8_t pct) const;
+
+    static int bucketFor(uint32_t us);
+    static uint32_t bucketLow(int bucket);
+
+private:
+    uint32_t _counts[NUM_BUCKETS] = {};
+    uint32_t _count = 0;
+    uint32_t _max = 0;
+};
+
+/// Named histograms for the main-loop phases, dumped over the USB console
+/// with "lat" and cleared with "lat reset".
+class LatencyProfiler {
+public:
+    static LatencyProfiler& Instance();
+
+    /// Find or create a channel by name; returns -1 if the table is full.
+    /// Call once per probe site (LATENCY_PROBE caches it in a static).
+    int channel(const char* name);
+
+    void record(int ch, uint32_t us) {
+        if (_enabled && ch >= 0) _channels[ch].hist.record(us);
+    }
+
+    void setEnabled(bool enabled) { _enabled = enabled; }
+    bool enabled() const { return _enabled; }
+
+    int channelCount() const { return _numChannels; }
+    const char* channelName(int ch) const { return _channels[ch].name; }
+    const LatencyHistogram& histogram(int ch) const { return _channels[ch].hist; }
+
+    void reset();
+    void dump() const;
+
+    /// Hook the "lat" command into the USB console
+    void registerCommands();
+
+private:
+    LatencyProfiler() = default;
+    LatencyProfiler(const LatencyProfiler&) = delete;
+    LatencyProfiler& operator=(const LatencyProfiler&) = delete;
+
+    static constexpr int MAX_CHANNELS = 16;
+
+    struct Channel {
+        const char* name;
+        LatencyHistogram hist;
+    };
+
+    Channel _channels[MAX_CHANNELS];
+    int  _numChannels = 0;
+    bool _enabled = true;
+};
+
+/// Times the enclosing scope into one profiler channel
+class ScopedLatencyProbe {
+public:
+    explicit ScopedLatencyProbe(int ch) : _ch(ch), _start(LatencyClock::ticks()) {}
+    ~ScopedLatencyProbe() {
+        LatencyProfiler::Instance().record(_ch, LatencyClock::ticksToUs(LatencyClock::ticks() - _start));
+    }
+
+private:
+    int _ch;
+    uint32_t _start;
+};
+
+#if LATENCY_PROFILING
+#define LATENCY_PROBE(name) \
+    static const int _latencyChannel = LatencyProfiler::Instance().channel(name); \
+    ScopedLatencyProbe _latencyProbe(_latencyChannel)
+#else
+#define LATENCY_PROBE(name) do {} while (0)
+#endif
@@ -0,0 +1,79 @@
+// Log.h
+#pragma once
+
+#include <ClearCore.h>
+#include "Config.h"
+#include "BinLog.h"
+
+/// Log categories and levels. Each category's level is set in Config.h
+/// (LOG_LEVEL_MOTION etc.) and capped build-wide by LOG_MAX_LEVEL.
+enum class LogCat : uint8_t { Motion, Feed, UI, Homing, Seq, Genie, Sys };
+enum class LogLevel : uint8_t { Off, Error, Warn, Info, Debug };
+
+constexpr LogLevel logCategoryLevel(LogCat cat) {
+    return cat == LogCat::Motion ? LOG_LEVEL_MOTION
+        : cat == LogCat::Feed ? LOG_LEVEL_FEED
+        : cat == LogCat::UI ? LOG_LEVEL_UI
+        : cat == LogCat::Homing ? LOG_LEVEL_HOMING
+        : cat == LogCat::Seq ? LOG_LEVEL_SEQ
+        : cat == LogCat::Genie ? LOG_LEVEL_GENIE
+        : LOG_LEVEL_SYS;
+}
+
+/// Compile-time gate; a template so the answer is a constant even at -O0
+template <LogCat C, LogLevel L>
+struct LogEnabled {
+    static constexpr bool value = L != LogLevel::Off
+        && static_cast<uint8_t>(L) <= static_cast<uint8_t>(logCategoryLevel(C))
+        && static_cast<uint8_t>(L) <= static_cast<uint8_t>(LOG_MAX_LEVEL);
+};
+
+/// Text log statements, e.g.
+///   LOG_INFO(Motion, "[X-Axis] MoveTo: ", pos, " inches");
+///   LOG_DEBUG(Feed, "torque ", Log::fixed(pct, 1), "%");
+/// A disabled statement is a constant-false branch: its arguments are never
+/// evaluated and its string literals and calls are dropped from the image.
+#define LOG_ENABLED(cat, lvl) (LogEnabled<LogCat::cat, LogLevel::lvl>::value)
+
+#define LOG_AT(cat, lvl, ...) \
+    do { if (LOG_ENABLED(cat, lvl)) Log::line(__VA_ARGS__); } while (0)
+
+#define LOG_ERROR(cat, ...) LOG_AT(cat, Error, __VA_ARGS__)
+#define LOG_WARN(cat, ...)  LOG_AT(cat, Warn, __VA_ARGS__)
+#define LOG_INFO(cat, ...)  LOG_AT(cat, Info, __VA_ARGS__)
+#define LOG_DEBUG(cat, ...) LOG_AT(cat, Debug, __VA_ARGS__)
+
+/// Category-gated BinLog record, same rules as LOG_AT
+#define BINLOG_AT(cat, lvl, id, ...) \
+    do { if (LOG_ENABLED(cat, lvl)) BINLOG(id, ##__VA_ARGS__); } while (0)
+
+namespace Log {
+
+    /// Float with an explicit number of decimals (USB Send defaults to 2)
+    struct Fixed {
+        double value;
+        uint8_t digits;
+    };
+
+    inline Fixed fixed(double value, uint8_t digits) { return Fixed{ value, digits }; }
+
+    inline void send(const char* s) { ClearCore::ConnectorUsb.Send(s); }
+    inline void send(char c) { ClearCore::ConnectorUsb.Send(c); }
+    inline void send(bool b) { ClearCore::ConnectorUsb.Send(b ? "true" : "false"); }
+    inline void send(int v) { ClearCore::ConnectorUsb.Send(static_cast<int32_t>(v)); }
+    inline void send(long v) { ClearCore::ConnectorUsb.Send(static_cast<int32_t>(v)); }
+    inline void send(unsigned v) { ClearCore::ConnectorUsb.Send(static_cast<uint32_t>(v)); }
+    inline void send(unsigned long v) { ClearCore::ConnectorUsb.Send(static_cast<uint32_t>(v)); }
+    inline void send(float v) { ClearCore::ConnectorUsb.Send(static_cast<double>(v)); }
+    inline void send(double v) { ClearCore::ConnectorUsb.Send(v); }
+    inline void send(const Fixed& f) { ClearCore::ConnectorUsb.Send(f.value, f.digits); }
+
+    inline void line() { ClearCore::ConnectorUsb.SendLine(); }
+
+    template <typename T, typename... Rest>
+    inline void line(T first, Rest... rest) {
+        send(first);
+        line(rest...);
+    }
+
+}
@@ -0,0 +1,47 @@
+// LogMessages.h
+// Message catalog for BinLog. Each entry is a compile-time message ID and
+// the text the host decoder (tools/binlog_decode.py) formats it with.
+// IDs are the position in this file, so new entries go at the end of the
+// file only - never into a group above it - and nothing is reordered or
+// removed; the decoder reads this file to build its table.
+// Placeholders follow Python str.format: {} or {:.2f}, one per argument.
+
+// --- BinLog ---
+LOG_MESSAGE(BINLOG_DROPPED,            "[BinLog] {} records dropped")
+
+// --- MPG jog ---
+LOG_MESSAGE(MPG_SETUP,                 "[MPG] Setup complete, range set to X{}")
+LOG_MESSAGE(MPG_ENABLED,               "[MPG] Enabled")
+LOG_MESSAGE(MPG_DISABLED,              "[MPG] Disabled")
+LOG_MESSAGE(MPG_AXIS,                  "[MPG] Active axis changed to {}")
+LOG_MESSAGE(MPG_BAD_RANGE,             "[MPG] Invalid range multiplier: {}")
+LOG_MESSAGE(MPG_PINS,                  "[MPG] Pin states: X10={}, X100={}")
+LOG_MESSAGE(MPG_MOVE,                  "[MPG] Moving {:.6f} inches at {:.0f}% speed, range=X{}, delta={}")
+
+// --- Encoder position tracker ---
+LOG_MESSAGE(ENC_SETUP,                 "[EncoderTracker] Setup complete")
+LOG_MESSAGE(ENC_RESET,                 "[EncoderTracker] Position reset after homing")
+LOG_MESSAGE(ENC_POSITION,              "[EncoderTracker] X: {:.4f} inches, Y: {:.4f}")
+LOG_MESSAGE(ENC_MISMATCH_X,            "[EncoderTracker] ERROR: X position mismatch. Expected: {:.4f}, Actual: {:.4f}, Diff: {:.4f}")
+LOG_MESSAGE(ENC_MISMATCH_Y,            "[EncoderTracker] ERROR: Y position mismatch. Expected: {:.4f}, Actual: {:.4f}, Diff: {:.4f}")
+LOG_MESSAGE(ENC_ERRORS_CLEARED,        "[EncoderTracker] Position errors cleared")
+
+// --- Dynamic feed ---
+LOG_MESSAGE(FEED_ACCEL_FACTOR,         "[DynamicFeed] Acceleration factor set to: {:.2f}")
+LOG_MESSAGE(FEED_RAMP_PARAMS,          "[DynamicFeed] Ramping parameters set: start={:.2f}s, end={:.2f}s")
+LOG_MESSAGE(FEED_NO_MOTOR,             "[DynamicFeed] Cannot start: no motor available")
+LOG_MESSAGE(FEED_TARGET_OOB,           "[DynamicFeed] Target out of bounds")
+LOG_MESSAGE(FEED_START,                "[DynamicFeed] Starting torque-controlled feed to {:.2f} inches with gentle ramp-up at {:.0f}% initial speed, target torque: {:.1f}%")
+LOG_MESSAGE(FEED_ABORT,                "[DynamicFeed] Operation aborted with controlled deceleration")
+LOG_MESSAGE(FEED_COMPLETE,             "[DynamicFeed] Feed complete, preparing for smooth retract")
+LOG_MESSAGE(FEED_RETRACT_DONE,         "[DynamicFeed] Retract complete with smooth stop, ready")
+LOG_MESSAGE(FEED_TORQUE_TARGET,        "[DynamicFeed] Torque target set to {:.1f}%")
+LOG_MESSAGE(FEED_RATE,                 "[DynamicFeed] Feed rate updated: {:.1f}%, change: {:.2f}%, error: {:.2f}")
+LOG_MESSAGE(FEED_RETRACT,              "[DynamicFeed] Retracting to {:.2f} inches with smooth acceleration at {:.0f}% rapid speed")
+LOG_MESSAGE(FEED_RESUMED,              "[DynamicFeed] Feed resumed with smooth acceleration at {:.1f}% feed rate")
+LOG_MESSAGE(FEED_PAUSED,               "[DynamicFeed] Feed paused with gentle deceleration")
+LOG_MESSAGE(FEED_ISR_RATE,             "[DynamicFeed] ISR feed rate: {:.1f}%, error: {:.2f}, max tick: {}us")
+LOG_MESSAGE(FEED_GAINS,                "[DynamicFeed] Gains for {:.1f}in blade at {:.0f} RPM: kp={:.5f} ki={:.4f} kd={:.6f}")
+
+// --- Appended after the groups above; keep adding here ---
+LOG_MESSAGE(MPG_FOLLOW,                "[MPG] Follow mode {}")
@@ -0,0 +1,74 @@
+// LoopWatchdog.cpp
+#include "LoopWatchdog.h"
+#include "Config.h"
+#include "Log.h"
+
+LoopWatchdog& LoopWatchdog::Instance() {
+    static LoopWatchdog inst;
+    return inst;
+}
+
+LoopWatchdog::LoopWatchdog()
+    : _budgetUs(LOOP_STALL_BUDGET_US)
+{
+}
+
+void LoopWatchdog::beginIteration() {
+    _mark = nullptr;
+    _startUs = ClearCore::TimingMgr.Microseconds();
+}
+
+void LoopWatchdog::endIteration(const char* site) {
+    uint32_t elapsed = ClearCore::TimingMgr.Microseconds() - _startUs;
+    _iterations++;
+
+    if (elapsed > _worstUs) {
+        _worstUs = elapsed;
+        _worstSite = site;
+        _worstMark = _mark;
+    }
+
+    if (elapsed <= _budgetUs) return;
+
+    _stalls++;
+    _stallsSinceLog++;
+
+    if (!LOOP_WATCHDOG_LOGGING) return;
+
+    uint32_t nowMs = ClearCore::TimingMgr.Milliseconds();
+    if (_lastLogMs != 0 && nowMs - _lastLogMs < LOOP_WATCHDOG_LOG_INTERVAL) return;
+    _lastLogMs = nowMs;
+
+    LOG_WARN(Sys, "[LoopWatchdog] Stall ", elapsed, "us in ", site ? site : "?",
+        _mark ? " (" : "", _mark ? _mark : "", _mark ? ")" : "",
+        ", ", _stallsSinceLog, " since last report");
+    _stallsSinceLog = 0;
+}
+
+void LoopWatchdog::reset() {
+    _iterations = 0;
+    _stalls = 0;
+    _worstUs = 0;
+    _worstSite = nullptr;
+    _worstMark = nullptr;
+    _stallsSinceLog = 0;
+}
+
+void LoopWatchdog::logReport() const {
+    ClearCore::ConnectorUsb.Send("[LoopWatchdog] Budget ");
+    ClearCore::ConnectorUsb.Send(_budgetUs);
+    ClearCore::ConnectorUsb.Send("us, stalls ");
+    ClearCore::ConnectorUsb.Send(_stalls);
+    ClearCore::ConnectorUsb.Send("/");
+    ClearCore::ConnectorUsb.Send(_iterations);
+    ClearCore::ConnectorUsb.Send(", worst ");
+    ClearCore::ConnectorUsb.Send(_worstUs);
+    ClearCore::ConnectorUsb.Send("us in ");
+    ClearCore::ConnectorUsb.Send(_worstSite ? _worstSite : "?");
+    if (_worstMark) {
+        ClearCore::ConnectorUsb.Send(" (");
+        ClearCore::ConnectorUsb.Send(_worstMark);
+        ClearCore::ConnectorUsb.Send(")");
+    }
+    ClearCore::ConnectorUsb.SendLine("");
+}
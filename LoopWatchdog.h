@@ -0,0 +1,54 @@
+// LoopWatchdog.h
+#pragma once
+
+#include <ClearCore.h>
+
+/// Record the current function as the most recent call site inside the
+/// running task. Costs one pointer store; place it at the top of code
+/// that might run long so a stall report can say more than the task name.
+#define LOOP_WATCHDOG_MARK() LoopWatchdog::Instance().mark(__FUNCTION__)
+
+/// Measures every scheduler pass against a time budget.
+/// Tracks the longest pass seen and where it happened (task name plus the
+/// last LOOP_WATCHDOG_MARK() reached), counts passes over budget and
+/// reports them over USB, rate limited so the report can't cause stalls.
+class LoopWatchdog {
+public:
+    static LoopWatchdog& Instance();
+
+    /// Bracket one pass of the main loop
+    void beginIteration();
+    void endIteration(const char* site);
+
+    void mark(const char* site) { _mark = site; }
+
+    void setBudgetUs(uint32_t us) { _budgetUs = us; }
+    uint32_t budgetUs() const { return _budgetUs; }
+
+    uint32_t iterations() const { return _iterations; }
+    uint32_t stallCount() const { return _stalls; }
+    uint32_t worstUs() const { return _worstUs; }
+    const char* worstSite() const { return _worstSite; }
+    const char* worstMark() const { return _worstMark; }
+
+    void reset();
+    void logReport() const;
+
+private:
+    LoopWatchdog();
+    LoopWatchdog(const LoopWatchdog&) = delete;
+    LoopWatchdog& operator=(const LoopWatchdog&) = delete;
+
+    uint32_t _budgetUs;
+    uint32_t _startUs = 0;
+    const char* _mark = nullptr;
+
+    uint32_t _iterations = 0;
+    uint32_t _stalls = 0;
+    uint32_t _worstUs = 0;
+    const char* _worstSite = nullptr;
+    const char* _worstMark = nullptr;
+
+    uint32_t _lastLogMs = 0;
+    uint32_t _stallsSinceLog = 0;
+};
@@ -3,6 +3,10 @@
 #include "MotionController.h"
 #include "Config.h"
 #include <ClearCore.h>
+#include <math.h>
+#include "BinLog.h"
+#include "Log.h"
+#include "LatencyProfiler.h"
 #include "SetupAutocutScreen.h"
 
 // Initialize the global pointer to nullptr
@@ -28,16 +32,15 @@ void MPGJogManager::setup() {
     // Initialize range (don't assume X1)
     updateRangeFromInputs();
 
-    ClearCore::ConnectorUsb.Send("[MPG] Setup complete, range set to X");
-    ClearCore::ConnectorUsb.SendLine(_range);
+    BINLOG(MPG_SETUP, _range);
 }
 
 void MPGJogManager::setEnabled(bool en) {
     _enabled = en;
     if (en) {
-        ClearCore::ConnectorUsb.SendLine("[MPG] Enabled");
+        BINLOG(MPG_ENABLED);
     } else {
-        ClearCore::ConnectorUsb.SendLine("[MPG] Disabled");
+        BINLOG(MPG_DISABLED);
     }
 }
 
@@ -46,6 +49,7 @@ bool MPGJogManager::isEnabled() const {
 }
 
 void MPGJogManager::setAxis(AxisId axis) {
+    if (axis != _currentAxis) stopFollowing();
     _currentAxis = axis;
     const char* axisName = "";
     switch (axis) {
@@ -53,8 +57,7 @@ void MPGJogManager::setAxis(AxisId axis) {
     case AXIS_Y: axisName = "Y"; break;
     case AXIS_Z: axisName = "Z"; break;
     }
-    ClearCore::ConnectorUsb.Send("[MPG] Active axis changed to ");
-    ClearCore::ConnectorUsb.SendLine(axisName);
+    BINLOG(MPG_AXIS, axisName);
 }
 
 void MPGJogManager::setRangeMultiplier(int multiplier) {
@@ -63,12 +66,9 @@ void MPGJogManager::setRangeMultiplier(int multiplier) {
         multiplier == JOG_MULTIPLIER_X10 || 
         multiplier == JOG_MULTIPLIER_X100) {
         _range = multiplier;
-        
-      // ClearCore::ConnectorUsb.Send("[MPG] Range set to X");
-      //  ClearCore::ConnectorUsb.SendLine(_range);
+        LOG_DEBUG(Motion, "[MPG] Range set to X", _range);
     } else {
-        ClearCore::ConnectorUsb.Send("[MPG] Invalid range multiplier: ");
-        ClearCore::ConnectorUsb.SendLine(multiplier);
+        BINLOG(MPG_BAD_RANGE, multiplier);
     }
 }
 
@@ -78,10 +78,7 @@ void MPGJogManager::updateRangeFromInputs() {
     bool x100Selected = RANGE_PIN_X100.State();
     
     // Debug pin states
-    ClearCore::ConnectorUsb.Send("[MPG] Pin states: X10=");
-    ClearCore::ConnectorUsb.Send(x10Selected ? "HIGH" : "LOW");
-    ClearCore::ConnectorUsb.Send(", X100=");
-    ClearCore::ConnectorUsb.SendLine(x100Selected ? "HIGH" : "LOW");
+    BINLOG(MPG_PINS, x10Selected ? "HIGH" : "LOW", x100Selected ? "HIGH" : "LOW");
     
     int newRange;
     if (x100Selected) {
@@ -95,8 +92,7 @@ void MPGJogManager::updateRangeFromInputs() {
     // Only update and log if the range has changed
     if (newRange != _range) {
         _range = newRange;
-       // ClearCore::ConnectorUsb.Send("[MPG] Range changed to X");
-       // ClearCore::ConnectorUsb.SendLine(_range);
+        LOG_DEBUG(Motion, "[MPG] Range changed to X", _range);
     }
 }
 float MPGJogManager::getAxisIncrement() const {
@@ -109,6 +105,15 @@ float MPGJogManager::getAxisIncrement() const {
     }
 }
 
+float MPGJogManager::velocityScale() const {
+    switch (_range) {
+    case JOG_MULTIPLIER_X1:   return 0.15f; // Reduced to 15% for finer control
+    case JOG_MULTIPLIER_X10:  return 0.5f;
+    case JOG_MULTIPLIER_X100: return 0.9f;
+    default:                  return 0.5f;
+    }
+}
+
 void MPGJogManager::onEncoderDelta(int deltaClicks) {
     if (!_initialized || !_enabled || deltaClicks == 0)
         return;
@@ -140,24 +145,11 @@ void MPGJogManager::onEncoderDelta(int deltaClicks) {
     float inches = deltaClicks * stepInches;
 
     // Scale velocity with range - slower for X1 to ensure precision
-    float velocityScale;
-    switch (_range) {
-    case JOG_MULTIPLIER_X1:   velocityScale = 0.15f; break; // Reduced to 15% for finer control
-    case JOG_MULTIPLIER_X10:  velocityScale = 0.5f; break;
-    case JOG_MULTIPLIER_X100: velocityScale = 0.9f; break;
-    default:                  velocityScale = 0.5f; break;
-    }
+    float velocityScale = this->velocityScale();
 
     // Only log meaningful movement for debugging
     if (abs(deltaClicks) > 0) {
-        ClearCore::ConnectorUsb.Send("[MPG] Moving ");
-        ClearCore::ConnectorUsb.Send(inches, 6);
-        ClearCore::ConnectorUsb.Send(" inches at ");
-        ClearCore::ConnectorUsb.Send(velocityScale * 100.0f, 0);
-        ClearCore::ConnectorUsb.Send("% speed, range=X");
-        ClearCore::ConnectorUsb.Send(_range);
-        ClearCore::ConnectorUsb.Send(", delta=");
-        ClearCore::ConnectorUsb.SendLine(deltaClicks);
+        BINLOG(MPG_MOVE, inches, velocityScale * 100.0f, _range, deltaClicks);
     }
 
     // Use absolute position from encoder tracker
@@ -179,3 +171,129 @@ void MPGJogManager::update() {
         lastRangeCheckTime = now;
     }
 }
+
+// --- Handwheel following ---
+//
+// Like ClearCore's FollowEncoder example, but closed on position: wheel
+// counts move a target, and every motion tick the axis gets a velocity
+// command proportional to how far it trails that target. The proportional
+// law is the smoothing - a steady wheel is followed at a lag of
+// speed x MPG_FOLLOW_TC_MS, and a stopped wheel is closed on exponentially.
+// The command is capped by the range speed and by the speed the axis can
+// still brake from, so it never overshoots, and the target is never allowed
+// more than MPG_FOLLOW_MAX_LAG ahead. Once the wheel is still and the axis
+// is within MPG_FOLLOW_SETTLE, one positional move lands it exactly.
+//
+// Only wheel counts start a follow. Between follows the target is dropped
+// and re-seeded from the axis, so a move from a jog screen button (go to
+// zero, jog to start) runs untouched, and clicks turned during such a move
+// are discarded rather than fighting it.
+
+void MPGJogManager::setFollowMode(bool follow) {
+    if (follow == _followMode) return;
+    stopFollowing();
+    _followMode = follow;
+    BINLOG(MPG_FOLLOW, follow ? "on" : "off");
+}
+
+void MPGJogManager::stopFollowing() {
+    if (_tracking) {
+        MotionController::Instance().jogVelocity(_currentAxis, 0.0f);
+        _tracking = false;
+    }
+    _landing = false;
+    _synced = false;
+    _latencyPending = false;
+}
+
+void MPGJogManager::follow() {
+    if (!_followMode) return;
+
+    if (!_initialized || !_enabled || !_wheelRouted || _currentAxis == AXIS_Z) {
+        stopFollowing();
+        return;
+    }
+
+    auto& motion = MotionController::Instance();
+    int32_t raw = ClearCore::EncoderIn.Position();
+    float pos = motion.getAxisPosition(_currentAxis);
+    bool moving = motion.isAxisMoving(_currentAxis);
+    if (_landing && !moving) _landing = false;
+    if (!_synced) {
+        _target = pos;
+        _lastCount = raw;
+        _synced = true;
+    }
+
+    const float stepsPerInch = (_currentAxis == AXIS_X) ? FENCE_STEPS_PER_INCH : TABLE_STEPS_PER_INCH;
+    const float maxInches = (_currentAxis == AXIS_X) ? MAX_X_INCHES : MAX_Y_INCHES;
+
+    int32_t counts = raw - _lastCount;
+    _lastCount = raw;
+
+    // Not following: the target stays on the axis, wherever other moves take
+    // it, and clicks during someone else's move are dropped
+    if (!_tracking && !_landing) {
+        if (moving) counts = 0;
+        if (counts == 0) {
+            _target = pos;
+            return;
+        }
+    }
+
+    if (counts != 0) {
+        _target += counts * getAxisIncrement() / ENCODER_COUNTS_PER_CLICK;
+        if (!_tracking && !_latencyPending) {
+            _latencyPending = true;
+            _latencyStart = LatencyClock::ticks();
+            _latencyFrom = pos;
+        }
+    }
+
+    // First commanded step after the wheel moved from rest
+    if (_latencyPending && fabsf(pos - _latencyFrom) * stepsPerInch >= 1.0f) {
+        static const int channel = LatencyProfiler::Instance().channel("mpg.follow");
+        LatencyProfiler::Instance().record(channel,
+            LatencyClock::ticksToUs(LatencyClock::ticks() - _latencyStart));
+        _latencyPending = false;
+    }
+
+    // Soft limits and bounded lag
+    if (_target < 0.0f) _target = 0.0f;
+    else if (_target > maxInches) _target = maxInches;
+    float error = _target - pos;
+    if (error > MPG_FOLLOW_MAX_LAG) {
+        error = MPG_FOLLOW_MAX_LAG;
+        _target = pos + error;
+    }
+    else if (error < -MPG_FOLLOW_MAX_LAG) {
+        error = -MPG_FOLLOW_MAX_LAG;
+        _target = pos + error;
+    }
+
+    float distance = fabsf(error);
+    if (counts == 0 && distance < MPG_FOLLOW_SETTLE) {
+        if (_tracking) {
+            _tracking = false;
+            _landing = motion.moveToWithRate(_currentAxis, _target, velocityScale());
+        }
+        return;
+    }
+
+    float speed = distance / (MPG_FOLLOW_TC_MS / 1000.0f);
+    float limit = MPG_FOLLOW_MAX_SPEED * velocityScale();
+    float brake = sqrtf(2.0f * MPG_FOLLOW_BRAKE_ACCEL * distance);
+    if (speed > limit) speed = limit;
+    if (speed > brake) speed = brake;
+
+    if (motion.jogVelocity(_currentAxis, error < 0.0f ? -speed : speed)) {
+        _tracking = true;
+        _landing = false;
+    }
+    else {
+        // Not homed, homing or feeding: drop the wheel input
+        _tracking = false;
+        _synced = false;
+        _latencyPending = false;
+    }
+}
@@ -37,14 +37,45 @@ public:
     bool isEnabled() const;
     float getAxisIncrement() const;
 
+    /// Handwheel following (MPG_FOLLOW_MODE): the axis tracks the wheel with
+    /// velocity commands instead of a move per batch of clicks
+    void setFollowMode(bool follow);
+    bool isFollowMode() const { return _followMode; }
+
+    /// UIInputManager says whether the wheel drives the axis right now (a
+    /// jog form showing, no field being edited)
+    void routeWheel(bool routed) { _wheelRouted = routed; }
+
+    /// Follow tick - call from the motion task, after MotionController::update.
+    /// Wheel-to-motion latency goes to the "mpg.follow" latency channel.
+    void follow();
+
 private:
     MPGJogManager();
 
     /// Poll the range selector pins and update range
     void updateRangeFromInputs();
 
+    /// Share of full speed for the current range
+    float velocityScale() const;
+
+    /// Stop a follow in progress and resync on the next tick
+    void stopFollowing();
+
     bool    _initialized = false;
     bool    _enabled = false;
     AxisId  _currentAxis = AXIS_X;
     int     _range = JOG_MULTIPLIER_X1;
+
+    // Follow mode
+    bool    _followMode = MPG_FOLLOW_MODE;
+    bool    _wheelRouted = false;
+    bool    _synced = false;        // _target and _lastCount match the axis and wheel
+    bool    _tracking = false;      // Velocity commands in flight
+    bool    _landing = false;       // Settling move of our own in flight
+    int32_t _lastCount = 0;         // Raw wheel counts
+    float   _target = 0.0f;         // Inches
+    bool    _latencyPending = false;
+    uint32_t _latencyStart = 0;     // LatencyClock ticks at the first count
+    float   _latencyFrom = 0.0f;    // Axis position then
 };
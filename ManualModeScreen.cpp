@@ -1,5 +1,9 @@
 // Include screenmanager.h AFTER the ManualModeScreen.h to avoid circular dependencies
 #include "ManualModeScreen.h" 
+#include "DisplayModel.h"
+#include "DisplayValue.h"
+#include "LatencyProfiler.h"
+#include "Log.h"
 #include "UIInputManager.h"
 #include "SettingsManager.h"
 #include "PendantManager.h"
@@ -10,7 +14,16 @@
 
 ManualModeScreen::ManualModeScreen(ScreenManager& mgr) : _mgr(mgr) {}
 
-extern Genie genie;
+// The spindle button follows the spindle, so onShow() sets it
+static const Screen::FieldInit MANUAL_MODE_INITIAL[] = {
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_ACTIVATE_HOMING, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SETTINGS_F7, 0 },
+};
+
+const Screen::FieldInit* ManualModeScreen::initialState(uint8_t& count) const {
+    count = sizeof(MANUAL_MODE_INITIAL) / sizeof(MANUAL_MODE_INITIAL[0]);
+    return MANUAL_MODE_INITIAL;
+}
 
 void ManualModeScreen::onShow() {
     // Always enable the pendant - no toggle button anymore
@@ -24,7 +37,7 @@ void ManualModeScreen::onShow() {
 
     // Just set spindle button state
     bool spindleActive = MotionController::Instance().IsSpindleRunning();
-    genie.WriteObject(
+    DisplayModel::Instance().set(
         GENIE_OBJ_WINBUTTON,
         WINBUTTON_SPINDLE_TOGGLE_F7,
         spindleActive ? 1 : 0
@@ -41,52 +54,29 @@ void ManualModeScreen::onHide() {
     UIInputManager::Instance().unbindField();
 }
 
-void ManualModeScreen::handleEvent(const genieFrame& e) {
-    // Now we handle button events specific to the Manual Mode screen
-    if (e.reportObject.cmd != GENIE_REPORT_EVENT) {
-        return;
-    }
-
-    if (e.reportObject.object == GENIE_OBJ_WINBUTTON) {
-        switch (e.reportObject.index) {
-        case WINBUTTON_SPINDLE_TOGGLE_F7:
-            toggleSpindle();
-            break;
-
-        case WINBUTTON_ACTIVATE_HOMING:
-            activateHoming();
-            break;
-
-        case WINBUTTON_SETTINGS_F7:
-            goToSettings();
-            break;
-        }
-    }
-}
-
 void ManualModeScreen::update() {
+    LATENCY_PROBE("screen.manual");
     auto& mc = MotionController::Instance();
-    uint16_t displayVal = mc.IsSpindleRunning() ? (uint16_t)mc.CommandedRPM() : 0;
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_MANUAL_RPM, displayVal);
+    DisplayValue::show(LEDDIGITS_MANUAL_RPM, mc.IsSpindleRunning() ? mc.CommandedRPM() : 0.0f);
 }
 
 void ManualModeScreen::toggleSpindle() {
-    ClearCore::ConnectorUsb.SendLine("[ManualMode] Spindle toggle button");
+    LOG_INFO(UI, "[ManualMode] Spindle toggle button");
 
     auto& mc = MotionController::Instance();
     if (mc.IsSpindleRunning()) {
         mc.StopSpindle();
-        genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SPINDLE_TOGGLE_F7, 0);
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_SPINDLE_TOGGLE_F7, 0);
     }
     else {
         auto& settings = SettingsManager::Instance().settings();
         mc.StartSpindle(settings.spindleRPM);
-        genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SPINDLE_TOGGLE_F7, 1);
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_SPINDLE_TOGGLE_F7, 1);
     }
 }
 
 void ManualModeScreen::activateHoming() {
-    ClearCore::ConnectorUsb.SendLine("[ManualMode] Home Axes button pressed");
+    LOG_INFO(UI, "[ManualMode] Home Axes button pressed");
 
     // Toggle enable on Y then Z to trigger MSP homing
     MOTOR_TABLE_Y.EnableRequest(false);
@@ -98,7 +88,3 @@ void ManualModeScreen::activateHoming() {
     _mgr.ShowHoming();
 }
 
-void ManualModeScreen::goToSettings() {
-    ClearCore::ConnectorUsb.SendLine("[ManualMode] Settings button pressed");
-    _mgr.ShowSettings();
-}
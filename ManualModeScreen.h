@@ -10,14 +10,13 @@ class ManualModeScreen : public Screen {
 public:
     void onShow() override;
     void onHide() override;
-    void handleEvent(const genieFrame& e) override;
     void update() override;
+    const FieldInit* initialState(uint8_t& count) const override;
     ManualModeScreen(ScreenManager& mgr);
 
-    // Methods for handling manual mode functionality (removed togglePendant)
+    // Button actions, routed here by EventRouter
     void toggleSpindle();
     void activateHoming();
-    void goToSettings();
 
 private:
     ScreenManager& _mgr;
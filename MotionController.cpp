@@ -1,6 +1,8 @@
 // MotionController.cpp
 #include "MotionController.h"
+#include "LatencyProfiler.h"
 #include "Config.h"
+#include "Log.h"
 #include "EStopManager.h"
 #include <ClearCore.h>
 #include "Spindle.h"
@@ -9,6 +11,8 @@
 #include "ZAxis.h"
 #include "EncoderPositionTracker.h"
 #include "SettingsManager.h"
+#include "LoopWatchdog.h"
+#include "TorqueFeedLoop.h"
 
 
 MotionController& MotionController::Instance() {
@@ -30,13 +34,18 @@ void MotionController::setup() {
     yAxis.Setup();
     zAxis.Setup();
 
+    // Optional interrupt-driven torque feed loop on the Y axis
+    if (TORQUE_LOOP_IN_ISR) {
+        TorqueFeedLoop::Instance().begin(&MOTOR_TABLE_Y);
+    }
+
     // Initialize encoder position tracker
     EncoderPositionTracker::Instance().setup(ENCODER_X_STEPS_PER_INCH, ENCODER_Y_STEPS_PER_INCH);
-    ClearCore::ConnectorUsb.SendLine("[MotionController] Absolute position tracking initialized");
+    LOG_INFO(Motion, "[MotionController] Absolute position tracking initialized");
 }
 
 void MotionController::ClearAxisAlerts() {
-    ClearCore::ConnectorUsb.SendLine("[MotionController] Clearing all axis alerts");
+    LOG_INFO(Motion, "[MotionController] Clearing all axis alerts");
 
     // Clear any motor faults by cycling enable
     xAxis.ClearAlerts();
@@ -45,6 +54,9 @@ void MotionController::ClearAxisAlerts() {
 }
 
 void MotionController::update() {
+    LATENCY_PROBE("motion");
+    LOOP_WATCHDOG_MARK();
+    spindle.Update();
     xAxis.Update();
     yAxis.Update();
     zAxis.Update();
@@ -86,7 +98,7 @@ void MotionController::StartSpindle(float rpm) {
 
     // Respect E-Stop status
     if (!EStopManager::Instance().isSafetyRelayEnabled()) {
-        ClearCore::ConnectorUsb.SendLine("Cannot start spindle: E-STOP ACTIVE");
+        LOG_WARN(Motion, "Cannot start spindle: E-STOP ACTIVE");
         return;
     }
 
@@ -94,15 +106,13 @@ void MotionController::StartSpindle(float rpm) {
     spindle.Start(rpm);
 
     // Log via ConnectorUsb
-    ClearCore::ConnectorUsb.Send("Spindle ON @ ");
-    ClearCore::ConnectorUsb.Send(static_cast<int>(rpm));
-    ClearCore::ConnectorUsb.SendLine(" RPM");
+    LOG_INFO(Motion, "Spindle ON @ ", static_cast<int>(rpm), " RPM");
 }
 
 
 void MotionController::StopSpindle() {
     spindle.Stop();
-    ClearCore::ConnectorUsb.SendLine("Spindle OFF");
+    LOG_INFO(Motion, "Spindle OFF");
 }
 
 bool MotionController::IsSpindleRunning() const {
@@ -203,6 +213,67 @@ bool MotionController::jogBy(AxisId axis, float deltaInches, float scale) {
     return moveTo(axis, cur + deltaInches, scale);
 }
 
+bool MotionController::jogVelocity(AxisId axis, float inchesPerSec) {
+    switch (axis) {
+    case AXIS_X: return xAxis.JogVelocity(inchesPerSec);
+    case AXIS_Y: return yAxis.JogVelocity(inchesPerSec);
+    case AXIS_Z: break;
+    }
+    return false;
+}
+
+uint16_t MotionController::enqueueMove(AxisId axis, float positionInches, float velocityScale, bool blend) {
+    switch (axis) {
+    case AXIS_X: return xAxis.Enqueue(positionInches, velocityScale, blend);
+    case AXIS_Y: return yAxis.Enqueue(positionInches, velocityScale, blend);
+    case AXIS_Z: break;
+    }
+    return 0;
+}
+
+uint8_t MotionController::queueDepth(AxisId axis) const {
+    switch (axis) {
+    case AXIS_X: return xAxis.QueueDepth();
+    case AXIS_Y: return yAxis.QueueDepth();
+    case AXIS_Z: break;
+    }
+    return 0;
+}
+
+uint8_t MotionController::queueFree(AxisId axis) const {
+    switch (axis) {
+    case AXIS_X: return xAxis.QueueFree();
+    case AXIS_Y: return yAxis.QueueFree();
+    case AXIS_Z: break;
+    }
+    return 0;
+}
+
+bool MotionController::isSegmentDone(AxisId axis, uint16_t id) const {
+    switch (axis) {
+    case AXIS_X: return xAxis.IsSegmentDone(id);
+    case AXIS_Y: return yAxis.IsSegmentDone(id);
+    case AXIS_Z: break;
+    }
+    return true;
+}
+
+void MotionController::clearQueue(AxisId axis) {
+    switch (axis) {
+    case AXIS_X: xAxis.ClearQueue(); break;
+    case AXIS_Y: yAxis.ClearQueue(); break;
+    case AXIS_Z: break;
+    }
+}
+
+void MotionController::stopAxis(AxisId axis) {
+    switch (axis) {
+    case AXIS_X: xAxis.Stop(); break;
+    case AXIS_Y: yAxis.Stop(); break;
+    case AXIS_Z: zAxis.Stop(); break;
+    }
+}
+
 void MotionController::EmergencyStop() {
     spindle.EmergencyStop();
     xAxis.EmergencyStop();
@@ -261,7 +332,7 @@ bool MotionController::startTorqueControlledFeed(AxisId axis, float targetPositi
         return yAxis.StartTorqueControlledFeed(targetPosition, initialVelocityScale);
     }
 
-    ClearCore::ConnectorUsb.SendLine("[MotionController] Torque controlled feed only supported for Y-axis");
+    LOG_WARN(Motion, "[MotionController] Torque controlled feed only supported for Y-axis");
     return false; // Only Y-axis supports torque control currently
 }
 
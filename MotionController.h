@@ -46,6 +46,27 @@ public:
     /// Jog the given axis by a relative offset (inches), at the given speed scale (0..1)
     bool jogBy(AxisId axis, float deltaInches, float velocityScale);
 
+    /// Velocity command (inches/s, signed) for the MPG follower; X and Y only
+    bool jogVelocity(AxisId axis, float inchesPerSec);
+
+    //--- Queued Moves (X and Y) ---
+    /// Queue an absolute move; blend lets it run into the next same-direction
+    /// segment without stopping. Returns the segment id, 0 if refused or full.
+    uint16_t enqueueMove(AxisId axis, float positionInches, float velocityScale, bool blend = true);
+
+    /// Segments not yet complete / room left
+    uint8_t queueDepth(AxisId axis) const;
+    uint8_t queueFree(AxisId axis) const;
+
+    /// True once segment id has completed or was cleared away
+    bool isSegmentDone(AxisId axis, uint16_t id) const;
+
+    /// Drop queued segments; a move already running finishes on its own
+    void clearQueue(AxisId axis);
+
+    /// Decelerate to a stop, dropping any queued segments
+    void stopAxis(AxisId axis);
+
     //--- Absolute Position Tracking ---
     /// Get absolute encoder-verified position for an axis
     float getAbsoluteAxisPosition(AxisId axis) const;
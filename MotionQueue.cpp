@@ -0,0 +1,108 @@
+// MotionQueue.cpp
+#include "MotionQueue.h"
+#include "Log.h"
+
+MotionQueue::MotionQueue(MotorDriver* motor, float maxVelocity, float maxAcceleration, uint32_t jerkMax)
+    : _motor(motor)
+    , _maxVelocity(maxVelocity)
+    , _maxAcceleration(maxAcceleration)
+    , _jerkMax(jerkMax) {
+}
+
+uint16_t MotionQueue::push(int32_t targetSteps, float velocityScale, bool blend) {
+    if (_count >= MOTION_QUEUE_DEPTH) return 0;
+
+    if (velocityScale > 1.0f) velocityScale = 1.0f;
+    uint32_t velSteps = static_cast<uint32_t>(_maxVelocity * velocityScale);
+    if (velSteps < 1) velSteps = 1;
+
+    Segment& seg = at(_count);
+    seg.targetSteps = targetSteps;
+    seg.velSteps = velSteps;
+    seg.blend = blend;
+    seg.forward = true;
+    seg.id = _nextId;
+    if (++_nextId == 0) _nextId = 1;
+    _count++;
+    return seg.id;
+}
+
+void MotionQueue::clear() {
+    if (_count) _clearedThrough = at(_count - 1).id;
+    _head = 0;
+    _count = 0;
+    _issued = 0;
+}
+
+bool MotionQueue::isDone(uint16_t id) const {
+    if (id == 0) return true;
+    // Ids wrap, so compare by distance from the newest ones
+    auto notAfter = [id](uint16_t mark) {
+        return mark != 0 && static_cast<int16_t>(mark - id) >= 0;
+    };
+    return notAfter(_lastCompleted) || notAfter(_clearedThrough);
+}
+
+void MotionQueue::update() {
+    if (_count == 0) return;
+    int32_t pos = _motor->PositionRefCommanded();
+
+    // Retire segments whose end has been reached. A segment blended into the
+    // next is done once the axis passes its target; the one the motor is
+    // heading for is done when the steps stop.
+    while (_issued > 0) {
+        Segment& cur = at(0);
+        bool done = (_issued == 1)
+            ? _motor->StepsComplete()
+            : (cur.forward ? pos >= cur.targetSteps : pos <= cur.targetSteps);
+        if (!done) break;
+        retire();
+    }
+
+    if (_issued >= _count) return;
+    if (_issued == 0) {
+        // Nothing in flight: start the next segment from rest
+        if (!_motor->StepsComplete()) return;
+        if (at(0).targetSteps == pos) {
+            _issued++;      // Already there
+            retire();
+            return;
+        }
+        issue(at(0), pos);
+    }
+    else if (_issued == 1 && readyToBlend(at(0), at(1), pos)) {
+        issue(at(1), at(0).targetSteps);
+        LOG_DEBUG(Motion, "[Queue] Blend ", at(0).id, " -> ", at(1).id);
+    }
+}
+
+void MotionQueue::issue(Segment& seg, int32_t fromSteps) {
+    seg.forward = seg.targetSteps >= fromSteps;
+    _motor->VelMax(seg.velSteps);
+    _motor->Move(seg.targetSteps, StepGenerator::MOVE_TARGET_ABSOLUTE);
+    _issued++;
+}
+
+void MotionQueue::retire() {
+    _lastCompleted = at(0).id;
+    _head = (_head + 1) % MOTION_QUEUE_DEPTH;
+    _count--;
+    _issued--;
+}
+
+bool MotionQueue::readyToBlend(const Segment& cur, const Segment& next, int32_t posSteps) const {
+    if (!cur.blend || next.targetSteps == cur.targetSteps) return false;
+    if ((next.targetSteps > cur.targetSteps) != cur.forward) return false;
+
+    // Hand over just before the generator would start slowing for the
+    // current target. From there it either speeds up or slows to the next
+    // segment's velocity, which takes less distance than stopping did.
+    float v = static_cast<float>(abs(_motor->VelocityRefCommanded()));
+    float stopDist = v * v / (2.0f * _maxAcceleration);
+    if (_jerkMax) stopDist += v * _maxAcceleration / (2.0f * _jerkMax);
+    // Two motion updates of travel so the handover can't land late
+    float lead = v * (2.0f * TASK_PERIOD_MOTION_US / 1000000.0f);
+    float remaining = static_cast<float>(cur.forward ? cur.targetSteps - posSteps
+                                                     : posSteps - cur.targetSteps);
+    return remaining <= stopDist + lead;
+}
@@ -0,0 +1,72 @@
+// MotionQueue.h
+#pragma once
+
+#include <ClearCore.h>
+#include "Config.h"
+
+/// Short queue of absolute moves for one step-and-direction axis.
+///
+/// Callers push segments (target, velocity scale, blend) and poll for their
+/// completion by id instead of waiting for the motor to stop and then issuing
+/// the next move. update() feeds the step generator from the axis Update():
+/// a segment marked blend that is followed by one in the same direction is
+/// not stopped at - the next segment is issued while the axis is still
+/// moving, at the point where its own deceleration would have started, and
+/// the generator merges the two. Everything else (no blend, a direction
+/// change, the last segment) ends at rest as before.
+///
+///   uint16_t id = queue.push(targetSteps, 1.0f, true);
+///   ...
+///   if (queue.isDone(id)) { ... }
+class MotionQueue {
+public:
+    MotionQueue(MotorDriver* motor, float maxVelocity, float maxAcceleration, uint32_t jerkMax);
+
+    /// Queue a move to an absolute step position. Returns the segment id, or
+    /// 0 if the queue is full. Ids count up from 1 and wrap, skipping 0.
+    uint16_t push(int32_t targetSteps, float velocityScale, bool blend);
+
+    /// Issue and retire segments - call from the axis Update()
+    void update();
+
+    /// Forget every segment; the motor is left to the caller
+    void clear();
+
+    /// Segments not yet complete, including the one the motor is running
+    uint8_t depth() const { return _count; }
+    uint8_t freeSlots() const { return MOTION_QUEUE_DEPTH - _count; }
+    bool empty() const { return _count == 0; }
+
+    /// Id of the last segment that reached its end, 0 if none yet
+    uint16_t lastCompleted() const { return _lastCompleted; }
+
+    /// True once segment id has completed, or was cleared away
+    bool isDone(uint16_t id) const;
+
+private:
+    struct Segment {
+        int32_t  targetSteps;
+        uint32_t velSteps;   // steps/s
+        uint16_t id;
+        bool     blend;      // May run straight into the next segment
+        bool     forward;    // Direction, set when issued
+    };
+
+    Segment& at(uint8_t i) { return _ring[(_head + i) % MOTION_QUEUE_DEPTH]; }
+    void issue(Segment& seg, int32_t fromSteps);
+    void retire();
+    bool readyToBlend(const Segment& cur, const Segment& next, int32_t posSteps) const;
+
+    MotorDriver* const _motor;
+    const float _maxVelocity;      // steps/s
+    const float _maxAcceleration;  // steps/s^2
+    const uint32_t _jerkMax;       // steps/s^3, 0 = trapezoidal
+
+    Segment  _ring[MOTION_QUEUE_DEPTH];
+    uint8_t  _head = 0;            // Oldest incomplete segment
+    uint8_t  _count = 0;           // Incomplete segments
+    uint8_t  _issued = 0;          // Of those, already handed to the motor (0..2)
+    uint16_t _nextId = 1;
+    uint16_t _lastCompleted = 0;
+    uint16_t _clearedThrough = 0;  // Highest id dropped by clear()
+};
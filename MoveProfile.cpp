@@ -0,0 +1,137 @@
+// MoveProfile.cpp
+#include "MoveProfile.h"
+#include "Config.h"
+#include <math.h>
+
+MoveProfile::Limits MoveProfile::fence() {
+    Limits l = { FENCE_STEPS_PER_INCH, FENCE_VEL_MAX, FENCE_ACCEL_MAX, static_cast<float>(FENCE_MOVE_JERK) };
+    return l;
+}
+
+MoveProfile::Limits MoveProfile::table() {
+    Limits l = { TABLE_STEPS_PER_INCH, TABLE_VEL_MAX, TABLE_ACCEL_MAX, static_cast<float>(TABLE_MOVE_JERK) };
+    return l;
+}
+
+MoveProfile::Profile MoveProfile::plan(float inches, const Limits& limits) {
+    Profile p;
+    float dist = fabsf(inches) * limits.stepsPerInch;
+    if (dist < 1.0f) return p;
+    p.distance = dist;
+
+    // Per-sample units, as StepGenerator plans
+    const float sr = ClearCore::SampleRateHz;
+    float vel = limits.vel / sr;
+    float accel = limits.accel / (sr * sr);
+    float jerk = limits.jerk / (sr * sr * sr);
+
+    float rampTime = 0.0f;
+    float accelTime;
+    float cruiseTime = 0.0f;
+    if (jerk <= 0.0f) {
+        // Trapezoid
+        accelTime = vel / accel;
+        if (vel * accelTime <= dist) {
+            cruiseTime = (dist - vel * accelTime) / vel;
+        }
+        else {
+            accelTime = sqrtf(dist / accel);
+        }
+    }
+    else {
+        rampTime = accel / jerk;
+        if (vel * jerk < accel * accel) {
+            rampTime = sqrtf(vel / jerk);
+            accelTime = 0.0f;
+        }
+        else {
+            accelTime = vel / accel - rampTime;
+        }
+        float rampDist = vel * (2.0f * rampTime + accelTime);
+        if (rampDist <= dist) {
+            cruiseTime = (dist - rampDist) / vel;
+        }
+        else if (dist >= 2.0f * accel * (accel / jerk) * (accel / jerk)) {
+            rampTime = accel / jerk;
+            float peakVel = (sqrtf(accel * accel * rampTime * rampTime + 4.0f * accel * dist)
+                - accel * rampTime) / 2.0f;
+            accelTime = peakVel / accel - rampTime;
+            if (accelTime < 0.0f) accelTime = 0.0f;
+        }
+        else {
+            rampTime = cbrtf(dist / (2.0f * jerk));
+            accelTime = 0.0f;
+        }
+        p.rampSamples = static_cast<uint32_t>(ceilf(rampTime));
+        if (p.rampSamples < 1) p.rampSamples = 1;
+    }
+    p.accelSamples = static_cast<uint32_t>(ceilf(accelTime));
+    p.cruiseSamples = static_cast<uint32_t>(ceilf(cruiseTime));
+    if (!p.rampSamples && !p.accelSamples) p.accelSamples = 1;
+
+    // Stretched to whole samples: lower the peak so the distance is exact
+    float nj = static_cast<float>(p.rampSamples);
+    float na = static_cast<float>(p.accelSamples);
+    float nv = static_cast<float>(p.cruiseSamples);
+    p.peakAccel = dist / ((nj + na) * (2.0f * nj + na + nv));
+    p.jerk = p.rampSamples ? p.peakAccel / nj : 0.0f;
+    return p;
+}
+
+float MoveProfile::seconds(const Profile& p) {
+    uint32_t samples = 4 * p.rampSamples + 2 * p.accelSamples + p.cruiseSamples;
+    return p.distance > 0.0f ? static_cast<float>(samples) / ClearCore::SampleRateHz : 0.0f;
+}
+
+namespace {
+
+    // Distance covered after t samples, for t up to half the move
+    float firstHalf(const MoveProfile::Profile& p, float t) {
+        float nj = static_cast<float>(p.rampSamples);
+        float na = static_cast<float>(p.accelSamples);
+
+        float tau = t < nj ? t : nj;
+        float pos = p.jerk * tau * tau * tau / 6.0f;
+        float vel = p.jerk * tau * tau / 2.0f;
+        t -= tau;
+        if (t <= 0.0f) return pos;
+
+        tau = t < na ? t : na;
+        pos += vel * tau + p.peakAccel * tau * tau / 2.0f;
+        vel += p.peakAccel * tau;
+        t -= tau;
+        if (t <= 0.0f) return pos;
+
+        tau = t < nj ? t : nj;
+        pos += vel * tau + p.peakAccel * tau * tau / 2.0f - p.jerk * tau * tau * tau / 6.0f;
+        vel += p.peakAccel * tau - p.jerk * tau * tau / 2.0f;
+        t -= tau;
+        if (t <= 0.0f) return pos;
+
+        return pos + vel * t;
+    }
+
+    // The profile is symmetric: the second half mirrors the first
+    float positionAt(const MoveProfile::Profile& p, float t, float total) {
+        if (t >= total) return p.distance;
+        if (t * 2.0f <= total) return firstHalf(p, t);
+        return p.distance - firstHalf(p, total - t);
+    }
+}
+
+float MoveProfile::secondsToCover(const Profile& p, float inches, const Limits& limits) {
+    float total = seconds(p) * ClearCore::SampleRateHz;
+    float target = fabsf(inches) * limits.stepsPerInch;
+    if (target <= 0.0f) return 0.0f;
+    if (target >= p.distance) return total / ClearCore::SampleRateHz;
+
+    // Position is monotonic in time, so bisect
+    float lo = 0.0f;
+    float hi = total;
+    for (int i = 0; i < 24; i++) {
+        float mid = (lo + hi) / 2.0f;
+        if (positionAt(p, mid, total) < target) lo = mid;
+        else hi = mid;
+    }
+    return hi / ClearCore::SampleRateHz;
+}
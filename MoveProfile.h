@@ -0,0 +1,46 @@
+// MoveProfile.h
+#pragma once
+
+#include <stdint.h>
+
+/// Time model for one positional move, from rest to rest.
+///
+/// Mirrors StepGenerator's planning: the profile is laid out under the
+/// velocity, acceleration and jerk limits in per-sample units, each segment
+/// is rounded up to whole samples, and the peak acceleration is recomputed
+/// so the rounded profile covers the distance exactly. With no jerk limit
+/// it is the trapezoid. Used to predict cycle times, not to drive motors.
+///
+///   MoveProfile::Profile p = MoveProfile::plan(2.5f, MoveProfile::fence());
+///   float s = MoveProfile::seconds(p);
+namespace MoveProfile {
+
+    struct Limits {
+        float stepsPerInch;
+        float vel;      // steps/s
+        float accel;    // steps/s^2
+        float jerk;     // steps/s^3, 0 = trapezoidal
+    };
+
+    /// The axes' positional move limits from Config.h, trapezoidal unless
+    /// MOTION_SCURVE
+    Limits fence();
+    Limits table();
+
+    struct Profile {
+        float distance = 0.0f;      // Steps
+        uint32_t rampSamples = 0;   // Per jerk ramp (4 of them)
+        uint32_t accelSamples = 0;  // Per constant-accel segment (2)
+        uint32_t cruiseSamples = 0;
+        float peakAccel = 0.0f;     // Steps/sample^2
+        float jerk = 0.0f;          // Steps/sample^3
+    };
+
+    Profile plan(float inches, const Limits& limits);
+
+    /// Duration of the whole move
+    float seconds(const Profile& p);
+
+    /// Time into the move at which it has covered the given inches
+    float secondsToCover(const Profile& p, float inches, const Limits& limits);
+}
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <genieArduinoDEV.h>
-#include <Arduino.h>  // Needed for delay()
+#include "UiTimeline.h"
+#include "DisplayModel.h"
 
 // Abstract base class for all UI screens
 class Screen {
@@ -14,20 +15,42 @@ public:
     // Called when the screen is hidden (optional override)
     virtual void onHide() {}
 
-    // Handle incoming events from the Gen4 display
-    virtual void handleEvent(const genieFrame& e) = 0;
-
     // Optional per-frame update
     virtual void update() {}
 
+    // One starting value for an object on the screen's form
+    struct FieldInit {
+        uint8_t object;
+        uint8_t index;
+        uint16_t value;
+    };
+
+    // The form's fixed starting state. ScreenManager sends it in the burst
+    // after the form change, then onShow() adds what depends on the machine.
+    virtual const FieldInit* initialState(uint8_t& count) const {
+        count = 0;
+        return nullptr;
+    }
+
 protected:
-    // Simplified button writer with optional delay
-    void showButtonSafe(uint16_t winButtonId, uint16_t value = 1, uint16_t delayMs = 0) {
-        extern Genie genie;
-        genie.WriteObject(GENIE_OBJ_WINBUTTON, winButtonId, value);
-        // Only delay if explicitly requested
-        if (delayMs > 0) {
-            delay(delayMs);
-        }
+    // Simplified button writer; a direct write supersedes any pending flash
+    void showButtonSafe(uint16_t winButtonId, uint16_t value = 1) {
+        UiTimeline::Instance().stop(GENIE_OBJ_WINBUTTON, winButtonId);
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, winButtonId, value);
+    }
+
+    // Momentary press feedback without blocking the loop
+    void flashButton(uint16_t winButtonId, uint16_t holdMs = 200) {
+        UiTimeline::Instance().flash(winButtonId, holdMs);
+    }
+
+    // Error feedback: quick on/off blinks, ending off
+    void blinkButton(uint16_t winButtonId, uint8_t times = 2, uint16_t periodMs = 50) {
+        UiTimeline::Instance().blink(winButtonId, times, periodMs);
+    }
+
+    // Any other keyframed indicator - LEDs, strings, gauge sweeps
+    void animate(uint8_t object, uint8_t index, const UiTimeline::Keyframe* keys, uint8_t count) {
+        UiTimeline::Instance().play(object, index, keys, count);
     }
 };
@@ -1,11 +1,12 @@
 ﻿// ScreenManager.cpp - Updated with SetupAutocutScreen
 #include "ScreenManager.h"
+#include "DisplayModel.h"
+#include "UiTimeline.h"
 #include "Config.h"
+#include "Log.h"
 #include <ClearCore.h>
 #include "MPGJogManager.h"
 
-extern Genie genie;  // reference to global UI instance
-
 ScreenManager& ScreenManager::Instance() {
     static ScreenManager inst;
     return inst;
@@ -26,10 +27,15 @@ ScreenManager::ScreenManager()
 }
 
 void ScreenManager::Init() {
-    // Show splash briefly then manual mode
+    // Feed-hold and cycle-stop state must not wait behind readouts
+    auto& display = DisplayModel::Instance();
+    display.setLane(GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_HOLD, DisplayModel::LANE_CRITICAL);
+    display.setLane(GENIE_OBJ_WINBUTTON, WINBUTTON_EXIT_FEED_HOLD, DisplayModel::LANE_CRITICAL);
+    display.setLane(GENIE_OBJ_WINBUTTON, WINBUTTON_SLIDE_HOLD_F5, DisplayModel::LANE_CRITICAL);
+    display.setLane(GENIE_OBJ_WINBUTTON, WINBUTTON_END_CYCLE_F5, DisplayModel::LANE_CRITICAL);
+
+    // Splash until the display answers; BootSequence moves on to manual mode
     writeForm(FORM_SPLASH);
-    Delay_ms(500);
-    ShowManualMode();
 }
 
 void ScreenManager::writeForm(uint8_t formId) {
@@ -37,14 +43,14 @@ void ScreenManager::writeForm(uint8_t formId) {
     if (_currentForm == formId) return;
 
     // Debug info
-    ClearCore::ConnectorUsb.Send("[SM] writeForm: from ");
-    ClearCore::ConnectorUsb.Send(_currentForm);
-    ClearCore::ConnectorUsb.Send(" → ");
-    ClearCore::ConnectorUsb.SendLine(formId);
+    LOG_INFO(Genie, "[SM] writeForm: from ", _currentForm, " → ", formId);
 
     // Clean exit current screen
     if (_currentScreen) _currentScreen->onHide();
 
+    // Finish any flashes now so no button is left lit for the next visit
+    UiTimeline::Instance().settleAll();
+
     // Disable jog mode when leaving jog screens
     if (_currentForm == FORM_JOG_X || _currentForm == FORM_JOG_Y || _currentForm == FORM_JOG_Z) {
         MPGJogManager::Instance().setEnabled(false);
@@ -54,22 +60,43 @@ void ScreenManager::writeForm(uint8_t formId) {
     _lastForm = _currentForm;
     _currentForm = formId;
 
+    drawCurrentForm(true);
+}
+
+void ScreenManager::Redraw() {
+    if (_currentForm == 255) return;
+    LOG_INFO(Genie, "[SM] Redraw form ", _currentForm);
+    // The screen is still active - only its picture went away
+    drawCurrentForm(false);
+}
+
+void ScreenManager::drawCurrentForm(bool entering) {
     // Change form and let the display handle its own transition
-    genie.WriteObject(GENIE_OBJ_FORM, formId, 0);
-    delay(100); // Give display time to fully load form before changes
+    auto& display = DisplayModel::Instance();
+    display.showForm(_currentForm);
+    // No settle delay needed: the form write waits for the display ACK,
+    // and later object writes queue behind it
 
-    // Initialize the new screen
+    // Initialize the new screen; everything it sets here goes out as one burst
     _currentScreen = currentScreen();
-    if (_currentScreen) _currentScreen->onShow();
+    if (_currentScreen) {
+        uint8_t count = 0;
+        const Screen::FieldInit* init = _currentScreen->initialState(count);
+        for (uint8_t i = 0; i < count; i++) {
+            display.set(init[i].object, init[i].index, init[i].value);
+        }
+        if (entering) _currentScreen->onShow();
+    }
+    display.endBurst();
 }
 
 void ScreenManager::clearAllLeds() {
     // Only clear a few specific LEDs that might cause rogue digits
-    genie.WriteObject(GENIE_OBJ_LED, LED_NEGATIVE_INDICATOR, 0); // For JogXScreen
-    genie.WriteObject(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 0); // For JogYScreen
-    genie.WriteObject(GENIE_OBJ_LED, LED_READY, 0); // For SemiAutoScreen
-    genie.WriteObject(GENIE_OBJ_LED, LED_FEED_RATE_OFFSET_F2, 0);
-    genie.WriteObject(GENIE_OBJ_LED, LED_CUT_PRESSURE_OFFSET_F2, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_NEGATIVE_INDICATOR, 0); // For JogXScreen
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_AT_START_POSITION_Y, 0); // For JogYScreen
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 0); // For SemiAutoScreen
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_FEED_RATE_OFFSET_F2, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_CUT_PRESSURE_OFFSET_F2, 0);
 }
 
 void ScreenManager::ShowSplash() { writeForm(FORM_SPLASH); }
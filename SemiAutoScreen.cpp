@@ -1,4 +1,9 @@
 ﻿#include "SemiAutoScreen.h"
+#include "DisplayModel.h"
+#include "DisplayValue.h"
+#include "LatencyProfiler.h"
+#include "Log.h"
+#include "LoopWatchdog.h"
 #include "screenmanager.h" 
 #include "MotionController.h"
 #include "UIInputManager.h"
@@ -8,24 +13,32 @@
 #include <ClearCore.h>
 #include "Config.h"
 
-#ifndef GENIE_OBJ_LED_DIGITS
-#define GENIE_OBJ_LED_DIGITS 15
-#endif
-
-extern Genie genie;
-
 SemiAutoScreen::SemiAutoScreen(ScreenManager& mgr)
     : _mgr(mgr), _spindleLoadMeter(IGAUGE_SEMIAUTO_LOAD_METER) {
 }
 
-void SemiAutoScreen::updateButtonState(uint16_t buttonId, bool state, const char* logMessage, uint16_t delayMs) {
-    showButtonSafe(buttonId, state ? 1 : 0, delayMs);
+void SemiAutoScreen::updateButtonState(uint16_t buttonId, bool state, const char* logMessage) {
+    showButtonSafe(buttonId, state ? 1 : 0);
 
     if (logMessage) {
-        ClearCore::ConnectorUsb.SendLine(logMessage);
+        LOG_INFO(UI, logMessage);
     }
 }
 
+static const Screen::FieldInit SEMI_AUTO_INITIAL[] = {
+    { GENIE_OBJ_LED, LED_READY, 1 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_TO_STOP, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_HOLD, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_EXIT_FEED_HOLD, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_ADJUST_CUT_PRESSURE, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_ADJUST_MAX_SPEED, 0 },
+};
+
+const Screen::FieldInit* SemiAutoScreen::initialState(uint8_t& count) const {
+    count = sizeof(SEMI_AUTO_INITIAL) / sizeof(SEMI_AUTO_INITIAL[0]);
+    return SEMI_AUTO_INITIAL;
+}
+
 void SemiAutoScreen::onShow() {
     // Clean up fields
     UIInputManager::Instance().unbindField();
@@ -43,17 +56,11 @@ void SemiAutoScreen::onShow() {
     // Set spindle button state
     auto& mc = MotionController::Instance();
     bool spindleActive = mc.IsSpindleRunning();
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SPINDLE_ON, spindleActive ? 1 : 0);
+    DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_SPINDLE_ON, spindleActive ? 1 : 0);
 
-    // Reset to ready state
+    // Reset to ready state (the LED and buttons come from SEMI_AUTO_INITIAL)
     _currentState = STATE_READY;
     _isReturningToStart = false;
-    genie.WriteObject(GENIE_OBJ_LED, LED_READY, 1);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_TO_STOP, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_HOLD, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_EXIT_FEED_HOLD, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_ADJUST_CUT_PRESSURE, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_ADJUST_MAX_SPEED, 0);
 
     // Get the thickness directly from CutData
     auto& cutData = _mgr.GetCutData();
@@ -66,6 +73,10 @@ void SemiAutoScreen::onHide() {
         MotionController::Instance().abortTorqueControlledFeed(AXIS_Y);
     }
 
+    // The hold exit only advances from update(): drop any step still pending
+    // so it can't fire on the next visit
+    _feedHoldManager.reset();
+
     // Let torque control UI clean up
     _torqueControlUI.onHide();
 
@@ -77,12 +88,12 @@ void SemiAutoScreen::onHide() {
     UIInputManager::Instance().unbindField();
 
     // Clear all visual indicators
-    genie.WriteObject(GENIE_OBJ_LED, LED_READY, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_TO_STOP, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_HOLD, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_EXIT_FEED_HOLD, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_ADJUST_CUT_PRESSURE, 0);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_ADJUST_MAX_SPEED, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_TO_STOP, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_FEED_HOLD, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_EXIT_FEED_HOLD, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_ADJUST_CUT_PRESSURE, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_ADJUST_MAX_SPEED, 0);
 }
 
 void SemiAutoScreen::startFeedToStop() {
@@ -93,8 +104,7 @@ void SemiAutoScreen::startFeedToStop() {
     float startPos = motion.getAbsoluteAxisPosition(AXIS_Y);
     _feedHoldManager.setStartPosition(startPos);
 
-    ClearCore::ConnectorUsb.Send("[SemiAuto] Setting initial feed start position: ");
-    ClearCore::ConnectorUsb.SendLine(startPos);
+    LOG_INFO(Feed, "[SemiAuto] Setting initial feed start position: ", startPos);
 
     // Get current values from torque control UI
     float feedRate = _torqueControlUI.getCurrentFeedRate();
@@ -111,30 +121,27 @@ void SemiAutoScreen::startFeedToStop() {
     motion.setTorqueTarget(AXIS_Y, torqueTarget);
 
     // Log the operation
-    ClearCore::ConnectorUsb.Send("[SemiAuto] Starting feed to ");
-    ClearCore::ConnectorUsb.Send(cutData.cutEndPoint);
-    ClearCore::ConnectorUsb.Send(" inches with torque target ");
-    ClearCore::ConnectorUsb.Send(torqueTarget);
-    ClearCore::ConnectorUsb.SendLine("%");
+    LOG_INFO(Feed, "[SemiAuto] Starting feed to ", cutData.cutEndPoint,
+        " inches with torque target ", torqueTarget, "%");
 
     // Start torque-controlled feed to the cut end position
     if (motion.startTorqueControlledFeed(AXIS_Y, cutData.cutEndPoint, feedRate)) {
         _currentState = STATE_CUTTING;
 
         // Update UI to show cutting state - use safe update methods for buttons
-        genie.WriteObject(GENIE_OBJ_LED, LED_READY, 0); // Turn off ready LED
-        updateButtonState(WINBUTTON_FEED_TO_STOP, true, nullptr, 10);
-        updateButtonState(WINBUTTON_FEED_HOLD, false, nullptr, 10);
-        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false, nullptr, 10);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 0); // Turn off ready LED
+        updateButtonState(WINBUTTON_FEED_TO_STOP, true);
+        updateButtonState(WINBUTTON_FEED_HOLD, false);
+        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false);
 
         // Only disable adjustment buttons if not currently adjusting
         if (!_torqueControlUI.isAdjusting()) {
-            updateButtonState(WINBUTTON_ADJUST_CUT_PRESSURE, false, nullptr, 10);
-            updateButtonState(WINBUTTON_ADJUST_MAX_SPEED, false, nullptr, 10);
+            updateButtonState(WINBUTTON_ADJUST_CUT_PRESSURE, false);
+            updateButtonState(WINBUTTON_ADJUST_MAX_SPEED, false);
         }
 
         // Initialize gauge with a reasonable value based on target
-        genie.WriteObject(GENIE_OBJ_IGAUGE, IGAUGE_SEMIAUTO_CUT_PRESSURE, 50); // Start at 50% to avoid red
+        DisplayModel::Instance().set(GENIE_OBJ_IGAUGE, IGAUGE_SEMIAUTO_CUT_PRESSURE, 50); // Start at 50% to avoid red
     }
 }
 
@@ -152,14 +159,14 @@ void SemiAutoScreen::feedHold() {
             _currentState = STATE_PAUSED;
         }
         else {
-            ClearCore::ConnectorUsb.SendLine("[SemiAuto] Pausing while maintaining adjustment mode");
+            LOG_INFO(Feed, "[SemiAuto] Pausing while maintaining adjustment mode");
         }
 
         // Set feed hold button active
-        updateButtonState(WINBUTTON_FEED_HOLD, true, "[SemiAuto] Feed paused", 20);
+        updateButtonState(WINBUTTON_FEED_HOLD, true, "[SemiAuto] Feed paused");
 
         // Then show exit button (inactive state for latching button)
-        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false, nullptr, 50);
+        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false);
     }
     else {
         // If we're resuming and were in an adjustment state, store that knowledge
@@ -167,10 +174,10 @@ void SemiAutoScreen::feedHold() {
             _currentState == STATE_ADJUSTING_FEED_RATE);
 
         _currentState = STATE_CUTTING;
-        updateButtonState(WINBUTTON_FEED_HOLD, false, "[SemiAuto] Feed resumed", 20);
+        updateButtonState(WINBUTTON_FEED_HOLD, false, "[SemiAuto] Feed resumed");
 
         // Hide exit button when resumed
-        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false, nullptr, 0);
+        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false);
 
         // Restore adjustment button state if we were adjusting
         if (wasAdjusting) {
@@ -189,12 +196,11 @@ void SemiAutoScreen::exitFeedHold() {
 
     // Log the start position for verification
     float returnPos = _feedHoldManager.getStartPosition();
-    ClearCore::ConnectorUsb.Send("[SemiAuto] Exit feed hold, returning to position: ");
-    ClearCore::ConnectorUsb.SendLine(returnPos);
+    LOG_INFO(Feed, "[SemiAuto] Exit feed hold, returning to position: ", returnPos);
 
     // The exit button should already be in active state (1) from the user pressing it
     // Just ensure it stays visible during return
-    updateButtonState(WINBUTTON_EXIT_FEED_HOLD, true, nullptr, 20);
+    updateButtonState(WINBUTTON_EXIT_FEED_HOLD, true);
 
     // Delegate to FeedHoldManager for abort/return logic
     _feedHoldManager.exitFeedHold();
@@ -208,11 +214,11 @@ void SemiAutoScreen::adjustCutPressure() {
     auto newMode = _torqueControlUI.getCurrentMode();
     if (newMode == TorqueControlUI::ADJUSTMENT_CUT_PRESSURE) {
         _currentState = STATE_ADJUSTING_PRESSURE;
-        genie.WriteObject(GENIE_OBJ_LED, LED_READY, 0);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 0);
     }
     else {
         _currentState = STATE_READY;
-        genie.WriteObject(GENIE_OBJ_LED, LED_READY, 1);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 1);
     }
 
     // Update button states
@@ -230,11 +236,11 @@ void SemiAutoScreen::adjustMaxFeedRate() {
     auto newMode = _torqueControlUI.getCurrentMode();
     if (newMode == TorqueControlUI::ADJUSTMENT_FEED_RATE) {
         _currentState = STATE_ADJUSTING_FEED_RATE;
-        genie.WriteObject(GENIE_OBJ_LED, LED_READY, 0);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 0);
     }
     else {
         _currentState = STATE_READY;
-        genie.WriteObject(GENIE_OBJ_LED, LED_READY, 1);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 1);
     }
 
     // Update button states
@@ -254,134 +260,109 @@ void SemiAutoScreen::advanceIncrement() {
     }
 }
 
-void SemiAutoScreen::handleEvent(const genieFrame& e) {
-    if (e.reportObject.cmd != GENIE_REPORT_EVENT) {
-        return;
+void SemiAutoScreen::feedToStopPressed() {
+    if (_currentState == STATE_READY) {
+        startFeedToStop();
+    }
+    else if (_currentState == STATE_CUTTING || _currentState == STATE_PAUSED || _currentState == STATE_RETURNING) {
+        // If button is pressed during active cycle, force it back to active state
+        updateButtonState(WINBUTTON_FEED_TO_STOP, true, "[SemiAuto] Feed cycle in progress");
     }
+}
 
-    switch (e.reportObject.object) {
-    case GENIE_OBJ_WINBUTTON:
-        switch (e.reportObject.index) {
-        case WINBUTTON_FEED_TO_STOP:
-            if (_currentState == STATE_READY) {
-                startFeedToStop();
-            }
-            else if (_currentState == STATE_CUTTING || _currentState == STATE_PAUSED || _currentState == STATE_RETURNING) {
-                // If button is pressed during active cycle, force it back to active state
-                updateButtonState(WINBUTTON_FEED_TO_STOP, true, "[SemiAuto] Feed cycle in progress", 0);
-            }
-            break;
-
-        case WINBUTTON_FEED_HOLD:
-            if (_currentState == STATE_CUTTING || _currentState == STATE_PAUSED ||
-                _currentState == STATE_ADJUSTING_PRESSURE || _currentState == STATE_ADJUSTING_FEED_RATE) {
-                // Save current adjustment state if needed
-                SemiAutoScreenState previousState = _currentState;
-
-                // Apply feed hold action
-                feedHold();
-
-                // If we were in an adjustment state, preserve it while paused
-                if ((previousState == STATE_ADJUSTING_PRESSURE || previousState == STATE_ADJUSTING_FEED_RATE)
-                    && _currentState == STATE_PAUSED) {
-                    _currentState = previousState;
-
-                    // Make sure appropriate adjustment button stays active
-                    _torqueControlUI.updateButtonStates(
-                        WINBUTTON_ADJUST_CUT_PRESSURE,
-                        WINBUTTON_ADJUST_MAX_SPEED
-                    );
-
-                    ClearCore::ConnectorUsb.SendLine("[SemiAuto] Maintaining adjustment mode while paused");
-                }
-            }
-            else {
-                // If button is pressed when not in a valid state, force it back to its proper state
-                bool shouldBeActive = (_currentState == STATE_PAUSED);
-                updateButtonState(WINBUTTON_FEED_HOLD, shouldBeActive, "[SemiAuto] Feed hold not available", 0);
-            }
-            break;
+void SemiAutoScreen::feedHoldPressed() {
+    if (_currentState == STATE_CUTTING || _currentState == STATE_PAUSED ||
+        _currentState == STATE_ADJUSTING_PRESSURE || _currentState == STATE_ADJUSTING_FEED_RATE) {
+        // Save current adjustment state if needed
+        SemiAutoScreenState previousState = _currentState;
 
-        case WINBUTTON_EXIT_FEED_HOLD:
-            if (_feedHoldManager.isPaused() && !_isReturningToStart) {
-                exitFeedHold(); // Normal operation
-            }
-            else {
-                // If button is pressed when not paused or already returning, force back to proper state
-                bool shouldBeActive = _isReturningToStart;
-                updateButtonState(WINBUTTON_EXIT_FEED_HOLD, shouldBeActive, "[SemiAuto] Exit feed not available", 0);
-            }
-            break;
+        // Apply feed hold action
+        feedHold();
 
-        case WINBUTTON_ADJUST_CUT_PRESSURE:
-            adjustCutPressure();
-            break;
+        // If we were in an adjustment state, preserve it while paused
+        if ((previousState == STATE_ADJUSTING_PRESSURE || previousState == STATE_ADJUSTING_FEED_RATE)
+            && _currentState == STATE_PAUSED) {
+            _currentState = previousState;
 
-        case WINBUTTON_ADJUST_MAX_SPEED:
-            adjustMaxFeedRate();
-            break;
+            // Make sure appropriate adjustment button stays active
+            _torqueControlUI.updateButtonStates(
+                WINBUTTON_ADJUST_CUT_PRESSURE,
+                WINBUTTON_ADJUST_MAX_SPEED
+            );
 
-        case WINBUTTON_SPINDLE_ON:
-            if (MotionController::Instance().IsSpindleRunning()) {
-                // Stop the spindle
-                MotionController::Instance().StopSpindle();
-                updateButtonState(WINBUTTON_SPINDLE_ON, false, "[SemiAuto] Spindle stopped", 0);
-            }
-            else {
-                // Get RPM from settings
-                float rpm = SettingsManager::Instance().settings().spindleRPM;
+            LOG_INFO(Feed, "[SemiAuto] Maintaining adjustment mode while paused");
+        }
+    }
+    else {
+        // If button is pressed when not in a valid state, force it back to its proper state
+        bool shouldBeActive = (_currentState == STATE_PAUSED);
+        updateButtonState(WINBUTTON_FEED_HOLD, shouldBeActive, "[SemiAuto] Feed hold not available");
+    }
+}
 
-                ClearCore::ConnectorUsb.Send("[SemiAuto] Starting spindle at rpm: ");
-                ClearCore::ConnectorUsb.SendLine(rpm);
+void SemiAutoScreen::exitFeedHoldPressed() {
+    if (_feedHoldManager.isPaused() && !_isReturningToStart) {
+        exitFeedHold(); // Normal operation
+    }
+    else {
+        // If button is pressed when not paused or already returning, force back to proper state
+        bool shouldBeActive = _isReturningToStart;
+        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, shouldBeActive, "[SemiAuto] Exit feed not available");
+    }
+}
 
-                // Start the spindle with the RPM from settings
-                MotionController::Instance().StartSpindle(rpm);
-                updateButtonState(WINBUTTON_SPINDLE_ON, true, "[SemiAuto] Spindle started", 0);
-            }
-            break;
+void SemiAutoScreen::toggleSpindle() {
+    if (MotionController::Instance().IsSpindleRunning()) {
+        // Stop the spindle
+        MotionController::Instance().StopSpindle();
+        updateButtonState(WINBUTTON_SPINDLE_ON, false, "[SemiAuto] Spindle stopped");
+    }
+    else {
+        // Get RPM from settings
+        float rpm = SettingsManager::Instance().settings().spindleRPM;
 
-        case WINBUTTON_INC_PLUS_F2:
-            advanceIncrement();
-            break;
+        LOG_INFO(Feed, "[SemiAuto] Starting spindle at rpm: ", rpm);
 
-        case WINBUTTON_INC_MINUS_F2:
-            if (_torqueControlUI.isAdjusting()) {
-                _torqueControlUI.decrementValue();
-            }
-            else {
-                JogUtilities::Decrement(_mgr.GetCutData(), AXIS_X);
-            }
-            break;
-
-        case WINBUTTON_SETTINGS_SEMI:
-            ScreenManager::Instance().ShowSettings();
-            break;
-
-        case WINBUTTON_HOME_F2:
-            JogUtilities::GoToZero(_mgr.GetCutData(), AXIS_X);
-            break;
-
-        case WINBUTTON_STOCK_ZERO:
-            JogUtilities::GoToZero(_mgr.GetCutData(), AXIS_X);
-            showButtonSafe(WINBUTTON_STOCK_ZERO, 1);
-            delay(200);
-            showButtonSafe(WINBUTTON_STOCK_ZERO, 0);
-            break;
-        }
-        break;
+        // Start the spindle with the RPM from settings
+        MotionController::Instance().StartSpindle(rpm);
+        updateButtonState(WINBUTTON_SPINDLE_ON, true, "[SemiAuto] Spindle started");
     }
 }
 
+void SemiAutoScreen::retreatIncrement() {
+    if (_torqueControlUI.isAdjusting()) {
+        _torqueControlUI.decrementValue();
+    }
+    else {
+        JogUtilities::Decrement(_mgr.GetCutData(), AXIS_X);
+    }
+}
+
+void SemiAutoScreen::goToZero() {
+    JogUtilities::GoToZero(_mgr.GetCutData(), AXIS_X);
+}
+
+void SemiAutoScreen::goToStockZero() {
+    JogUtilities::GoToZero(_mgr.GetCutData(), AXIS_X);
+    flashButton(WINBUTTON_STOCK_ZERO);
+}
+
 void SemiAutoScreen::update() {
+    LATENCY_PROBE("screen.semiauto");
+    LOOP_WATCHDOG_MARK();
     auto& motion = MotionController::Instance();
     auto& cutData = _mgr.GetCutData();
 
+    // Advance any in-progress exit from feed hold
+    _feedHoldManager.update();
+    bool exitingHold = _feedHoldManager.isExiting();
+
     // Update torque control UI (handles gauge, encoder, displays)
     _torqueControlUI.update();
 
     // Update RPM display
-    uint16_t rpm = motion.IsSpindleRunning() ? (uint16_t)motion.CommandedRPM() : 0;
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_RPM_DISPLAY, rpm);
+    float rpm = motion.IsSpindleRunning() ? motion.CommandedRPM() : 0.0f;
+    DisplayValue::show(LEDDIGITS_RPM_DISPLAY, rpm);
 
     // Update the spindle load meter
     _spindleLoadMeter.Update();
@@ -395,8 +376,7 @@ void SemiAutoScreen::update() {
     float currentPos = motion.getAbsoluteAxisPosition(AXIS_Y);
     float distanceToGo = cutData.cutEndPoint - currentPos;
     if (distanceToGo < 0.0f) distanceToGo = 0.0f;
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_DISTANCE_TO_GO_F2,
-        static_cast<uint16_t>(distanceToGo * 1000));
+    DisplayValue::show(LEDDIGITS_DISTANCE_TO_GO_F2, distanceToGo);
 
     // Check for feed cycle completion
     static bool wasCuttingOrPaused = false;
@@ -405,7 +385,8 @@ void SemiAutoScreen::update() {
         wasCuttingOrPaused = true;
     }
 
-    if (wasCuttingOrPaused && !motion.isInTorqueControlledFeed(AXIS_Y) && !motion.isAxisMoving(AXIS_Y)) {
+    if (wasCuttingOrPaused && !exitingHold &&
+        !motion.isInTorqueControlledFeed(AXIS_Y) && !motion.isAxisMoving(AXIS_Y)) {
         wasCuttingOrPaused = false;
 
         // Exit any adjustment mode on completion
@@ -422,19 +403,19 @@ void SemiAutoScreen::update() {
 
         // Set state to ready
         _currentState = STATE_READY;
-        genie.WriteObject(GENIE_OBJ_LED, LED_READY, 1);
+        DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 1);
 
         // Reset all buttons
-        updateButtonState(WINBUTTON_FEED_TO_STOP, false, "[SemiAuto] Feed cycle completed", 10);
-        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false, nullptr, 10);
-        updateButtonState(WINBUTTON_FEED_HOLD, false, nullptr, 10);
+        updateButtonState(WINBUTTON_FEED_TO_STOP, false, "[SemiAuto] Feed cycle completed");
+        updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false);
+        updateButtonState(WINBUTTON_FEED_HOLD, false);
 
-        ClearCore::ConnectorUsb.SendLine("[SemiAuto] Feed cycle completed, all states reset");
+        LOG_INFO(Feed, "[SemiAuto] Feed cycle completed, all states reset");
     }
 
     // Monitor return motion completion
     if (_isReturningToStart) {
-        if (!motion.isInTorqueControlledFeed(AXIS_Y) && !motion.isAxisMoving(AXIS_Y)) {
+        if (!exitingHold && !motion.isInTorqueControlledFeed(AXIS_Y) && !motion.isAxisMoving(AXIS_Y)) {
             _isReturningToStart = false;
 
             // Exit any adjustment mode
@@ -447,12 +428,12 @@ void SemiAutoScreen::update() {
             }
 
             _currentState = STATE_READY;
-            updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false, nullptr, 10);
-            updateButtonState(WINBUTTON_FEED_TO_STOP, false, nullptr, 10);
-            updateButtonState(WINBUTTON_FEED_HOLD, false, nullptr, 10);
-            genie.WriteObject(GENIE_OBJ_LED, LED_READY, 1);
+            updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false);
+            updateButtonState(WINBUTTON_FEED_TO_STOP, false);
+            updateButtonState(WINBUTTON_FEED_HOLD, false);
+            DisplayModel::Instance().set(GENIE_OBJ_LED, LED_READY, 1);
 
-            ClearCore::ConnectorUsb.SendLine("[SemiAuto] Return complete, ready for new operation");
+            LOG_INFO(Feed, "[SemiAuto] Return complete, ready for new operation");
         }
     }
 
@@ -463,9 +444,9 @@ void SemiAutoScreen::update() {
 
         if (now - lastButtonCheck > 500) {
             lastButtonCheck = now;
-            updateButtonState(WINBUTTON_FEED_TO_STOP, true, nullptr, 0);
+            updateButtonState(WINBUTTON_FEED_TO_STOP, true);
             bool isPaused = _feedHoldManager.isPaused();
-            updateButtonState(WINBUTTON_FEED_HOLD, isPaused, nullptr, 0);
+            updateButtonState(WINBUTTON_FEED_HOLD, isPaused);
         }
     }
 
@@ -476,16 +457,15 @@ void SemiAutoScreen::update() {
 
         if (now - lastExitButtonCheck > 500) {
             lastExitButtonCheck = now;
-            updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false, nullptr, 0);
-            updateButtonState(WINBUTTON_FEED_HOLD, true, nullptr, 0);
+            updateButtonState(WINBUTTON_EXIT_FEED_HOLD, false);
+            updateButtonState(WINBUTTON_FEED_HOLD, true);
         }
     }
 }
 
 void SemiAutoScreen::UpdateThicknessLed(float thickness) {
     m_lastThickness = thickness;
-    int32_t scaled = static_cast<int32_t>(round(thickness * 1000.0f));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_THICKNESS_F2, static_cast<uint16_t>(scaled));
+    DisplayValue::show(LEDDIGITS_THICKNESS_F2, thickness);
 }
 
 void SemiAutoScreen::updateFeedRateDisplay() {
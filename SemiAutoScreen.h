@@ -13,8 +13,20 @@ public:
 
     void onShow() override;
     void onHide() override;
-    void handleEvent(const genieFrame& e) override;
     void update() override;
+    const FieldInit* initialState(uint8_t& count) const override;
+
+    // Button actions, routed here by EventRouter
+    void feedToStopPressed();
+    void feedHoldPressed();
+    void exitFeedHoldPressed();
+    void adjustCutPressure();
+    void adjustMaxFeedRate();
+    void toggleSpindle();
+    void advanceIncrement();
+    void retreatIncrement();
+    void goToZero();
+    void goToStockZero();
 
 private:
     enum SemiAutoScreenState {
@@ -29,10 +41,7 @@ private:
     void startFeedToStop();
     void feedHold();
     void exitFeedHold();
-    void adjustCutPressure();
-    void adjustMaxFeedRate();
-    void advanceIncrement();
-    void updateButtonState(uint16_t buttonId, bool state, const char* logMessage = nullptr, uint16_t delayMs = 0);
+    void updateButtonState(uint16_t buttonId, bool state, const char* logMessage = nullptr);
     void UpdateThicknessLed(float thickness);
     void updateFeedRateDisplay();
 
@@ -1,33 +1,48 @@
 ﻿// Update to Autosaw_main/SettingsScreen.cpp
 
 #include "SettingsScreen.h"
+#include "DisplayModel.h"
+#include "DisplayValue.h"
+#include "LatencyProfiler.h"
 #include "ScreenManager.h"
 #include "SettingsManager.h"
 #include "UIInputManager.h"
 #include "MPGJogManager.h"  // Added for MPG functionality
 #include "PendantManager.h"
-#include <cmath>
+#include "Log.h"
 
-extern Genie genie;
 
 SettingsScreen::SettingsScreen(ScreenManager& mgr) : _mgr(mgr) {}
 
+static const Screen::FieldInit SETTINGS_INITIAL[] = {
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RPM_SETTINGS, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_FEEDRATE_SETTINGS, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RAPID_SETTINGS, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_DIAMETER_SETTINGS, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_THICKNESS_SETTINGS, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SET_CUT_PRESSURE_F3, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_BACK, 0 },
+};
+
+const Screen::FieldInit* SettingsScreen::initialState(uint8_t& count) const {
+    count = sizeof(SETTINGS_INITIAL) / sizeof(SETTINGS_INITIAL[0]);
+    return SETTINGS_INITIAL;
+}
+
 void SettingsScreen::onShow() {
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_BACK, 0);
-    delay(50);
-    genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_BACK, 0);
+    UiTimeline::Instance().writeLater(GENIE_OBJ_WINBUTTON, WINBUTTON_BACK, 0, 50);
 
     auto& S = SettingsManager::Instance().settings();
 
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_DIAMETER_SETTINGS, (uint16_t)round(S.bladeDiameter * 10.0f));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_THICKNESS_SETTINGS, (uint16_t)round(S.bladeThickness * 1000.0f));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_RPM_SETTINGS, (uint16_t)S.spindleRPM);
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_FEEDRATE_SETTINGS, (uint16_t)round(S.feedRate * 10.0f));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_RAPID_SETTINGS, (uint16_t)round(S.rapidRate * 10.0f));
+    DisplayValue::show(LEDDIGITS_DIAMETER_SETTINGS, S.bladeDiameter);
+    DisplayValue::show(LEDDIGITS_THICKNESS_SETTINGS, S.bladeThickness);
+    DisplayValue::show(LEDDIGITS_RPM_SETTINGS, S.spindleRPM);
+    DisplayValue::show(LEDDIGITS_FEEDRATE_SETTINGS, S.feedRate);
+    DisplayValue::show(LEDDIGITS_RAPID_SETTINGS, S.rapidRate);
 
     // Add display for cut pressure setting
 #ifdef SETTINGS_HAS_CUT_PRESSURE
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_CUT_PRESSURE_SETTINGS, (uint16_t)S.cutPressure);
+    DisplayValue::show(LEDDIGITS_CUT_PRESSURE_SETTINGS, S.cutPressure);
 #endif
 
     // Reset the MPG encoder mode if previously active
@@ -36,192 +51,133 @@ void SettingsScreen::onShow() {
         MPGJogManager::Instance().setEnabled(false);
     }
 
-    Serial.println("SettingsScreen: onShow() executed");
+    LOG_DEBUG(UI, "[Settings] onShow");
 }
 
-void SettingsScreen::handleEvent(const genieFrame& e) {
-    if (e.reportObject.cmd != GENIE_REPORT_EVENT || e.reportObject.object != GENIE_OBJ_WINBUTTON)
-        return;
-
+void SettingsScreen::editField(uint16_t buttonId, uint8_t ledId, float* value,
+    float min, float max, float step) {
     auto& ui = UIInputManager::Instance();
-    auto& settings = SettingsManager::Instance().settings();
-    // If you ever need job/cut data, use: auto& cutData = _mgr.GetCutData();
-
-    switch (e.reportObject.index) {
-    case WINBUTTON_SET_DIAMETER_SETTINGS:
-        if (ui.isEditing()) {
-            if (ui.isFieldActive(WINBUTTON_SET_DIAMETER_SETTINGS)) {
-                ui.unbindField();
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_DIAMETER_SETTINGS, 0);
-                SettingsManager::Instance().save();
-            }
-            else {
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_DIAMETER_SETTINGS, 0);
-            }
-        }
-        else {
-            ui.bindField(WINBUTTON_SET_DIAMETER_SETTINGS, LEDDIGITS_DIAMETER_SETTINGS,
-                &settings.bladeDiameter, 0.1f, 10.0f, 0.1f, 1);
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_DIAMETER_SETTINGS, 1);
-        }
-        break;
 
-    case WINBUTTON_SET_THICKNESS_SETTINGS:
-        if (ui.isEditing()) {
-            if (ui.isFieldActive(WINBUTTON_SET_THICKNESS_SETTINGS)) {
-                ui.unbindField();
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_THICKNESS_SETTINGS, 0);
-                SettingsManager::Instance().save();
-            }
-            else {
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_THICKNESS_SETTINGS, 0);
-            }
-        }
-        else {
-            ui.bindField(WINBUTTON_SET_THICKNESS_SETTINGS, LEDDIGITS_THICKNESS_SETTINGS,
-                &settings.bladeThickness, 0.001f, 0.5f, 0.001f, 3);
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_THICKNESS_SETTINGS, 1);
+    if (ui.isEditing()) {
+        // A second press on the field being edited saves it; any other
+        // field's button just stays released
+        if (ui.isFieldActive(buttonId)) {
+            ui.unbindField();
+            SettingsManager::Instance().save();
         }
-        break;
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, buttonId, 0);
+    }
+    else {
+        ui.bindField(buttonId, ledId, value, min, max, step);
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, buttonId, 1);
+    }
+}
 
-        // In SettingsScreen.cpp - in the WINBUTTON_SET_RPM_SETTINGS case
-    case WINBUTTON_SET_RPM_SETTINGS:
-        if (ui.isEditing()) {
-            if (ui.isFieldActive(WINBUTTON_SET_RPM_SETTINGS)) {
-                ui.unbindField();
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RPM_SETTINGS, 0);
-                SettingsManager::Instance().save();
-            }
-            else {
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RPM_SETTINGS, 0);
-            }
-        }
-        else {
-            // Bind directly to spindleRPM
-            ui.bindField(WINBUTTON_SET_RPM_SETTINGS, LEDDIGITS_RPM_SETTINGS,
-                &settings.spindleRPM, 100, 4000, 10, 0);
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RPM_SETTINGS, 1);
-        }
-        break;
+void SettingsScreen::editDiameter() {
+    editField(WINBUTTON_SET_DIAMETER_SETTINGS, LEDDIGITS_DIAMETER_SETTINGS,
+        &SettingsManager::Instance().settings().bladeDiameter, 0.1f, 10.0f, 0.1f);
+}
 
+void SettingsScreen::editThickness() {
+    editField(WINBUTTON_SET_THICKNESS_SETTINGS, LEDDIGITS_THICKNESS_SETTINGS,
+        &SettingsManager::Instance().settings().bladeThickness, 0.001f, 0.5f, 0.001f);
+}
 
-    case WINBUTTON_SET_FEEDRATE_SETTINGS:
-        if (ui.isEditing()) {
-            if (ui.isFieldActive(WINBUTTON_SET_FEEDRATE_SETTINGS)) {
-                ui.unbindField();
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_FEEDRATE_SETTINGS, 0);
-                SettingsManager::Instance().save();
-            }
-            else {
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_FEEDRATE_SETTINGS, 0);
-            }
-        }
-        else {
-            ui.bindField(WINBUTTON_SET_FEEDRATE_SETTINGS, LEDDIGITS_FEEDRATE_SETTINGS,
-                &settings.feedRate, 0.0f, 25.0f, 0.1f, 1);
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_FEEDRATE_SETTINGS, 1);
-        }
-        break;
+void SettingsScreen::editRpm() {
+    editField(WINBUTTON_SET_RPM_SETTINGS, LEDDIGITS_RPM_SETTINGS,
+        &SettingsManager::Instance().settings().spindleRPM, 100, 4000, 10);
+}
 
-    case WINBUTTON_SET_RAPID_SETTINGS:
-        if (ui.isEditing()) {
-            if (ui.isFieldActive(WINBUTTON_SET_RAPID_SETTINGS)) {
-                ui.unbindField();
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RAPID_SETTINGS, 0);
-                SettingsManager::Instance().save();
-            }
-            else {
-                genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RAPID_SETTINGS, 0);
-            }
-        }
-        else {
-            ui.bindField(WINBUTTON_SET_RAPID_SETTINGS, LEDDIGITS_RAPID_SETTINGS,
-                &settings.rapidRate, 0.0f, 300.0f, 1.0f, 0);
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_RAPID_SETTINGS, 1);
-        }
-        break;
+void SettingsScreen::editFeedRate() {
+    editField(WINBUTTON_SET_FEEDRATE_SETTINGS, LEDDIGITS_FEEDRATE_SETTINGS,
+        &SettingsManager::Instance().settings().feedRate, 0.0f, 25.0f, 0.1f);
+}
 
-        // Add handler for cut pressure setting
-    case WINBUTTON_SET_CUT_PRESSURE_F3:
+void SettingsScreen::editRapid() {
+    editField(WINBUTTON_SET_RAPID_SETTINGS, LEDDIGITS_RAPID_SETTINGS,
+        &SettingsManager::Instance().settings().rapidRate, 0.0f, 300.0f, 1.0f);
+}
+
+void SettingsScreen::adjustCutPressure() {
 #ifdef SETTINGS_HAS_CUT_PRESSURE
-        // Toggle MPG adjustment mode
-        _adjustingCutPressure = !_adjustingCutPressure;
+    auto& ui = UIInputManager::Instance();
+    auto& settings = SettingsManager::Instance().settings();
 
-        if (_adjustingCutPressure) {
-            // Enter cut pressure adjustment mode with MPG
-            ui.unbindField(); // Unbind any active field first
+    // Toggle MPG adjustment mode
+    _adjustingCutPressure = !_adjustingCutPressure;
 
-            // Highlight the button
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_CUT_PRESSURE_F3, 1);
+    if (_adjustingCutPressure) {
+        // Enter cut pressure adjustment mode with MPG
+        ui.unbindField(); // Unbind any active field first
 
-            // Setup MPG for adjustment
-            _tempCutPressure = settings.cutPressure;
-            _lastEncoderPos = ClearCore::EncoderIn.Position();
+        // Highlight the button
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_CUT_PRESSURE_F3, 1);
 
-            // Enable MPG motion
-            MPGJogManager::Instance().setEnabled(true);
+        // Setup MPG for adjustment
+        _tempCutPressure = settings.cutPressure;
+        _lastEncoderPos = ClearCore::EncoderIn.Position();
 
-            // Reset encoder to avoid phantom movements
-            UIInputManager::Instance().resetRaw();
+        // Enable MPG motion
+        MPGJogManager::Instance().setEnabled(true);
 
-            // Display current value
-            genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_CUT_PRESSURE_SETTINGS,
-                static_cast<uint16_t>(_tempCutPressure));
+        // Reset encoder to avoid phantom movements
+        UIInputManager::Instance().resetRaw();
 
-            Serial.print("Adjusting cut pressure: ");
-            Serial.println(_tempCutPressure);
-        }
-        else {
-            // Exit cut pressure adjustment mode
-            MPGJogManager::Instance().setEnabled(false);
+        // Display current value
+        DisplayValue::show(LEDDIGITS_CUT_PRESSURE_SETTINGS, _tempCutPressure);
 
-            // Save the adjusted value
-            settings.cutPressure = _tempCutPressure;
-            SettingsManager::Instance().save();
+        LOG_INFO(UI, "[Settings] Adjusting cut pressure: ", _tempCutPressure);
+    }
+    else {
+        // Exit cut pressure adjustment mode
+        MPGJogManager::Instance().setEnabled(false);
 
-            // Reset button state
-            genie.WriteObject(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_CUT_PRESSURE_F3, 0);
+        // Save the adjusted value
+        settings.cutPressure = _tempCutPressure;
+        SettingsManager::Instance().save();
 
-            Serial.print("Cut pressure set to: ");
-            Serial.println(settings.cutPressure);
-        }
+        // Reset button state
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, WINBUTTON_SET_CUT_PRESSURE_F3, 0);
+
+        LOG_INFO(UI, "[Settings] Cut pressure set to: ", settings.cutPressure);
+    }
 #endif
-        break;
+}
 
-    case WINBUTTON_BACK:
-        Serial.println("SettingsScreen: BACK pressed");
-        ui.unbindField();
+void SettingsScreen::back() {
+    auto& ui = UIInputManager::Instance();
+    auto& settings = SettingsManager::Instance().settings();
 
-        // Make sure to disable MPG and save settings if we were adjusting cut pressure
-        if (_adjustingCutPressure) {
-            _adjustingCutPressure = false;
-            MPGJogManager::Instance().setEnabled(false);
-            settings.cutPressure = _tempCutPressure;
-        }
+    LOG_INFO(UI, "[Settings] BACK pressed");
+    ui.unbindField();
 
-        SettingsManager::Instance().save();
-        showButtonSafe(WINBUTTON_BACK, 0, 0);
-
-        int selector = PendantManager::Instance().LastKnownSelector();
-        Serial.print("Selector value: ");
-        Serial.println(selector, HEX);
-
-        switch (selector) {
-        case 0x01:
-            // Reserved for future use
-            break;
-        case 0x02: ScreenManager::Instance().ShowJogY(); break;
-        case 0x04: ScreenManager::Instance().ShowJogZ(); break;
-        case 0x08: ScreenManager::Instance().ShowSemiAuto(); break;
-        case 0x10: ScreenManager::Instance().ShowAutoCut(); break;
-        default:   ScreenManager::Instance().ShowManualMode(); break;
-        }
+    // Make sure to disable MPG and save settings if we were adjusting cut pressure
+    if (_adjustingCutPressure) {
+        _adjustingCutPressure = false;
+        MPGJogManager::Instance().setEnabled(false);
+        settings.cutPressure = _tempCutPressure;
+    }
+
+    SettingsManager::Instance().save();
+    showButtonSafe(WINBUTTON_BACK, 0);
+
+    int selector = PendantManager::Instance().LastKnownSelector();
+    LOG_DEBUG(UI, "[Settings] Selector value: ", selector);
+
+    switch (selector) {
+    case 0x01:
+        // Reserved for future use
         break;
+    case 0x02: ScreenManager::Instance().ShowJogY(); break;
+    case 0x04: ScreenManager::Instance().ShowJogZ(); break;
+    case 0x08: ScreenManager::Instance().ShowSemiAuto(); break;
+    case 0x10: ScreenManager::Instance().ShowAutoCut(); break;
+    default:   ScreenManager::Instance().ShowManualMode(); break;
     }
 }
 
 void SettingsScreen::onHide() {
-    Serial.println("SettingsScreen: onHide()");
+    LOG_DEBUG(UI, "[Settings] onHide");
 
     // Clean up MPG mode if active
     if (_adjustingCutPressure) {
@@ -235,10 +191,11 @@ void SettingsScreen::onHide() {
 #endif
     }
 
-    showButtonSafe(WINBUTTON_BACK, 0, 0);
+    showButtonSafe(WINBUTTON_BACK, 0);
 }
 
 void SettingsScreen::update() {
+    LATENCY_PROBE("screen.settings");
     // Handle MPG encoder for cut pressure adjustment
     if (_adjustingCutPressure) {
         // Get current encoder position
@@ -261,13 +218,10 @@ void SettingsScreen::update() {
             if (_tempCutPressure < 1.0f) _tempCutPressure = 1.0f;
             if (_tempCutPressure > 100.0f) _tempCutPressure = 100.0f;
 
-            // Debug output
-            Serial.print("Cut pressure adjusted to: ");
-            Serial.println(_tempCutPressure);
+            LOG_DEBUG(UI, "[Settings] Cut pressure adjusted to: ", _tempCutPressure);
 
             // Update display
-            genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_CUT_PRESSURE_SETTINGS,
-                static_cast<uint16_t>(_tempCutPressure));
+            DisplayValue::show(LEDDIGITS_CUT_PRESSURE_SETTINGS, _tempCutPressure);
         }
     }
 }
@@ -12,10 +12,24 @@ class SettingsScreen : public Screen {
 public:
     void onShow() override;
     void onHide() override;
-    void handleEvent(const genieFrame& e) override;
     void update() override;  // Added update method for encoder polling
+    const FieldInit* initialState(uint8_t& count) const override;
     SettingsScreen(ScreenManager& mgr);
+
+    // Button actions, routed here by EventRouter
+    void editDiameter();
+    void editThickness();
+    void editRpm();
+    void editFeedRate();
+    void editRapid();
+    void adjustCutPressure();
+    void back();
+
 private:
+    /// Start editing a setting with the MPG, or save it on the second press
+    void editField(uint16_t buttonId, uint8_t ledId, float* value,
+        float min, float max, float step);
+
     ScreenManager& _mgr;
 
     // Cut pressure adjustment with MPG
@@ -1,5 +1,9 @@
 // SetupAutocutScreen.cpp - Optimized for fast screen transitions
 #include "SetupAutocutScreen.h"
+#include "DisplayModel.h"
+#include "DisplayValue.h"
+#include "LatencyProfiler.h"
+#include "Log.h"
 #include "screenmanager.h"
 #include "CutSequenceController.h"
 #include "MotionController.h"
@@ -8,8 +12,6 @@
 #include <ClearCore.h>
 #include "Config.h"
 
-extern Genie genie;
-
 // Define fixed MPG increment for fine control
 #define MPG_FIXED_INCREMENT 1.0f  // One slice per increment (was 0.5f)
 
@@ -17,6 +19,17 @@ SetupAutocutScreen::SetupAutocutScreen(ScreenManager& mgr)
     : _mgr(mgr), _tempSlices(1), _editingSlices(false), _needsDisplayUpdate(false) {
 }
 
+static const Screen::FieldInit SETUP_AUTOCUT_INITIAL[] = {
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SETTINGS_F9, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_SLICES_TO_CUT_F9, 0 },
+    { GENIE_OBJ_WINBUTTON, WINBUTTON_RETURN_TO_AUTOCUT_F9, 0 },
+};
+
+const Screen::FieldInit* SetupAutocutScreen::initialState(uint8_t& count) const {
+    count = sizeof(SETUP_AUTOCUT_INITIAL) / sizeof(SETUP_AUTOCUT_INITIAL[0]);
+    return SETUP_AUTOCUT_INITIAL;
+}
+
 void SetupAutocutScreen::onShow() {
     // Minimal, fast initialization - defer expensive operations
     auto& seq = CutSequenceController::Instance();
@@ -36,8 +49,7 @@ void SetupAutocutScreen::onShow() {
     _needsDisplayUpdate = true;
 
     // Minimal logging
-    ClearCore::ConnectorUsb.Send("[SetupAutocut] Opened with batch size ");
-    ClearCore::ConnectorUsb.SendLine(currentBatchSize);
+    LOG_INFO(UI, "[SetupAutocut] Opened with batch size ", currentBatchSize);
 }
 
 void SetupAutocutScreen::onHide() {
@@ -51,30 +63,8 @@ void SetupAutocutScreen::onHide() {
     MPGJogManager::Instance().setEnabled(false);
 }
 
-void SetupAutocutScreen::handleEvent(const genieFrame& e) {
-    if (e.reportObject.cmd != GENIE_REPORT_EVENT) return;
-
-    auto& seq = CutSequenceController::Instance();
-    auto& ui = UIInputManager::Instance();
-    auto& mpg = MPGJogManager::Instance();
-
-    switch (e.reportObject.object) {
-    case GENIE_OBJ_WINBUTTON:
-        switch (e.reportObject.index) {
-        case WINBUTTON_SLICES_TO_CUT_F9:            // 53
-            setSlicesToCut();
-            break;
-
-        case WINBUTTON_SETTINGS_F9:                 // 52
-            ScreenManager::Instance().ShowSettings();
-            break;
-
-        case WINBUTTON_RETURN_TO_AUTOCUT_F9:        // 54 - Return To Autocut
-            ScreenManager::Instance().ShowAutoCut();
-            break;
-        }
-        break;
-    }
+void SetupAutocutScreen::returnToAutoCut() {
+    _mgr.ShowAutoCut();
 }
 
 void SetupAutocutScreen::setSlicesToCut() {
@@ -87,7 +77,7 @@ void SetupAutocutScreen::setSlicesToCut() {
         // Start editing with MPG
         mpg.setEnabled(true);
 
-        ClearCore::ConnectorUsb.SendLine("[SetupAutocut] Starting MPG slice adjustment");
+        LOG_INFO(UI, "[SetupAutocut] Starting MPG slice adjustment");
 
         // Show active mode indicator
         showButtonSafe(WINBUTTON_SLICES_TO_CUT_F9, 1);
@@ -98,7 +88,7 @@ void SetupAutocutScreen::setSlicesToCut() {
 
         // Apply the value
         int maxBatch = CutSequenceController::Instance().getMaxBatchSize();
-        int intSlices = static_cast<int>(round(_tempSlices));
+        int intSlices = DisplayValue::toScaled(_tempSlices, LEDDIGITS_SLICES_TO_CUT_F9);
 
         if (intSlices < 1) intSlices = 1;
         if (intSlices > maxBatch) intSlices = maxBatch;
@@ -108,8 +98,7 @@ void SetupAutocutScreen::setSlicesToCut() {
         // Apply value to controller
         CutSequenceController::Instance().setBatchSize(intSlices);
 
-        ClearCore::ConnectorUsb.Send("[SetupAutocut] Set batch size to: ");
-        ClearCore::ConnectorUsb.SendLine(intSlices);
+        LOG_INFO(UI, "[SetupAutocut] Set batch size to: ", intSlices);
 
         // Show inactive mode indicator
         showButtonSafe(WINBUTTON_SLICES_TO_CUT_F9, 0);
@@ -117,22 +106,20 @@ void SetupAutocutScreen::setSlicesToCut() {
 }
 
 void SetupAutocutScreen::updateSlicesToCutButton() {
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_SLICES_TO_CUT_F9, static_cast<uint16_t>(_tempSlices));
+    DisplayValue::show(LEDDIGITS_SLICES_TO_CUT_F9, _tempSlices);
 }
 
 void SetupAutocutScreen::updateDisplay() {
     auto& seq = CutSequenceController::Instance();
 
     // Current batch size (slices to cut)
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_SLICES_TO_CUT_F9, static_cast<uint16_t>(_tempSlices));
+    DisplayValue::show(LEDDIGITS_SLICES_TO_CUT_F9, _tempSlices);
 
     // Last completed position
-    int lastCompleted = seq.getLastCompletedPosition();
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_START_POSITION_F9, static_cast<uint16_t>(lastCompleted));
+    DisplayValue::showCount(LEDDIGITS_START_POSITION_F9, seq.getLastCompletedPosition());
 
     // Total slices
-    int totalSlices = seq.getTotalCuts();
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_TOTAL_POSITIONS_F9, static_cast<uint16_t>(totalSlices));
+    DisplayValue::showCount(LEDDIGITS_TOTAL_POSITIONS_F9, seq.getTotalCuts());
 
     // Remaining positions
     int remainingPos = seq.getRemainingPositions();
@@ -140,24 +127,23 @@ void SetupAutocutScreen::updateDisplay() {
 
     // Update thickness display from JogXScreen's global value
     float thickness = JogXScreen::GetCutThickness();
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_THICKNESS_F9, static_cast<uint16_t>(thickness * 1000));
+    DisplayValue::show(LEDDIGITS_THICKNESS_F9, thickness);
 
     // Stock length display from CutData
     auto& cutData = ScreenManager::Instance().GetCutData();
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_STOCK_LENGTH_F9, static_cast<uint16_t>(cutData.stockLength * 1000));
+    DisplayValue::show(LEDDIGITS_STOCK_LENGTH_F9, cutData.stockLength);
 
     // Set batch size limits
     int maxBatch = seq.getMaxBatchSize();
     if (_tempSlices > maxBatch) {
         _tempSlices = maxBatch;
-        genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_SLICES_TO_CUT_F9, static_cast<uint16_t>(_tempSlices));
+        DisplayValue::show(LEDDIGITS_SLICES_TO_CUT_F9, _tempSlices);
     }
 }
 
 void SetupAutocutScreen::onEncoderChanged(int deltaClicks) {
     if (_editingSlices) {
-        ClearCore::ConnectorUsb.Send("[SetupAutocut] Encoder delta: ");
-        ClearCore::ConnectorUsb.SendLine(deltaClicks);
+        LOG_DEBUG(UI, "[SetupAutocut] Encoder delta: ", deltaClicks);
 
         // Accumulate delta clicks - we need this because the encoder might generate
         // multiple clicks in one update cycle
@@ -177,21 +163,19 @@ void SetupAutocutScreen::onEncoderChanged(int deltaClicks) {
             if (_tempSlices > maxBatch) _tempSlices = static_cast<float>(maxBatch);
 
             // Round to nearest integer since partial slices don't make sense
-            _tempSlices = round(_tempSlices);
+            _tempSlices = static_cast<float>(DisplayValue::toScaled(_tempSlices, LEDDIGITS_SLICES_TO_CUT_F9));
 
             // Update display
-            genie.WriteObject(GENIE_OBJ_LED_DIGITS, LEDDIGITS_SLICES_TO_CUT_F9,
-                static_cast<uint16_t>(_tempSlices));
+            DisplayValue::show(LEDDIGITS_SLICES_TO_CUT_F9, _tempSlices);
 
-            ClearCore::ConnectorUsb.Send("[SetupAutocut] Encoder changed: ");
-            ClearCore::ConnectorUsb.Send(delta);
-            ClearCore::ConnectorUsb.Send(", new value: ");
-            ClearCore::ConnectorUsb.SendLine(static_cast<int>(_tempSlices));
+            LOG_DEBUG(UI, "[SetupAutocut] Encoder changed: ", delta,
+                ", new value: ", static_cast<int>(_tempSlices));
         }
     }
 }
 
 void SetupAutocutScreen::update() {
+    LATENCY_PROBE("screen.setupAutocut");
     // Handle deferred display update from onShow() - happens only once
     if (_needsDisplayUpdate) {
         updateDisplay();
@@ -228,4 +212,4 @@ void SetupAutocutScreen::update() {
         updateDisplay();
         lastUpdate = now;
     }
-}
\ No newline at end of file
+}
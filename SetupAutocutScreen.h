@@ -11,8 +11,8 @@ public:
 
     void onShow() override;
     void onHide() override;
-    void handleEvent(const genieFrame& e) override;
     void update() override;
+    const FieldInit* initialState(uint8_t& count) const override;
 
     // Called when the encoder changes
     void onEncoderChanged(int deltaClicks);
@@ -20,9 +20,12 @@ public:
     // Getter for checking if we're in editing mode
     bool isEditingSlices() const { return _editingSlices; }
 
+    // Button actions, routed here by EventRouter
+    void setSlicesToCut();
+    void returnToAutoCut();
+
 private:
     void updateDisplay();
-    void setSlicesToCut();
     void updateSlicesToCutButton();
     bool _needsDisplayUpdate = false;  // Flag for deferred display update
 
@@ -1,9 +1,10 @@
 ﻿// Spindle.cpp
 #include "Spindle.h"
 #include "Config.h"
+#include "Log.h"
 #include <ClearCore.h>
 
-Spindle::Spindle() : running(false), commandedRPM(0.0f) {}
+Spindle::Spindle() : running(false), commandedRPM(0.0f), stopPending(false), stopRequestedMs(0) {}
 
 // motion/Spindle.cpp
 #include <ClearCore.h>
@@ -36,7 +37,7 @@ void Spindle::Setup() {
     MOTOR_SPINDLE.MotorInAState(true);
     MOTOR_SPINDLE.MotorInBDuty(0);
 
-    ClearCore::ConnectorUsb.SendLine("[Spindle] Setup complete");
+    LOG_INFO(Motion, "[Spindle] Setup complete");
 }
 
 
@@ -52,6 +53,9 @@ void Spindle::Start(float rpm) {
     if (dutyValue < 20) dutyValue = 20;
     if (dutyValue > 255) dutyValue = 255;
 
+    // Restarting during coast-down keeps the drive enabled
+    stopPending = false;
+
     MOTOR_SPINDLE.EnableRequest(true);
     MOTOR_SPINDLE.MotorInBDuty(dutyValue);
     running = true;
@@ -61,9 +65,17 @@ void Spindle::Stop() {
     running = false;
     commandedRPM = 0.0f;
     MOTOR_SPINDLE.MotorInBDuty(0);
-    unsigned long startTime = ClearCore::TimingMgr.Milliseconds();
-    while (ClearCore::TimingMgr.Milliseconds() - startTime < 1500) {}
-    MOTOR_SPINDLE.EnableRequest(false);
+
+    // Let the spindle coast down before dropping the enable; Update() finishes it
+    stopPending = true;
+    stopRequestedMs = ClearCore::TimingMgr.Milliseconds();
+}
+
+void Spindle::Update() {
+    if (stopPending && ClearCore::TimingMgr.Milliseconds() - stopRequestedMs >= COAST_DOWN_MS) {
+        stopPending = false;
+        MOTOR_SPINDLE.EnableRequest(false);
+    }
 }
 
 void Spindle::SetRPM(float rpm) {
@@ -89,6 +101,7 @@ float Spindle::CommandedRPM() const {
 
 void Spindle::EmergencyStop() {
     running = false;
+    stopPending = false;
     commandedRPM = 0.0f;
     MOTOR_SPINDLE.MotorInBDuty(0);
     MOTOR_SPINDLE.EnableRequest(false);
@@ -1,6 +1,8 @@
 // Spindle.h
 #pragma once
 
+#include <stdint.h>
+
 class Spindle {
 public:
     Spindle();
@@ -13,7 +15,18 @@ public:
     float CommandedRPM() const;
     void EmergencyStop();
 
+    // Call every loop - finishes a coast-down started by Stop()
+    void Update();
+
+    // True while the spindle is coasting down before the enable drops
+    bool IsStopping() const { return stopPending; }
+
 private:
     bool running;
     float commandedRPM;
+
+    // Deferred disable after Stop()
+    bool stopPending;
+    uint32_t stopRequestedMs;
+    static constexpr uint32_t COAST_DOWN_MS = 1500;
 };
@@ -0,0 +1,54 @@
+// SpscMailbox.h
+#pragma once
+
+#include <stdint.h>
+
+/// Latest-value mailbox between exactly one writer and one reader, where
+/// one side may be an interrupt. Lock-free (seqlock): the writer bumps a
+/// sequence number to odd, copies the value, and bumps it back to even.
+/// A reader that sees an odd or changing sequence knows it raced a write.
+///
+/// - Interrupt reading, main loop writing: the interrupt cannot wait for
+///   the preempted write to finish, so read() just fails and the caller
+///   keeps its previous copy until the next tick.
+/// - Main loop reading, interrupt writing: read() retries a few times;
+///   the interrupt always finishes its write before the loop resumes.
+///
+/// Single-core Cortex-M4, so compiler barriers are enough for ordering.
+template <typename T>
+class SpscMailbox {
+public:
+    void write(const T& value) {
+        _seq = _seq + 1;            // odd: write in progress
+        barrier();
+        _value = value;
+        barrier();
+        _seq = _seq + 1;            // even: stable
+    }
+
+    /// Copy the latest value. Returns false if nothing has been written yet
+    /// or a consistent snapshot couldn't be taken.
+    bool read(T& out) const {
+        for (int attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+            uint32_t before = _seq;
+            if (before == 0) return false;
+            if (before & 1u) continue;
+            barrier();
+            out = _value;
+            barrier();
+            if (_seq == before) return true;
+        }
+        return false;
+    }
+
+    /// Increments once per write; lets readers spot fresh data cheaply
+    uint32_t sequence() const { return _seq; }
+
+private:
+    static inline void barrier() { __asm__ volatile("" ::: "memory"); }
+
+    static constexpr int MAX_ATTEMPTS = 3;
+
+    volatile uint32_t _seq = 0;
+    T _value = {};
+};
@@ -0,0 +1,145 @@
+// TaskScheduler.cpp
+#include "TaskScheduler.h"
+#include "Log.h"
+
+TaskScheduler& TaskScheduler::Instance() {
+    static TaskScheduler inst;
+    return inst;
+}
+
+int TaskScheduler::addTask(const char* name, TaskFn fn, uint32_t periodUs,
+    Priority priority, uint32_t deadlineUs) {
+    if (_numTasks >= MAX_TASKS || !fn) {
+        LOG_ERROR(Sys, "[Scheduler] Cannot add task ", name);
+        return -1;
+    }
+
+    int id = _numTasks;
+    Task& t = _tasks[id];
+    t.fn = fn;
+    t.priority = priority;
+    t.enabled = true;
+    t.nextRunUs = ClearCore::TimingMgr.Microseconds();
+    t.stats = {};
+    t.stats.name = name;
+    t.stats.periodUs = periodUs;
+    t.stats.deadlineUs = deadlineUs ? deadlineUs : periodUs;
+
+    // Insert after every task of equal or higher priority so tasks of the
+    // same priority keep registration order. Only the run order moves;
+    // ids already handed out stay put.
+    int pos = _numTasks;
+    while (pos > 0 && _tasks[_order[pos - 1]].priority > priority) {
+        _order[pos] = _order[pos - 1];
+        pos--;
+    }
+    _order[pos] = static_cast<uint8_t>(id);
+    _numTasks++;
+
+    return id;
+}
+
+void TaskScheduler::setEnabled(int taskId, bool enabled) {
+    if (taskId < 0 || taskId >= _numTasks) return;
+    if (enabled && !_tasks[taskId].enabled) {
+        _tasks[taskId].nextRunUs = ClearCore::TimingMgr.Microseconds();
+    }
+    _tasks[taskId].enabled = enabled;
+}
+
+void TaskScheduler::run() {
+    uint32_t now = ClearCore::TimingMgr.Microseconds();
+    _lastTask = -1;
+
+    // Highest-priority due task wins; one task per pass keeps the
+    // worst-case wait for the motion task to a single task body
+    for (int n = 0; n < _numTasks; n++) {
+        int i = _order[n];
+        Task& t = _tasks[i];
+        if (!t.enabled || t.priority == PRIORITY_IDLE) continue;
+        if (static_cast<int32_t>(now - t.nextRunUs) >= 0) {
+            execute(i, now);
+            return;
+        }
+    }
+
+    // Nothing due - give one idle task a turn
+    for (int n = 0; n < _numTasks; n++) {
+        int i = _nextIdle;
+        _nextIdle = (_nextIdle + 1) % _numTasks;
+
+        Task& t = _tasks[i];
+        if (!t.enabled || t.priority != PRIORITY_IDLE) continue;
+        if (static_cast<int32_t>(now - t.nextRunUs) >= 0) {
+            execute(i, now);
+            return;
+        }
+    }
+}
+
+void TaskScheduler::execute(int taskId, uint32_t now) {
+    Task& t = _tasks[taskId];
+    TaskStats& s = t.stats;
+
+    uint32_t lateness = now - t.nextRunUs;
+
+    _currentTask = taskId;
+    _lastTask = taskId;
+    t.fn();
+    _currentTask = -1;
+
+    uint32_t exec = ClearCore::TimingMgr.Microseconds() - now;
+
+    s.runs++;
+    s.lastExecUs = exec;
+    if (exec > s.maxExecUs) s.maxExecUs = exec;
+    if (lateness > s.maxLatenessUs) s.maxLatenessUs = lateness;
+    if (s.deadlineUs && (lateness > s.deadlineUs || exec > s.deadlineUs)) {
+        s.overruns++;
+    }
+
+    // Fixed-rate: advance by whole periods so the average rate holds.
+    // If we fell more than a period behind, drop the missed slots rather
+    // than bursting to catch up.
+    if (s.periodUs == 0) {
+        t.nextRunUs = now;
+        return;
+    }
+    t.nextRunUs += s.periodUs;
+    uint32_t behind = ClearCore::TimingMgr.Microseconds() - t.nextRunUs;
+    if (static_cast<int32_t>(behind) >= static_cast<int32_t>(s.periodUs)) {
+        s.skipped += behind / s.periodUs;
+        t.nextRunUs = ClearCore::TimingMgr.Microseconds() + s.periodUs;
+    }
+}
+
+void TaskScheduler::resetStats() {
+    for (int i = 0; i < _numTasks; i++) {
+        TaskStats& s = _tasks[i].stats;
+        s.runs = 0;
+        s.overruns = 0;
+        s.skipped = 0;
+        s.lastExecUs = 0;
+        s.maxExecUs = 0;
+        s.maxLatenessUs = 0;
+    }
+}
+
+void TaskScheduler::logStats() const {
+    ClearCore::ConnectorUsb.SendLine("[Scheduler] task: runs / overruns / skipped / maxExec us / maxLate us");
+    for (int i = 0; i < _numTasks; i++) {
+        const TaskStats& s = _tasks[i].stats;
+        ClearCore::ConnectorUsb.Send("[Scheduler] ");
+        ClearCore::ConnectorUsb.Send(s.name);
+        ClearCore::ConnectorUsb.Send(": ");
+        ClearCore::ConnectorUsb.Send(s.runs);
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.Send(s.overruns);
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.Send(s.skipped);
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.Send(s.maxExecUs);
+        ClearCore::ConnectorUsb.Send(" / ");
+        ClearCore::ConnectorUsb.SendLine(s.maxLatenessUs);
+    }
+}
@@ -0,0 +1,85 @@
+// TaskScheduler.h
+#pragma once
+
+#include <ClearCore.h>
+
+/// Fixed-rate cooperative scheduler for the main loop.
+/// Each task has a period, a priority and a deadline. Every call to run()
+/// executes the highest-priority task that is due, so a slow UI task can
+/// delay the motion task by at most one task body instead of a whole loop.
+/// Idle-priority tasks only run when nothing else is due.
+class TaskScheduler {
+public:
+    typedef void (*TaskFn)();
+
+    enum Priority : uint8_t {
+        PRIORITY_CRITICAL = 0,  // E-stop, motion/torque loop
+        PRIORITY_HIGH,          // Pendant, encoder input
+        PRIORITY_NORMAL,        // Display link
+        PRIORITY_LOW,           // Screen redraws
+        PRIORITY_IDLE           // Logging, diagnostics
+    };
+
+    /// Per-task counters, readable while running
+    struct TaskStats {
+        const char* name;
+        uint32_t periodUs;
+        uint32_t deadlineUs;
+        uint32_t runs;
+        uint32_t overruns;      // started late or ran past the deadline
+        uint32_t skipped;       // whole periods dropped because the task fell behind
+        uint32_t lastExecUs;
+        uint32_t maxExecUs;
+        uint32_t maxLatenessUs;
+    };
+
+    static TaskScheduler& Instance();
+
+    /// Register a task. periodUs = 0 means "every pass" (idle tasks only).
+    /// deadlineUs = 0 uses the period as the deadline.
+    /// Returns the task id - its registration index, which later tasks of
+    /// any priority don't change - or -1 if the table is full.
+    int addTask(const char* name, TaskFn fn, uint32_t periodUs,
+        Priority priority, uint32_t deadlineUs = 0);
+
+    /// Run one scheduling pass - call from AutoSawController::update()
+    void run();
+
+    void setEnabled(int taskId, bool enabled);
+
+    int taskCount() const { return _numTasks; }
+    const TaskStats& stats(int taskId) const { return _tasks[taskId].stats; }
+
+    /// Id of the task currently executing, or -1 between tasks
+    int currentTask() const { return _currentTask; }
+
+    /// Name of the task the last run() pass executed, or nullptr if none
+    const char* lastTaskName() const { return _lastTask >= 0 ? _tasks[_lastTask].stats.name : nullptr; }
+
+    void resetStats();
+    void logStats() const;
+
+private:
+    TaskScheduler() = default;
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    struct Task {
+        TaskFn   fn;
+        Priority priority;
+        bool     enabled;
+        uint32_t nextRunUs;
+        TaskStats stats;
+    };
+
+    void execute(int taskId, uint32_t now);
+
+    static constexpr int MAX_TASKS = 12;
+
+    Task _tasks[MAX_TASKS];     // registration order, indexed by task id
+    uint8_t _order[MAX_TASKS];  // task ids sorted by priority
+    int  _numTasks = 0;
+    int  _currentTask = -1;
+    int  _lastTask = -1;
+    int  _nextIdle = 0;         // round-robin cursor for idle tasks
+};
@@ -1,9 +1,10 @@
 #include "TorqueControlUI.h"
+#include "DisplayModel.h"
+#include "DisplayValue.h"
 #include "MotionController.h"
 #include "SettingsManager.h"
 #include "UIInputManager.h"
-
-extern Genie genie;
+#include "Log.h"
 
 TorqueControlUI::TorqueControlUI()
     : _cutPressureLedId(0), _targetFeedRateLedId(0), _torqueGaugeId(0), _liveFeedRateLedId(0),
@@ -40,7 +41,7 @@ void TorqueControlUI::onShow() {
     updateFeedRateDisplay();
 
     // Initialize gauge at zero
-    genie.WriteObject(GENIE_OBJ_IGAUGE, _torqueGaugeId, 0);
+    DisplayModel::Instance().set(GENIE_OBJ_IGAUGE, _torqueGaugeId, 0);
 
     // Reset encoder tracking
     _lastEncoderPos = ClearCore::EncoderIn.Position();
@@ -63,13 +64,12 @@ void TorqueControlUI::update() {
         // Update live feed rate display if configured
         if (_liveFeedRateLedId > 0) {
             float currentFeedRate = motion.YAxisInstance().DebugGetCurrentFeedRate();
-            genie.WriteObject(GENIE_OBJ_LED_DIGITS, _liveFeedRateLedId,
-                static_cast<uint16_t>(currentFeedRate * 100.0f));
+            DisplayValue::show(_liveFeedRateLedId, currentFeedRate);
         }
     }
     else if (_liveFeedRateLedId > 0) {
         // Clear feed rate display when not cutting
-        genie.WriteObject(GENIE_OBJ_LED_DIGITS, _liveFeedRateLedId, 0);
+        DisplayModel::Instance().set(GENIE_OBJ_LED_DIGITS, _liveFeedRateLedId, 0);
     }
 
     // Handle encoder input if in adjustment mode
@@ -106,8 +106,7 @@ void TorqueControlUI::toggleCutPressureAdjustment() {
         // Update display
         updateCutPressureDisplay();
 
-        ClearCore::ConnectorUsb.Send("[TorqueControlUI] Entering cut pressure adjustment, value: ");
-        ClearCore::ConnectorUsb.SendLine(_tempCutPressure);
+        LOG_INFO(UI, "[TorqueControlUI] Entering cut pressure adjustment, value: ", _tempCutPressure);
     }
 }
 
@@ -136,9 +135,7 @@ void TorqueControlUI::toggleFeedRateAdjustment() {
         // Update display
         updateFeedRateDisplay();
 
-        ClearCore::ConnectorUsb.Send("[TorqueControlUI] Entering feed rate adjustment, value: ");
-        ClearCore::ConnectorUsb.Send(_tempFeedRate * 100.0f, 0);
-        ClearCore::ConnectorUsb.SendLine("%");
+        LOG_INFO(UI, "[TorqueControlUI] Entering feed rate adjustment, value: ", Log::fixed(_tempFeedRate * 100.0f, 0), "%");
     }
 }
 
@@ -189,14 +186,11 @@ void TorqueControlUI::exitAdjustmentMode() {
 #ifdef SETTINGS_HAS_CUT_PRESSURE
         settings.cutPressure = _tempCutPressure;
 #endif
-        ClearCore::ConnectorUsb.Send("[TorqueControlUI] Cut pressure saved: ");
-        ClearCore::ConnectorUsb.SendLine(_tempCutPressure);
+        LOG_INFO(UI, "[TorqueControlUI] Cut pressure saved: ", _tempCutPressure);
     }
     else if (_currentMode == ADJUSTMENT_FEED_RATE) {
         settings.feedRate = _tempFeedRate * 25.0f;
-        ClearCore::ConnectorUsb.Send("[TorqueControlUI] Feed rate saved: ");
-        ClearCore::ConnectorUsb.Send(_tempFeedRate * 100.0f, 0);
-        ClearCore::ConnectorUsb.SendLine("%");
+        LOG_INFO(UI, "[TorqueControlUI] Feed rate saved: ", Log::fixed(_tempFeedRate * 100.0f, 0), "%");
     }
 
     SettingsManager::Instance().save();
@@ -210,23 +204,21 @@ void TorqueControlUI::setCuttingActive(bool active) {
 void TorqueControlUI::updateButtonStates(uint16_t cutPressureButtonId, uint16_t feedRateButtonId) {
     if (cutPressureButtonId > 0) {
         bool pressureActive = (_currentMode == ADJUSTMENT_CUT_PRESSURE);
-        genie.WriteObject(GENIE_OBJ_WINBUTTON, cutPressureButtonId, pressureActive ? 1 : 0);
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, cutPressureButtonId, pressureActive ? 1 : 0);
     }
 
     if (feedRateButtonId > 0) {
         bool feedRateActive = (_currentMode == ADJUSTMENT_FEED_RATE);
-        genie.WriteObject(GENIE_OBJ_WINBUTTON, feedRateButtonId, feedRateActive ? 1 : 0);
+        DisplayModel::Instance().set(GENIE_OBJ_WINBUTTON, feedRateButtonId, feedRateActive ? 1 : 0);
     }
 }
 
 void TorqueControlUI::updateCutPressureDisplay() {
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, _cutPressureLedId,
-        static_cast<uint16_t>(_tempCutPressure * 10.0f));
+    DisplayValue::show(_cutPressureLedId, _tempCutPressure);
 }
 
 void TorqueControlUI::updateFeedRateDisplay() {
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, _targetFeedRateLedId,
-        static_cast<uint16_t>(_tempFeedRate * 100.0f));
+    DisplayValue::show(_targetFeedRateLedId, _tempFeedRate);
 }
 
 void TorqueControlUI::updateTorqueGauge() {
@@ -241,7 +233,7 @@ void TorqueControlUI::updateTorqueGauge() {
     if (torquePercentage < 0.0f) torquePercentage = 0.0f;
 
     uint16_t gaugeValue = static_cast<uint16_t>(torquePercentage);
-    genie.WriteObject(GENIE_OBJ_IGAUGE, _torqueGaugeId, gaugeValue);
+    DisplayModel::Instance().set(GENIE_OBJ_IGAUGE, _torqueGaugeId, gaugeValue);
 }
 
 void TorqueControlUI::handleEncoderInput() {
@@ -261,8 +253,7 @@ void TorqueControlUI::handleEncoderInput() {
             updateCutPressureDisplay();
             applyLiveAdjustments();
 
-            ClearCore::ConnectorUsb.Send("[TorqueControlUI] Cut pressure adjusted via encoder: ");
-            ClearCore::ConnectorUsb.SendLine(_tempCutPressure);
+            LOG_INFO(UI, "[TorqueControlUI] Cut pressure adjusted via encoder: ", _tempCutPressure);
         }
         else if (_currentMode == ADJUSTMENT_FEED_RATE) {
             float changeAmount = (delta > 0) ? FEED_RATE_INCREMENT : -FEED_RATE_INCREMENT;
@@ -274,9 +265,7 @@ void TorqueControlUI::handleEncoderInput() {
             updateFeedRateDisplay();
             applyLiveAdjustments();
 
-            ClearCore::ConnectorUsb.Send("[TorqueControlUI] Feed rate adjusted via encoder: ");
-            ClearCore::ConnectorUsb.Send(_tempFeedRate * 100.0f, 0);
-            ClearCore::ConnectorUsb.SendLine("%");
+            LOG_INFO(UI, "[TorqueControlUI] Feed rate adjusted via encoder: ", Log::fixed(_tempFeedRate * 100.0f, 0), "%");
         }
     }
 }
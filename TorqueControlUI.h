@@ -35,7 +35,7 @@ public:
     // Update displays and handle encoder input - call from screen's update()
     void update();
 
-    // Button handlers - call from screen's handleEvent()
+    // Button handlers - call from the screen's button actions
     void toggleCutPressureAdjustment();
     void toggleFeedRateAdjustment();
     void incrementValue();
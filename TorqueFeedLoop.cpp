@@ -0,0 +1,141 @@
+// TorqueFeedLoop.cpp
+#include "TorqueFeedLoop.h"
+#include "Config.h"
+#include "Log.h"
+#include <sam.h>
+
+#define ACK_TORQUE_LOOP_INT  TCC2->INTFLAG.reg = TCC_INTFLAG_MASK
+
+// Fixed step of the control law
+static constexpr float LOOP_DT = 1.0f / TORQUE_LOOP_RATE_HZ;
+
+// First-order filters: alpha = dt / (tau + dt)
+static constexpr float FAST_ALPHA = LOOP_DT / (TORQUE_LOOP_FAST_TAU_MS / 1000.0f + LOOP_DT);
+static constexpr float SLOW_ALPHA = LOOP_DT / (TORQUE_LOOP_SLOW_TAU_MS / 1000.0f + LOOP_DT);
+
+
+// TCC2 is not used by the ClearCore hardware or core library
+extern "C" void TCC2_0_Handler(void) {
+    ACK_TORQUE_LOOP_INT;
+    TorqueFeedLoop::Instance().tick();
+}
+
+TorqueFeedLoop& TorqueFeedLoop::Instance() {
+    static TorqueFeedLoop inst;
+    return inst;
+}
+
+void TorqueFeedLoop::begin(MotorDriver* motor) {
+    if (!motor) return;
+    _motor = motor;
+    _running = true;
+    configureTimer(TORQUE_LOOP_RATE_HZ);
+
+    LOG_INFO(Feed, "[TorqueLoop] Running from interrupt at ", TORQUE_LOOP_RATE_HZ, " Hz");
+}
+
+void TorqueFeedLoop::end() {
+    configureTimer(0);
+    _running = false;
+}
+
+void TorqueFeedLoop::tick() {
+    uint32_t startCycles = DWT->CYCCNT;
+
+    // Sample torque - HLFB is refreshed by the ClearCore sample interrupt,
+    // which runs at a higher priority than this one
+    float raw = 0.0f;
+    if (_motor->HlfbState() == MotorDriver::HLFB_HAS_MEASUREMENT) {
+        raw = _motor->HlfbPercent();
+    }
+    else if (_motor->HlfbState() == MotorDriver::HLFB_ASSERTED) {
+        raw = 100.0f;
+    }
+    _fastTorque += (raw - _fastTorque) * FAST_ALPHA;
+    _slowTorque += (raw - _slowTorque) * SLOW_ALPHA;
+
+    // Keep the previous setpoint if the main loop is mid-write
+    Setpoint sp;
+    if (_setpoints.read(sp)) {
+        _sp = sp;
+    }
+
+    if (_sp.generation != _generation) {
+        _generation = _sp.generation;
+        _law.configure(_sp.gains, LOOP_DT);
+        _law.reset(_sp.startRate, _fastTorque);
+        _feedRate = _sp.startRate;
+        _lastWrittenRate = _feedRate;
+    }
+
+    float error = _sp.torqueTarget - _fastTorque;
+
+    if (!_sp.active) {
+        _lastAccel = 0;
+    }
+    else if (!_motor->StatusReg().bit.AlertsPresent) {
+        // The main loop set the acceleration before handing over; from here
+        // on its ramp arrives through the setpoint
+        if (_sp.accelMax && _sp.accelMax != _lastAccel) {
+            _motor->AccelMax(_sp.accelMax);
+            _lastAccel = _sp.accelMax;
+        }
+
+        _feedRate = _law.step(_sp.torqueTarget, _fastTorque, _sp.minRate, _sp.maxRate);
+
+        // A velocity move holds until replaced, so only re-command on a change
+        float change = _feedRate - _lastWrittenRate;
+        if (change < 0.0f) change = -change;
+        if (change > TORQUE_PID_WRITE_DEADBAND) {
+            _motor->MoveVelocity(static_cast<int32_t>(_sp.direction * _feedRate * _sp.stepsPerInch));
+            _lastWrittenRate = _feedRate;
+            _velocityWrites++;
+        }
+    }
+
+    _ticks++;
+
+    uint32_t tickUs = (DWT->CYCCNT - startCycles) / CYCLES_PER_MICROSECOND;
+    if (tickUs > _maxTickUs) _maxTickUs = tickUs;
+
+    Telemetry t;
+    t.torquePct = raw;
+    t.filteredTorque = _fastTorque;
+    t.smoothedTorque = _slowTorque;
+    t.feedRate = _feedRate;
+    t.error = error;
+    t.ticks = _ticks;
+    t.velocityWrites = _velocityWrites;
+    t.maxTickUs = _maxTickUs;
+    _telemetry.write(t);
+}
+
+// Same TCC2 setup as the ClearCore PeriodicInterrupt example
+void TorqueFeedLoop::configureTimer(uint32_t frequencyHz) {
+    // TCC2 and TCC3 share a clock that is already running at 120 MHz
+    CLOCK_ENABLE(APBCMASK, TCC2_);
+
+    TCC2->CTRLA.bit.ENABLE = 0;
+    SYNCBUSY_WAIT(TCC2, TCC_SYNCBUSY_ENABLE);
+
+    TCC2->CTRLA.bit.SWRST = 1;
+    while (TCC2->CTRLA.bit.SWRST) {
+        continue;
+    }
+
+    if (!frequencyHz) {
+        NVIC_DisableIRQ(TCC2_0_IRQn);
+        return;
+    }
+
+    // 5 kHz at 120 MHz fits the 16-bit period without a prescaler
+    uint32_t period = (CPU_CLK + frequencyHz / 2) / frequencyHz;
+    TCC2->PER.reg = period - 1;
+    TCC2->CTRLA.bit.PRESCALER = TCC_CTRLA_PRESCALER_DIV1_Val;
+
+    TCC2->INTENSET.bit.OVF = 1;
+    TCC2->CTRLA.bit.ENABLE = 1;
+
+    NVIC_SetPriority(TCC2_0_IRQn, TORQUE_LOOP_IRQ_PRIORITY);
+    NVIC_EnableIRQ(TCC2_0_IRQn);
+}
@@ -0,0 +1,81 @@
+// TorqueFeedLoop.h
+#pragma once
+
+#include <ClearCore.h>
+#include "SpscMailbox.h"
+#include "TorqueLaw.h"
+
+/// Opt-in hard-real-time torque feed loop (TORQUE_LOOP_IN_ISR).
+/// Runs from a timer interrupt at the ClearCore sample rate: samples HLFB
+/// torque, steps the TorqueLaw at a fixed dt and commands the Y velocity.
+/// DynamicFeed keeps the feed state machine in the main loop and talks to
+/// the interrupt only through two lock-free mailboxes. While a setpoint is
+/// active the interrupt is the only writer of the Y motor's move settings;
+/// the main loop's feed acceleration ramp goes through the setpoint too.
+class TorqueFeedLoop {
+public:
+    /// Main loop -> interrupt
+    struct Setpoint {
+        bool     active;         // interrupt owns MoveVelocity while true
+        uint32_t generation;     // bump to restart the law (new feed)
+        float    torqueTarget;   // %
+        TorqueLaw::Gains gains;  // Taken on a new generation
+        float    startRate;      // feed rate to start from on a new generation
+        float    minRate;
+        float    maxRate;
+        float    direction;      // +1 / -1
+        float    stepsPerInch;
+        uint32_t accelMax;       // steps/s^2, sent ahead of the next velocity while active
+    };
+
+    /// Interrupt -> main loop
+    struct Telemetry {
+        float    torquePct;      // latest HLFB sample
+        float    filteredTorque; // fast filter, what the law sees
+        float    smoothedTorque; // slow filter, for display
+        float    feedRate;
+        float    error;
+        uint32_t ticks;
+        uint32_t velocityWrites;
+        uint32_t maxTickUs;
+    };
+
+    static TorqueFeedLoop& Instance();
+
+    /// Start the periodic interrupt for the given motor
+    void begin(MotorDriver* motor);
+    void end();
+    bool running() const { return _running; }
+
+    void publish(const Setpoint& sp) { _setpoints.write(sp); }
+    bool telemetry(Telemetry& out) const { return _telemetry.read(out); }
+
+    /// Interrupt body - not for main-loop use
+    void tick();
+
+private:
+    TorqueFeedLoop() = default;
+    TorqueFeedLoop(const TorqueFeedLoop&) = delete;
+    TorqueFeedLoop& operator=(const TorqueFeedLoop&) = delete;
+
+    void configureTimer(uint32_t frequencyHz);
+
+    MotorDriver* _motor = nullptr;
+    volatile bool _running = false;
+
+    SpscMailbox<Setpoint>  _setpoints;
+    SpscMailbox<Telemetry> _telemetry;
+
+    // Interrupt-owned state
+    Setpoint  _sp = {};
+    TorqueLaw _law;
+    uint32_t  _generation = 0;
+    float     _feedRate = 0.0f;
+    float     _fastTorque = 0.0f;
+    float     _slowTorque = 0.0f;
+    float     _lastWrittenRate = 0.0f;
+    uint32_t  _lastAccel = 0;    // 0 until written since the setpoint went active
+    uint32_t  _ticks = 0;
+    uint32_t  _velocityWrites = 0;
+    uint32_t  _maxTickUs = 0;
+};
@@ -0,0 +1,95 @@
+// TorqueLaw.cpp
+#include "TorqueLaw.h"
+
+namespace {
+
+    // Gain scale by blade diameter (rows) and spindle RPM (columns). Feed
+    // force per in/s goes as 1/(diameter x RPM) - the same chip load over a
+    // faster rim - but scaling the gains by that alone starves the air feed
+    // and the entry on small blades and slow spindles, and every cell cuts
+    // slower than the nominal gains. Each cell is the lowest scale that is
+    // no slower than nominal in tools/torque_sim, plus a margin. The slowest
+    // cells still get the smaller gains they need, and the fast cells stay
+    // at nominal. Retune from cut recordings.
+    constexpr int DIAMETERS = 4;
+    constexpr int SPEEDS = 4;
+    const float kDiameters[DIAMETERS] = { 2.0f, 4.0f, 7.0f, 10.0f };    // Inches
+    const float kSpeeds[SPEEDS] = { 1000.0f, 2000.0f, 3000.0f, 4000.0f };
+    const float kScale[DIAMETERS][SPEEDS] = {
+        { 0.25f, 0.45f, 0.75f, 0.95f },
+        { 0.45f, 0.95f, 1.00f, 1.00f },
+        { 0.80f, 1.00f, 1.00f, 1.10f },
+        { 1.00f, 1.00f, 1.00f, 1.10f },
+    };
+
+    float clampf(float v, float lo, float hi) {
+        return v < lo ? lo : v > hi ? hi : v;
+    }
+
+    // Cell below the value and how far it is into the next, clamped at the ends
+    void locate(const float* points, int count, float value, int& cell, float& frac) {
+        if (value <= points[0]) { cell = 0; frac = 0.0f; return; }
+        for (cell = 0; cell < count - 2 && value > points[cell + 1]; cell++) {}
+        frac = clampf((value - points[cell]) / (points[cell + 1] - points[cell]), 0.0f, 1.0f);
+    }
+}
+
+TorqueLaw::Gains TorqueLaw::schedule(float bladeDiameter, float rpm) {
+    int i;
+    int j;
+    float fi;
+    float fj;
+    locate(kDiameters, DIAMETERS, bladeDiameter, i, fi);
+    locate(kSpeeds, SPEEDS, rpm, j, fj);
+
+    float lo = kScale[i][j] + (kScale[i][j + 1] - kScale[i][j]) * fj;
+    float hi = kScale[i + 1][j] + (kScale[i + 1][j + 1] - kScale[i + 1][j]) * fj;
+    float scale = lo + (hi - lo) * fi;
+
+    Gains g = { KP * scale, KI * scale, KD * scale };
+    return g;
+}
+
+void TorqueLaw::configure(const Gains& gains, float dt) {
+    _gains = gains;
+    _dt = dt;
+    _alpha = dt / (DERIVATIVE_TAU + dt);
+}
+
+void TorqueLaw::reset(float rate, float measurement) {
+    _integral = rate;
+    _output = rate;
+    _filtered = measurement;
+    _holding = false;
+}
+
+float TorqueLaw::step(float target, float measurement, float minRate, float maxRate) {
+    float error = target - measurement;
+
+    float previous = _filtered;
+    _filtered += (measurement - _filtered) * _alpha;
+    float derivative = (_filtered - previous) / _dt;
+
+    float p = _gains.kp * error;
+    float d = -_gains.kd * derivative;
+    float integral = _integral + _gains.ki * error * _dt;
+    float raw = p + integral + d;
+
+    // Slew, then range: a lowered max rate takes effect at once
+    float up = _output + SLEW_UP * maxRate * _dt;
+    float down = _output - SLEW_DOWN * maxRate * _dt;
+    float slewed = clampf(raw, down, up);
+    float out = clampf(slewed, minRate, maxRate);
+
+    // Conditional integration: hold while pinned at a limit and pushing
+    // further into it, or while the error is too large for the integral to
+    // mean anything (the blade in air, or just hitting a hard spot)
+    float band = INTEGRAL_BAND * target;
+    _holding = (out < raw && error > 0.0f) || (out > raw && error < 0.0f)
+        || error > band || error < -band;
+    if (!_holding) _integral = integral;
+    _integral = clampf(_integral, minRate, maxRate);
+
+    _output = out;
+    return out;
+}
@@ -0,0 +1,63 @@
+// TorqueLaw.h
+#pragma once
+
+#include <stdint.h>
+
+/// The torque-following feed law shared by the main-loop and interrupt
+/// paths: a discrete PID from measured Y torque (%) to feed rate (in/s),
+/// stepped at a fixed period set by configure().
+///
+/// - Conditional integration: the integral holds while the output is held
+///   at a rate or slew limit and the error pushes further into it, and while
+///   the error is outside INTEGRAL_BAND of the target. An air cut doesn't
+///   wind it up before the blade reaches the stock.
+/// - Derivative on the filtered measurement, not the error: no kick on a
+///   target change, and HLFB noise is filtered before it is differentiated.
+/// - Output slew limits, faster down than up: the feed backs off a torque
+///   spike quicker than it builds into one.
+/// - Gains scheduled on blade diameter and spindle RPM (schedule()).
+///
+/// Host-tested against a cutting plant in tools/torque_sim.
+class TorqueLaw {
+public:
+    struct Gains {
+        float kp;   // in/s per % torque error
+        float ki;   // in/s per %-second
+        float kd;   // in/s per %/s of measured torque
+    };
+
+    /// Gains at the schedule's unity point, 10" blade at 3000 RPM
+    static constexpr float KP = 0.004f;
+    static constexpr float KI = 0.3f;
+    static constexpr float KD = 0.00002f;
+    static constexpr float DERIVATIVE_TAU = 0.020f;  // s, measurement filter for D
+    static constexpr float SLEW_UP = 1.0f;           // Max rate per second
+    static constexpr float SLEW_DOWN = 20.0f;
+    static constexpr float INTEGRAL_BAND = 0.5f;     // Integrate within this fraction of the target
+
+    /// Nominal gains scaled for this blade and spindle speed
+    static Gains schedule(float bladeDiameter, float rpm);
+
+    /// Gains and the fixed step period (s). Takes effect on the next step.
+    void configure(const Gains& gains, float dt);
+
+    /// Start from the given output with no history
+    void reset(float rate, float measurement);
+
+    /// One period of the law. Returns the new feed rate.
+    float step(float target, float measurement, float minRate, float maxRate);
+
+    float output() const { return _output; }
+    float integral() const { return _integral; }
+    bool holding() const { return _holding; }   // Integral held at a rate limit last step
+
+private:
+    Gains _gains = { KP, KI, KD };
+    float _dt = 0.002f;
+    float _alpha = 0.0f;        // Derivative filter coefficient
+
+    float _integral = 0.0f;
+    float _filtered = 0.0f;
+    float _output = 0.0f;
+    bool _holding = false;
+};
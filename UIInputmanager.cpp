@@ -1,14 +1,13 @@
 ﻿// UIInputManager.cpp
 #include "UIInputManager.h"
+#include "DisplayValue.h"
 #include "Config.h"          // for ENCODER_COUNTS_PER_CLICK
 #include "MPGJogManager.h"
 #include <genieArduinoDEV.h>
 #include <ClearCore.h>
-#include <cmath>
 #include "ScreenManager.h"  
 
 
-extern Genie genie;
 
 UIInputManager& UIInputManager::Instance() {
     static UIInputManager inst;
@@ -30,21 +29,19 @@ void UIInputManager::init(int counts) {
 }
 
 void UIInputManager::bindField(uint8_t win, uint8_t led, float* ptr,
-    float mn, float mx, float st, uint8_t dp) {
+    float mn, float mx, float st) {
     binding.winButtonId = win;
     binding.ledDigitId = led;
     binding.valuePtr = ptr;
-    binding.min = mn;
-    binding.max = mx;
-    binding.step = st;
-    binding.decimalPlaces = dp;
+    binding.min = DisplayValue::toScaled(mn, led);
+    binding.max = DisplayValue::toScaled(mx, led);
+    binding.step = DisplayValue::toScaled(st, led);
+    if (binding.step < 1) binding.step = 1;   // Finer than the digits show
     binding.lastDetent = ClearCore::EncoderIn.Position() / countsPerClick;
     binding.active = true;
 
     // write initial value
-    float v = *binding.valuePtr;
-    int32_t scaled = (int32_t)round(v * pow(10, dp));
-    genie.WriteObject(GENIE_OBJ_LED_DIGITS, binding.ledDigitId, (uint16_t)scaled);
+    DisplayValue::show(binding.ledDigitId, *binding.valuePtr);
 }
 
 void UIInputManager::unbindField() {
@@ -70,16 +67,17 @@ void UIInputManager::update() {
         int32_t detent = raw / countsPerClick;
         int32_t delta = detent - binding.lastDetent;
         if (delta != 0) {
-            float newVal = *binding.valuePtr + binding.step * delta;
-            if (newVal < binding.min) newVal = binding.min;
-            else if (newVal > binding.max) newVal = binding.max;
-            *binding.valuePtr = newVal;
+            int32_t scaled = DisplayValue::toScaled(*binding.valuePtr, binding.ledDigitId)
+                + binding.step * delta;
+            if (scaled < binding.min) scaled = binding.min;
+            else if (scaled > binding.max) scaled = binding.max;
+            *binding.valuePtr = DisplayValue::fromScaled(scaled, binding.ledDigitId);
 
-            int32_t scaled = (int32_t)round(newVal * pow(10, binding.decimalPlaces));
-            genie.WriteObject(GENIE_OBJ_LED_DIGITS, binding.ledDigitId, (uint16_t)scaled);
+            DisplayValue::showScaled(binding.ledDigitId, scaled);
 
             binding.lastDetent = detent;
         }
+        MPGJogManager::Instance().routeWheel(false);
         return;
     }
 
@@ -95,6 +93,13 @@ void UIInputManager::update() {
             if (RANGE_PIN_X100.State()) range = JOG_MULTIPLIER_X100;
             MPGJogManager::Instance().setRangeMultiplier(range);
 
+            // Following reads the wheel itself from the motion task
+            if (MPGJogManager::Instance().isFollowMode()) {
+                _lastRaw = ClearCore::EncoderIn.Position();
+                MPGJogManager::Instance().routeWheel(true);
+                return;
+            }
+
             // Then handle the encoder movement
             int32_t rawDelta = ClearCore::EncoderIn.Position() - _lastRaw;
             int32_t clicks = rawDelta / countsPerClick;
@@ -104,4 +109,5 @@ void UIInputManager::update() {
             }
         }
     }
+    MPGJogManager::Instance().routeWheel(false);
 }
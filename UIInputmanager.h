@@ -5,7 +5,6 @@
 #include <genieArduinoDEV.h>
 #include <ClearCore.h>
 #include <cstdint>
-#include <cmath>
 
 /// Manages both field‐editing and MPG jog delegation
 class UIInputManager {
@@ -15,14 +14,15 @@ public:
     /// Call once in setup()
     void init(int countsPerClick = ENCODER_COUNTS_PER_CLICK);
 
-    /// Bind a WinButton+LEDDigits pair for numeric editing
+    /// Bind a WinButton+LEDDigits pair for numeric editing. The value steps
+    /// in the LED's own fixed-point units (DisplayValue), so repeated
+    /// steps never drift off the shown digits.
     void bindField(uint8_t winButtonId,
         uint8_t ledDigitId,
         float* storagePtr,
         float min,
         float max,
-        float step,
-        uint8_t decimalPlaces);
+        float step);
 
     /// Unbind the current field (enter/exit editing)
     void unbindField();
@@ -47,8 +47,7 @@ private:
         uint8_t  winButtonId;
         uint8_t  ledDigitId;
         float* valuePtr;
-        float    min, max, step;
-        uint8_t  decimalPlaces;
+        int32_t  min, max, step;    // Scaled to the LED's decimals
         int32_t  lastDetent;
         bool     active;
     } binding;
@@ -0,0 +1,132 @@
+// UiTimeline.cpp
+#include "UiTimeline.h"
+#include "DisplayModel.h"
+#include <ClearCore.h>
+#include <genieArduinoDEV.h>
+
+UiTimeline& UiTimeline::Instance() {
+    static UiTimeline inst;
+    return inst;
+}
+
+UiTimeline::Track* UiTimeline::find(uint8_t object, uint8_t index) {
+    for (int i = 0; i < MAX_TRACKS; i++) {
+        if (_tracks[i].used && _tracks[i].object == object && _tracks[i].index == index) {
+            return &_tracks[i];
+        }
+    }
+    return nullptr;
+}
+
+void UiTimeline::play(uint8_t object, uint8_t index, const Keyframe* keys, uint8_t count) {
+    if (count > MAX_KEYS) count = MAX_KEYS;
+
+    Track* t = find(object, index);
+    if (!t) {
+        for (int i = 0; i < MAX_TRACKS && !t; i++) {
+            if (!_tracks[i].used) t = &_tracks[i];
+        }
+    }
+    if (!t) {
+        // No free track - jump to the end state rather than leave it stuck on
+        if (count) DisplayModel::Instance().set(object, index, keys[count - 1].value);
+        return;
+    }
+
+    t->used = true;
+    t->object = object;
+    t->index = index;
+    t->count = count;
+    t->next = 0;
+    t->startMs = ClearCore::TimingMgr.Milliseconds();
+    for (uint8_t k = 0; k < count; k++) {
+        t->keys[k] = keys[k];
+    }
+
+    advance(*t, t->startMs);
+    updateNextDue();
+}
+
+void UiTimeline::writeLater(uint8_t object, uint8_t index, uint16_t value, uint16_t delayMs) {
+    Keyframe key = { delayMs, value };
+    play(object, index, &key, 1);
+}
+
+void UiTimeline::flash(uint16_t buttonId, uint16_t holdMs) {
+    Keyframe keys[] = { { 0, 1 }, { holdMs, 0 } };
+    play(GENIE_OBJ_WINBUTTON, static_cast<uint8_t>(buttonId), keys, 2);
+}
+
+void UiTimeline::blink(uint16_t buttonId, uint8_t times, uint16_t periodMs) {
+    if (times > MAX_KEYS / 2) times = MAX_KEYS / 2;
+    Keyframe keys[MAX_KEYS];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < times; i++) {
+        keys[n++] = { static_cast<uint16_t>(2 * i * periodMs), 1 };
+        keys[n++] = { static_cast<uint16_t>((2 * i + 1) * periodMs), 0 };
+    }
+    play(GENIE_OBJ_WINBUTTON, static_cast<uint8_t>(buttonId), keys, n);
+}
+
+void UiTimeline::stop(uint8_t object, uint8_t index) {
+    Track* t = find(object, index);
+    if (t) {
+        t->used = false;
+        _active--;
+    }
+}
+
+void UiTimeline::settleAll() {
+    for (int i = 0; i < MAX_TRACKS; i++) {
+        Track& t = _tracks[i];
+        if (!t.used) continue;
+        DisplayModel::Instance().set(t.object, t.index, t.keys[t.count - 1].value);
+        t.used = false;
+    }
+    _active = 0;
+}
+
+bool UiTimeline::advance(Track& t, uint32_t now) {
+    // Only the newest due key is written; if the loop stalled past several,
+    // DisplayModel would coalesce them anyway
+    uint32_t elapsed = now - t.startMs;
+    uint8_t due = t.next;
+    while (due < t.count && t.keys[due].atMs <= elapsed) due++;
+    if (due != t.next) {
+        DisplayModel::Instance().set(t.object, t.index, t.keys[due - 1].value);
+        t.next = due;
+    }
+    return due < t.count;
+}
+
+void UiTimeline::updateNextDue() {
+    // Count live tracks and find the earliest upcoming key, so update() is
+    // one compare on the ticks where nothing is due
+    _active = 0;
+    bool any = false;
+    for (int i = 0; i < MAX_TRACKS; i++) {
+        Track& t = _tracks[i];
+        if (!t.used) continue;
+        if (t.next >= t.count) {
+            t.used = false;
+            continue;
+        }
+        _active++;
+        uint32_t due = t.startMs + t.keys[t.next].atMs;
+        if (!any || static_cast<int32_t>(due - _nextDueMs) < 0) {
+            _nextDueMs = due;
+            any = true;
+        }
+    }
+}
+
+void UiTimeline::update() {
+    if (_active == 0) return;
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    if (static_cast<int32_t>(now - _nextDueMs) < 0) return;
+
+    for (int i = 0; i < MAX_TRACKS; i++) {
+        if (_tracks[i].used) advance(_tracks[i], now);
+    }
+    updateNextDue();
+}
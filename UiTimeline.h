@@ -0,0 +1,69 @@
+// UiTimeline.h
+#pragma once
+
+#include <stdint.h>
+
+/// Keyframe player for button flashes and other short-lived indicators.
+/// A screen hands over a list of (time, value) keyframes for one display
+/// object - "on at +0, off at +100 ms, on at +200 ms" - and update() sends
+/// each value through DisplayModel when its time comes, so feedback never
+/// costs loop time. An object plays one track at a time; starting a new
+/// one replaces whatever it was playing.
+class UiTimeline {
+public:
+    struct Keyframe {
+        uint16_t atMs;      // From the start of the track, ascending
+        uint16_t value;
+    };
+
+    static constexpr uint8_t MAX_KEYS = 8;
+
+    static UiTimeline& Instance();
+
+    /// Play keyframes on one object; keys at 0 ms are written straight away
+    void play(uint8_t object, uint8_t index, const Keyframe* keys, uint8_t count);
+
+    /// Write a value after delayMs
+    void writeLater(uint8_t object, uint8_t index, uint16_t value, uint16_t delayMs);
+
+    /// Show a WinButton pressed now and release it after holdMs
+    void flash(uint16_t buttonId, uint16_t holdMs = 200);
+
+    /// Toggle a WinButton on/off `times` times, periodMs per half cycle, ending off
+    void blink(uint16_t buttonId, uint8_t times = 2, uint16_t periodMs = 50);
+
+    /// Drop an object's track without writing the rest of it
+    void stop(uint8_t object, uint8_t index);
+
+    /// Jump every track to its last keyframe - used on form changes so
+    /// nothing is left half-way through a flash
+    void settleAll();
+
+    /// Send keyframes that have fallen due - call every screen tick
+    void update();
+
+private:
+    UiTimeline() = default;
+    UiTimeline(const UiTimeline&) = delete;
+    UiTimeline& operator=(const UiTimeline&) = delete;
+
+    struct Track {
+        bool     used;
+        uint8_t  object;
+        uint8_t  index;
+        uint8_t  count;
+        uint8_t  next;          // First keyframe not yet sent
+        uint32_t startMs;
+        Keyframe keys[MAX_KEYS];
+    };
+
+    static constexpr int MAX_TRACKS = 16;
+
+    Track* find(uint8_t object, uint8_t index);
+    bool advance(Track& t, uint32_t now);
+    void updateNextDue();
+
+    Track _tracks[MAX_TRACKS] = {};
+    uint8_t _active = 0;
+    uint32_t _nextDueMs = 0;
+};
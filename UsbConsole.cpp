@@ -0,0 +1,83 @@
+// UsbConsole.cpp
+#include "UsbConsole.h"
+#include "Log.h"
+#include <string.h>
+
+UsbConsole& UsbConsole::Instance() {
+    static UsbConsole inst;
+    return inst;
+}
+
+bool UsbConsole::registerCommand(const char* name, CommandFn fn, const char* help) {
+    if (_numCommands >= MAX_COMMANDS || !fn) {
+        LOG_ERROR(Sys, "[Console] Cannot register ", name);
+        return false;
+    }
+    _commands[_numCommands++] = { name, fn, help };
+    return true;
+}
+
+void UsbConsole::update() {
+    // Bounded per call so a pasted blob can't stall the loop
+    for (int n = 0; n < MAX_CHARS_PER_UPDATE; n++) {
+        int16_t c = ClearCore::ConnectorUsb.CharGet();
+        if (c < 0) return;
+
+        if (c == '\r' || c == '\n') {
+            if (_lineLen > 0 && !_overflow) {
+                _line[_lineLen] = '\0';
+                dispatch(_line);
+            }
+            else if (_overflow) {
+                ClearCore::ConnectorUsb.SendLine("[Console] Line too long");
+            }
+            _lineLen = 0;
+            _overflow = false;
+            continue;
+        }
+
+        if (_lineLen < LINE_LEN - 1) {
+            _line[_lineLen++] = static_cast<char>(c);
+        }
+        else {
+            _overflow = true;
+        }
+    }
+}
+
+void UsbConsole::dispatch(char* line) {
+    // Split "<command> <args>" in place
+    while (*line == ' ') line++;
+    char* args = line;
+    while (*args && *args != ' ') args++;
+    if (*args) {
+        *args++ = '\0';
+        while (*args == ' ') args++;
+    }
+    if (*line == '\0') return;
+
+    if (strcmp(line, "help") == 0) {
+        printHelp();
+        return;
+    }
+
+    for (int i = 0; i < _numCommands; i++) {
+        if (strcmp(line, _commands[i].name) == 0) {
+            _commands[i].fn(args);
+            return;
+        }
+    }
+
+    ClearCore::ConnectorUsb.Send("[Console] Unknown command: ");
+    ClearCore::ConnectorUsb.SendLine(line);
+}
+
+void UsbConsole::printHelp() const {
+    ClearCore::ConnectorUsb.SendLine("[Console] Commands:");
+    for (int i = 0; i < _numCommands; i++) {
+        ClearCore::ConnectorUsb.Send("  ");
+        ClearCore::ConnectorUsb.Send(_commands[i].name);
+        ClearCore::ConnectorUsb.Send(" - ");
+        ClearCore::ConnectorUsb.SendLine(_commands[i].help);
+    }
+}
@@ -0,0 +1,45 @@
+// UsbConsole.h
+#pragma once
+
+#include <ClearCore.h>
+
+/// Line-based command console on the USB serial port.
+/// Subsystems register named commands; update() drains whatever input has
+/// arrived without waiting, and dispatches a command once a full line is in.
+/// Lines look like "<command> [args]", e.g. "lat reset".
+class UsbConsole {
+public:
+    /// args points at the text after the command word ("" if none)
+    typedef void (*CommandFn)(const char* args);
+
+    static UsbConsole& Instance();
+
+    bool registerCommand(const char* name, CommandFn fn, const char* help);
+
+    /// Poll for input - call from a scheduler task
+    void update();
+
+private:
+    UsbConsole() = default;
+    UsbConsole(const UsbConsole&) = delete;
+    UsbConsole& operator=(const UsbConsole&) = delete;
+
+    void dispatch(char* line);
+    void printHelp() const;
+
+    struct Command {
+        const char* name;
+        CommandFn   fn;
+        const char* help;
+    };
+
+    static constexpr int MAX_COMMANDS = 16;
+    static constexpr int LINE_LEN = 64;
+    static constexpr int MAX_CHARS_PER_UPDATE = 32;
+
+    Command _commands[MAX_COMMANDS];
+    int  _numCommands = 0;
+    char _line[LINE_LEN];
+    int  _lineLen = 0;
+    bool _overflow = false;
+};
@@ -1,15 +1,17 @@
 // XAxis.cpp
 #include "XAxis.h"
 #include "Config.h"
+#include "Log.h"
 #include "ClearCore.h"
 #include "EncoderPositionTracker.h"
 
-static constexpr float MAX_VELOCITY = 10000.0f;   // steps/s
-static constexpr float MAX_ACCELERATION = 100000.0f;  // steps/s^2
+static constexpr float MAX_VELOCITY = FENCE_VEL_MAX;        // steps/s
+static constexpr float MAX_ACCELERATION = FENCE_ACCEL_MAX;  // steps/s^2
 
 XAxis::XAxis()
     : _stepsPerInch(FENCE_STEPS_PER_INCH)
     , _motor(&MOTOR_FENCE_X)
+    , _queue(&MOTOR_FENCE_X, MAX_VELOCITY, MAX_ACCELERATION, FENCE_MOVE_JERK)
     , _isSetup(false)
     , _isHomed(false)
     , _isMoving(false)
@@ -38,92 +40,135 @@ void XAxis::Setup() {
     _motor->HlfbCarrier(MotorDriver::HLFB_CARRIER_482_HZ);
     _motor->VelMax(MAX_VELOCITY);
     _motor->AccelMax(MAX_ACCELERATION);
+#if MOTION_SCURVE
+    _motor->JerkMax(FENCE_JERK_MAX);
+#endif
     ClearAlerts();
     _isSetup = true;
-    ClearCore::ConnectorUsb.SendLine("[X-Axis] Setup complete");
+    LOG_INFO(Motion, "[X-Axis] Setup complete");
 }
 
 void XAxis::ClearAlerts() {
-    ClearCore::ConnectorUsb.SendLine("[X-Axis] Checking for alerts");
+    if (_faultReset != FAULT_RESET_IDLE) return;    // Already cycling enable
+    LOG_INFO(Motion, "[X-Axis] Checking for alerts");
     if (_motor->StatusReg().bit.AlertsPresent) {
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] Alerts present:");
+        LOG_WARN(Motion, "[X-Axis] Alerts present:");
         if (_motor->AlertReg().bit.MotionCanceledInAlert)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledInAlert");
+            LOG_WARN(Motion, " - MotionCanceledInAlert");
         if (_motor->AlertReg().bit.MotionCanceledPositiveLimit)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledPositiveLimit");
+            LOG_WARN(Motion, " - MotionCanceledPositiveLimit");
         if (_motor->AlertReg().bit.MotionCanceledNegativeLimit)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledNegativeLimit");
+            LOG_WARN(Motion, " - MotionCanceledNegativeLimit");
         if (_motor->AlertReg().bit.MotionCanceledSensorEStop)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledSensorEStop");
+            LOG_WARN(Motion, " - MotionCanceledSensorEStop");
         if (_motor->AlertReg().bit.MotionCanceledMotorDisabled)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledMotorDisabled");
+            LOG_WARN(Motion, " - MotionCanceledMotorDisabled");
         if (_motor->AlertReg().bit.MotorFaulted) {
-            ClearCore::ConnectorUsb.SendLine(" - MotorFaulted");
+            LOG_ERROR(Motion, " - MotorFaulted");
+            // Update() re-enables and clears the alerts once it has settled
             _motor->EnableRequest(false);
-            Delay_ms(100);
-            _motor->EnableRequest(true);
-            Delay_ms(100);
+            _faultReset = FAULT_RESET_DISABLED;
+            _faultResetMs = ClearCore::TimingMgr.Milliseconds();
+            return;
         }
         _motor->ClearAlerts();
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] Alerts cleared");
+        LOG_INFO(Motion, "[X-Axis] Alerts cleared");
     }
     else {
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] No alerts present");
+        LOG_INFO(Motion, "[X-Axis] No alerts present");
     }
 }
 
 bool XAxis::StartHoming() {
     if (!_isSetup) {
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] Cannot start homing: not setup");
+        LOG_WARN(Motion, "[X-Axis] Cannot start homing: not setup");
         return false;
     }
-    // enable on-demand
-    _motor->EnableRequest(true);
-    if (_motor->StatusReg().bit.AlertsPresent) ClearAlerts();
+    _queue.clear();
+    if (_faultReset == FAULT_RESET_IDLE) {
+        // enable on-demand
+        _motor->EnableRequest(true);
+        if (_motor->StatusReg().bit.AlertsPresent) ClearAlerts();
+    }
+    // A faulted motor takes a few hundred ms to reset; home after that
+    if (_faultReset != FAULT_RESET_IDLE) {
+        _homePending = true;
+        _isHomed = false;
+        LOG_INFO(Motion, "[X-Axis] Homing waits for the fault reset");
+        return true;
+    }
+    return beginHoming();
+}
+
+bool XAxis::beginHoming() {
     bool ok = _homingHelper->start();
     if (ok) {
         _isHomed = false;
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] Homing started");
+        LOG_INFO(Motion, "[X-Axis] Homing started");
     }
     return ok;
 }
 
+void XAxis::updateFaultReset() {
+    if (_faultReset == FAULT_RESET_IDLE) return;
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    if (now - _faultResetMs < FAULT_RESET_SETTLE_MS) return;
+    _faultResetMs = now;
+
+    if (_faultReset == FAULT_RESET_DISABLED) {
+        _motor->EnableRequest(true);
+        _faultReset = FAULT_RESET_ENABLED;
+        return;
+    }
+    _faultReset = FAULT_RESET_IDLE;
+    _motor->ClearAlerts();
+    LOG_INFO(Motion, "[X-Axis] Fault reset, alerts cleared");
+    if (_homePending) {
+        _homePending = false;
+        beginHoming();
+    }
+}
+
 void XAxis::Update() {
     if (!_isSetup) return;
     _currentPos = static_cast<float>(_motor->PositionRefCommanded()) / _stepsPerInch;
-    _isMoving = !_motor->StepsComplete();
+    _queue.update();
+    _isMoving = IsMoving();
     _torquePct = GetTorquePercent();
+    updateFaultReset();
 
     if (_homingHelper->isBusy()) {
         _homingHelper->process();
     }
-    else if (!_isHomed && !_homingHelper->hasFailed()) {
+    else if (!_isHomed && !_homePending && !_homingHelper->hasFailed()) {
         _isHomed = true;
         _hasBeenHomed = true;
 
         // Reset encoder position tracking when X-axis homing completes
         EncoderPositionTracker::Instance().resetPositionAfterHoming();
 
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] Homing complete, encoder position reset");
+        LOG_INFO(Motion, "[X-Axis] Homing complete, encoder position reset");
     }
 }
 
 bool XAxis::MoveTo(float positionInches, float velocityScale) {
     if (!_isSetup) {
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] MoveTo failed: not setup");
+        LOG_WARN(Motion, "[X-Axis] MoveTo failed: not setup");
         return false;
     }
-    if (_homingHelper->isBusy()) {
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] MoveTo failed: homing in progress");
+    if (IsHoming()) {
+        LOG_WARN(Motion, "[X-Axis] MoveTo failed: homing in progress");
         return false;
     }
     if (!_hasBeenHomed) {
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] MoveTo failed: axis not homed yet");
+        LOG_WARN(Motion, "[X-Axis] MoveTo failed: axis not homed yet");
         return false;
     }
+    // A direct move replaces anything queued
+    _queue.clear();
     float desired = positionInches;
     if (desired < 0.0f || desired > MAX_X_INCHES) {
-        ClearCore::ConnectorUsb.SendLine("[X-Axis] Soft limit reached, stopping");
+        LOG_WARN(Motion, "[X-Axis] Soft limit reached, stopping");
         _motor->MoveStopAbrupt();
         _isMoving = false;
         return false;
@@ -137,13 +182,39 @@ bool XAxis::MoveTo(float positionInches, float velocityScale) {
     if (delta == 0) return true;
 
     _motor->VelMax(static_cast<uint32_t>(MAX_VELOCITY * velocityScale));
-    ClearCore::ConnectorUsb.Send("[X-Axis] MoveTo: ");
-    ClearCore::ConnectorUsb.Send(_targetPos);
-    ClearCore::ConnectorUsb.SendLine(" inches");
+    LOG_INFO(Motion, "[X-Axis] MoveTo: ", _targetPos, " inches");
     return _motor->Move(delta);
 }
 
+bool XAxis::JogVelocity(float inchesPerSec) {
+    if (!_isSetup || IsHoming() || !_hasBeenHomed) return false;
+    _queue.clear();
+    if ((inchesPerSec > 0.0f && _currentPos >= MAX_X_INCHES) ||
+        (inchesPerSec < 0.0f && _currentPos <= 0.0f)) {
+        inchesPerSec = 0.0f;
+    }
+    float vel = inchesPerSec * _stepsPerInch;
+    if (vel > MAX_VELOCITY) vel = MAX_VELOCITY;
+    else if (vel < -MAX_VELOCITY) vel = -MAX_VELOCITY;
+    return _motor->MoveVelocity(static_cast<int32_t>(vel));
+}
+
+uint16_t XAxis::Enqueue(float positionInches, float velocityScale, bool blend) {
+    if (!_isSetup || IsHoming() || !_hasBeenHomed) {
+        LOG_WARN(Motion, "[X-Axis] Enqueue refused: not setup, homing or not homed");
+        return 0;
+    }
+    if (positionInches < 0.0f || positionInches > MAX_X_INCHES) {
+        LOG_WARN(Motion, "[X-Axis] Enqueue refused: ", positionInches, " outside soft limits");
+        return 0;
+    }
+    uint16_t id = _queue.push(static_cast<int32_t>(positionInches * _stepsPerInch), velocityScale, blend);
+    if (!id) LOG_WARN(Motion, "[X-Axis] Enqueue refused: queue full");
+    return id;
+}
+
 void XAxis::Stop() {
+    _queue.clear();
     if (_isMoving) {
         _motor->MoveStopDecel();
         _isMoving = false;
@@ -151,6 +222,8 @@ void XAxis::Stop() {
 }
 
 void XAxis::EmergencyStop() {
+    _homePending = false;
+    _queue.clear();
     _motor->MoveStopAbrupt();
     _isMoving = false;
 }
@@ -163,6 +236,6 @@ float XAxis::GetTorquePercent() const {
     return _motor->HlfbState() == MotorDriver::HLFB_ASSERTED ? 100.0f : 0.0f;
 }
 
-bool XAxis::IsMoving() const { return !_motor->StepsComplete(); }
+bool XAxis::IsMoving() const { return !_motor->StepsComplete() || !_queue.empty(); }
 bool XAxis::IsHomed()  const { return _isHomed; }
-bool XAxis::IsHoming() const { return _homingHelper->isBusy(); }
+bool XAxis::IsHoming() const { return _homingHelper->isBusy() || _homePending; }
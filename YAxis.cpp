@@ -1,15 +1,17 @@
 #include "YAxis.h"
 #include "Config.h"
+#include "Log.h"
 #include "ClearCore.h"
 #include "EncoderPositionTracker.h"
 #include "DynamicFeed.h"
 
-static constexpr float MAX_VELOCITY = 10000.0f;      // steps/s
-static constexpr float MAX_ACCELERATION = 100000.0f; // steps/s^2
+static constexpr float MAX_VELOCITY = TABLE_VEL_MAX;        // steps/s
+static constexpr float MAX_ACCELERATION = TABLE_ACCEL_MAX;  // steps/s^2
 
 YAxis::YAxis()
     : _stepsPerInch(TABLE_STEPS_PER_INCH)
     , _motor(&MOTOR_TABLE_Y)
+    , _queue(&MOTOR_TABLE_Y, MAX_VELOCITY, MAX_ACCELERATION, TABLE_MOVE_JERK)
     , _isSetup(false)
     , _isHomed(false)
     , _isMoving(false)
@@ -40,61 +42,100 @@ void YAxis::Setup() {
     _motor->HlfbCarrier(MotorDriver::HLFB_CARRIER_482_HZ);
     _motor->VelMax(MAX_VELOCITY);
     _motor->AccelMax(MAX_ACCELERATION);
+#if MOTION_SCURVE
+    _motor->JerkMax(TABLE_JERK_MAX);
+#endif
     ClearAlerts();
     _isSetup = true;
-    ClearCore::ConnectorUsb.SendLine("[Y-Axis] Setup complete");
+    LOG_INFO(Motion, "[Y-Axis] Setup complete");
 }
 
 void YAxis::ClearAlerts() {
-    ClearCore::ConnectorUsb.SendLine("[Y-Axis] Checking for alerts");
+    if (_faultReset != FAULT_RESET_IDLE) return;    // Already cycling enable
+    LOG_INFO(Motion, "[Y-Axis] Checking for alerts");
     if (_motor->StatusReg().bit.AlertsPresent) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Alerts present:");
+        LOG_WARN(Motion, "[Y-Axis] Alerts present:");
         if (_motor->AlertReg().bit.MotionCanceledInAlert)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledInAlert");
+            LOG_WARN(Motion, " - MotionCanceledInAlert");
         if (_motor->AlertReg().bit.MotionCanceledPositiveLimit)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledPositiveLimit");
+            LOG_WARN(Motion, " - MotionCanceledPositiveLimit");
         if (_motor->AlertReg().bit.MotionCanceledNegativeLimit)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledNegativeLimit");
+            LOG_WARN(Motion, " - MotionCanceledNegativeLimit");
         if (_motor->AlertReg().bit.MotionCanceledSensorEStop)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledSensorEStop");
+            LOG_WARN(Motion, " - MotionCanceledSensorEStop");
         if (_motor->AlertReg().bit.MotionCanceledMotorDisabled)
-            ClearCore::ConnectorUsb.SendLine(" - MotionCanceledMotorDisabled");
+            LOG_WARN(Motion, " - MotionCanceledMotorDisabled");
         if (_motor->AlertReg().bit.MotorFaulted) {
-            ClearCore::ConnectorUsb.SendLine(" - MotorFaulted");
+            LOG_ERROR(Motion, " - MotorFaulted");
+            // Update() re-enables and clears the alerts once it has settled
             _motor->EnableRequest(false);
-            Delay_ms(100);
-            _motor->EnableRequest(true);
-            Delay_ms(100);
+            _faultReset = FAULT_RESET_DISABLED;
+            _faultResetMs = ClearCore::TimingMgr.Milliseconds();
+            return;
         }
         _motor->ClearAlerts();
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Alerts cleared");
+        LOG_INFO(Motion, "[Y-Axis] Alerts cleared");
     }
     else {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] No alerts present");
+        LOG_INFO(Motion, "[Y-Axis] No alerts present");
     }
 }
 
 bool YAxis::StartHoming() {
     if (!_isSetup) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Cannot start homing: not setup");
+        LOG_WARN(Motion, "[Y-Axis] Cannot start homing: not setup");
         return false;
     }
-    _motor->EnableRequest(true);
-    if (_motor->StatusReg().bit.AlertsPresent)
-        ClearAlerts();
+    _queue.clear();
+    if (_faultReset == FAULT_RESET_IDLE) {
+        _motor->EnableRequest(true);
+        if (_motor->StatusReg().bit.AlertsPresent)
+            ClearAlerts();
+    }
+
+    // A faulted motor takes a few hundred ms to reset; home after that
+    if (_faultReset != FAULT_RESET_IDLE) {
+        _homePending = true;
+        _isHomed = false;
+        LOG_INFO(Motion, "[Y-Axis] Homing waits for the fault reset");
+        return true;
+    }
+    return beginHoming();
+}
 
+bool YAxis::beginHoming() {
     bool ok = _homingHelper->start();
     if (ok) {
         _isHomed = false;
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Homing started");
+        LOG_INFO(Motion, "[Y-Axis] Homing started");
     }
     return ok;
 }
 
+void YAxis::updateFaultReset() {
+    if (_faultReset == FAULT_RESET_IDLE) return;
+    uint32_t now = ClearCore::TimingMgr.Milliseconds();
+    if (now - _faultResetMs < FAULT_RESET_SETTLE_MS) return;
+    _faultResetMs = now;
+
+    if (_faultReset == FAULT_RESET_DISABLED) {
+        _motor->EnableRequest(true);
+        _faultReset = FAULT_RESET_ENABLED;
+        return;
+    }
+    _faultReset = FAULT_RESET_IDLE;
+    _motor->ClearAlerts();
+    LOG_INFO(Motion, "[Y-Axis] Fault reset, alerts cleared");
+    if (_homePending) {
+        _homePending = false;
+        beginHoming();
+    }
+}
+
 void YAxis::PauseTorqueControlledFeed() {
     if (_dynamicFeed->isActive()) {
         // Store current position and feed rate, then pause the feed
-        ClearCore::ConnectorUsb.SendLine("[YAxis] Pausing torque-controlled feed");
+        LOG_INFO(Feed, "[YAxis] Pausing torque-controlled feed");
         
         // Tell the dynamic feed controller to pause
         _dynamicFeed->pause();
@@ -107,7 +148,7 @@ void YAxis::PauseTorqueControlledFeed() {
 void YAxis::ResumeTorqueControlledFeed() {
     if (_dynamicFeed->isActive() && _dynamicFeed->isPaused()) {
         // Resume the feed using the stored feed rate
-        ClearCore::ConnectorUsb.SendLine("[YAxis] Resuming torque-controlled feed");
+        LOG_INFO(Feed, "[YAxis] Resuming torque-controlled feed");
         
         // Tell the dynamic feed controller to resume (it will restore the feed rate and direction)
         _dynamicFeed->resume();
@@ -122,66 +163,66 @@ void YAxis::Update() {
     _currentPos = static_cast<float>(_motor->PositionRefCommanded()) / _stepsPerInch;
     _isMoving = !_motor->StepsComplete();
     _torquePct = _dynamicFeed->updateTorqueMeasurement();
+    updateFaultReset();
 
     // --- DEBUG: Log torque and feed state for troubleshooting ---
-#ifdef YAXIS_FEED_DEBUG_LOG
     static uint32_t lastDebugLog = 0;
     uint32_t now = ClearCore::TimingMgr.Milliseconds();
-    if (now - lastDebugLog > 500) {
+    if (LOG_ENABLED(Feed, Debug) && now - lastDebugLog > 500) {
         lastDebugLog = now;
-        ClearCore::ConnectorUsb.Send("[Y-Axis][DEBUG] inTorqueControlFeed: ");
-        ClearCore::ConnectorUsb.Send(IsInTorqueControlledFeed() ? "true" : "false");
-        ClearCore::ConnectorUsb.Send(", isMoving: ");
-        ClearCore::ConnectorUsb.Send(_isMoving ? "true" : "false");
-        ClearCore::ConnectorUsb.Send(", torquePct: ");
-        ClearCore::ConnectorUsb.Send(_torquePct, 1);
-        ClearCore::ConnectorUsb.Send(", torqueTarget: ");
-        ClearCore::ConnectorUsb.Send(GetTorqueTarget(), 1);
-        ClearCore::ConnectorUsb.Send(", feedRate: ");
-        ClearCore::ConnectorUsb.Send(DebugGetCurrentFeedRate() * 100.0f, 1);
-        ClearCore::ConnectorUsb.SendLine("%");
+        LOG_DEBUG(Feed, "[Y-Axis][DEBUG] inTorqueControlFeed: ", IsInTorqueControlledFeed(),
+            ", isMoving: ", _isMoving,
+            ", torquePct: ", Log::fixed(_torquePct, 1),
+            ", torqueTarget: ", Log::fixed(GetTorqueTarget(), 1),
+            ", feedRate: ", Log::fixed(DebugGetCurrentFeedRate() * 100.0f, 1), "%");
     }
-#endif // YAXIS_FEED_DEBUG_LOG
     // ------------------------------------------------------------
 
-    // Check if we're in torque-controlled feed mode
-    if (IsInTorqueControlledFeed()) {
-        // Let dynamic feed module handle updates and check for completion
-        if (_dynamicFeed->update(_currentPos)) {
-            Stop();
-        }
+    // Let dynamic feed module handle updates and check for completion.
+    // It is ticked even when idle so deferred acceleration restores finish.
+    bool wasFeeding = IsInTorqueControlledFeed();
+    if (_dynamicFeed->update(_currentPos)) {
+        Stop();
+    }
+    if (wasFeeding) {
         return;
     }
 
+    // Queued moves
+    _queue.update();
+    _isMoving = IsMoving();
+
     // Homing state
     if (_homingHelper->isBusy()) {
         _homingHelper->process();
     }
-    else if (!_isHomed && !_homingHelper->hasFailed()) {
+    else if (!_isHomed && !_homePending && !_homingHelper->hasFailed()) {
         _isHomed = true;
         _hasBeenHomed = true;
         EncoderPositionTracker::Instance().resetPositionAfterHoming();
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Homing complete, encoder position reset");
+        LOG_INFO(Motion, "[Y-Axis] Homing complete, encoder position reset");
     }
 }
 
 bool YAxis::MoveTo(float positionInches, float velocityScale) {
     if (!_isSetup) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] MoveTo failed: not setup");
+        LOG_WARN(Motion, "[Y-Axis] MoveTo failed: not setup");
         return false;
     }
-    if (_homingHelper->isBusy()) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] MoveTo failed: homing in progress");
+    if (IsHoming()) {
+        LOG_WARN(Motion, "[Y-Axis] MoveTo failed: homing in progress");
         return false;
     }
     if (!_hasBeenHomed) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] MoveTo failed: axis not homed yet");
+        LOG_WARN(Motion, "[Y-Axis] MoveTo failed: axis not homed yet");
         return false;
     }
+    // A direct move replaces anything queued
+    _queue.clear();
 
     float desired = positionInches;
     if (desired < 0.0f || desired > MAX_Y_INCHES) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Soft limit reached, stopping");
+        LOG_WARN(Motion, "[Y-Axis] Soft limit reached, stopping");
         _motor->MoveStopAbrupt();
         _isMoving = false;
         return false;
@@ -196,13 +237,44 @@ bool YAxis::MoveTo(float positionInches, float velocityScale) {
     if (delta == 0) return true;
 
     _motor->VelMax(static_cast<uint32_t>(MAX_VELOCITY * velocityScale));
-    ClearCore::ConnectorUsb.Send("[Y-Axis] MoveTo: ");
-    ClearCore::ConnectorUsb.Send(_targetPos);
-    ClearCore::ConnectorUsb.SendLine(" inches");
+    LOG_INFO(Motion, "[Y-Axis] MoveTo: ", _targetPos, " inches");
     return _motor->Move(delta);
 }
 
+bool YAxis::JogVelocity(float inchesPerSec) {
+    if (!_isSetup || IsHoming() || !_hasBeenHomed) return false;
+    if (IsInTorqueControlledFeed()) return false;
+    _queue.clear();
+    if ((inchesPerSec > 0.0f && _currentPos >= MAX_Y_INCHES) ||
+        (inchesPerSec < 0.0f && _currentPos <= 0.0f)) {
+        inchesPerSec = 0.0f;
+    }
+    float vel = inchesPerSec * _stepsPerInch;
+    if (vel > MAX_VELOCITY) vel = MAX_VELOCITY;
+    else if (vel < -MAX_VELOCITY) vel = -MAX_VELOCITY;
+    return _motor->MoveVelocity(static_cast<int32_t>(vel));
+}
+
+uint16_t YAxis::Enqueue(float positionInches, float velocityScale, bool blend) {
+    if (!_isSetup || IsHoming() || !_hasBeenHomed) {
+        LOG_WARN(Motion, "[Y-Axis] Enqueue refused: not setup, homing or not homed");
+        return 0;
+    }
+    if (IsInTorqueControlledFeed()) {
+        LOG_WARN(Motion, "[Y-Axis] Enqueue refused: torque feed active");
+        return 0;
+    }
+    if (positionInches < 0.0f || positionInches > MAX_Y_INCHES) {
+        LOG_WARN(Motion, "[Y-Axis] Enqueue refused: ", positionInches, " outside soft limits");
+        return 0;
+    }
+    uint16_t id = _queue.push(static_cast<int32_t>(positionInches * _stepsPerInch), velocityScale, blend);
+    if (!id) LOG_WARN(Motion, "[Y-Axis] Enqueue refused: queue full");
+    return id;
+}
+
 void YAxis::Stop() {
+    _queue.clear();
     if (_isMoving) {
         _motor->MoveStopDecel();
         _isMoving = false;
@@ -210,11 +282,14 @@ void YAxis::Stop() {
 }
 
 void YAxis::EmergencyStop() {
+    // Abort any dynamic feed first so the torque loop stops commanding
+    // velocity before the hard stop
+    AbortTorqueControlledFeed();
+
+    _homePending = false;
+    _queue.clear();
     _motor->MoveStopAbrupt();
     _isMoving = false;
-    
-    // Make sure to abort any dynamic feed operations
-    AbortTorqueControlledFeed();
 }
 
 float YAxis::GetPosition() const {
@@ -235,18 +310,20 @@ float YAxis::GetTorqueTarget() const {
 
 bool YAxis::StartTorqueControlledFeed(float targetPosition, float initialVelocityScale) {
     if (!_isSetup) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Cannot start torque feed: not setup");
+        LOG_WARN(Feed, "[Y-Axis] Cannot start torque feed: not setup");
         return false;
     }
-    if (_homingHelper->isBusy()) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Cannot start torque feed: homing in progress");
+    if (IsHoming()) {
+        LOG_WARN(Feed, "[Y-Axis] Cannot start torque feed: homing in progress");
         return false;
     }
     if (!_hasBeenHomed) {
-        ClearCore::ConnectorUsb.SendLine("[Y-Axis] Cannot start torque feed: axis not homed");
+        LOG_WARN(Feed, "[Y-Axis] Cannot start torque feed: axis not homed");
         return false;
     }
 
+    // The feed drives the motor itself
+    _queue.clear();
     _isMoving = true;
     return _dynamicFeed->start(targetPosition, initialVelocityScale);
 }
@@ -280,6 +357,6 @@ bool YAxis::DebugIsInTorqueControlFeed() const {
     return _dynamicFeed->isActive();
 }
 
-bool YAxis::IsMoving() const { return !_motor->StepsComplete(); }
+bool YAxis::IsMoving() const { return !_motor->StepsComplete() || !_queue.empty(); }
 bool YAxis::IsHomed()  const { return _isHomed; }
-bool YAxis::IsHoming() const { return _homingHelper->isBusy(); }
+bool YAxis::IsHoming() const { return _homingHelper->isBusy() || _homePending; }
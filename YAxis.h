@@ -2,6 +2,7 @@
 
 #include <ClearCore.h>
 #include "HomingHelper.h"
+#include "MotionQueue.h"
 
 // Forward declaration
 class DynamicFeed;
@@ -25,6 +26,18 @@ public:
     void Stop();
     void EmergencyStop();
 
+    // Velocity command for the MPG follower (inches/s, signed). Called every
+    // motion tick, so refusals are silent; stops at the soft limits.
+    bool JogVelocity(float inchesPerSec);
+
+    // Queued moves, fed back to back (see MotionQueue.h). Enqueue returns
+    // the segment id, 0 if refused. MoveTo, Stop and homing clear the queue.
+    uint16_t Enqueue(float positionInches, float velocityScale, bool blend);
+    uint8_t QueueDepth() const { return _queue.depth(); }
+    uint8_t QueueFree() const { return _queue.freeSlots(); }
+    bool IsSegmentDone(uint16_t id) const { return _queue.isDone(id); }
+    void ClearQueue() { _queue.clear(); }
+
     // Status queries
     float GetPosition() const;        // Inches
     float GetTorquePercent() const;   // % estimated torque (filtered value)
@@ -62,6 +75,7 @@ private:
     float   _targetPos = 0.0f;    // Inches
     const float _stepsPerInch;
     MotorDriver* const _motor;    // Pointer to ClearCore motor driver
+    MotionQueue _queue;
 
     // Homing parameters
     static constexpr float HOMING_BACKOFF_INCH = 0.125f;
@@ -72,6 +86,21 @@ private:
     // Homing helper
     HomingHelper* _homingHelper;
     bool _hasBeenHomed = false;    // gets flipped true when homing succeeds
+    bool _homePending = false;     // StartHoming() waiting on a fault reset
+
+    // Motor fault reset: enable is cycled with a settle time each way,
+    // stepped from Update() rather than blocking the loop
+    enum FaultResetStep {
+        FAULT_RESET_IDLE,
+        FAULT_RESET_DISABLED,   // Enable dropped, waiting to re-enable
+        FAULT_RESET_ENABLED     // Re-enabled, waiting to clear alerts
+    };
+    static constexpr uint32_t FAULT_RESET_SETTLE_MS = 100;
+    FaultResetStep _faultReset = FAULT_RESET_IDLE;
+    uint32_t _faultResetMs = 0;
+
+    void updateFaultReset();
+    bool beginHoming();
 
     // Dynamic feed controller (handles torque-controlled feed)
     DynamicFeed* _dynamicFeed;
@@ -178,6 +178,42 @@
 #define DISPLAY_TIMEOUT         3000
 #define AUTO_PING_CYCLE         1250
 
+// Asynchronous send path. Writes never wait for the display; frames are
+// queued and DoEvents() sends the next one once the previous one is ACKed,
+// NAKed or has timed out.
+#define GENIE_ACK_TIMEOUT       500     // ms a sent frame may wait for its ACK
+#define GENIE_TX_RETRIES        1       // resends of a priority frame that was NAKed or timed out
+#define GENIE_MAGIC_TIMEOUT     100     // ms for a magic report to arrive in full
+#define GENIE_PRIORITY_FRAMES   8       // MUST be a power of 2
+#define GENIE_LONG_BUFFER       512     // MUST be a power of 2, bytes of queued string/magic frames
+
+// Outcome of a sent frame (GetTxStatus, AttachTxCompleteHandler)
+#define GENIE_TX_IDLE           0
+#define GENIE_TX_ACKED          1
+#define GENIE_TX_NAKED          2
+#define GENIE_TX_TIMEOUT        3
+#define GENIE_TX_OFFLINE        4
+
+// High-baud negotiation (ViSi-Genie Pro). ViSi-Genie has no baud command, so the
+// request goes to a magic object whose handler calls com_SetBaud(). Its payload
+// is an op byte and the baud, MSB first:
+//   'B' - ACK at the current rate, then switch
+//   'C' - commit; without it within GENIE_BAUD_COMMIT_MS of the switch the
+//         display goes back to the rate it booted at
+// The library switches the host UART through the setter after the ACK, pings
+// at the new rate and commits on the reply, or falls back if none comes.
+#define GENIE_BAUD_SETTLE_MS    20      // ms after the ACK before talking at the new rate
+#define GENIE_BAUD_VERIFY_MS    250     // ms for the new rate to answer the ping
+#define GENIE_BAUD_COMMIT_MS    1000    // display-side revert timeout, for the magic handler
+
+#define GENIE_BAUD_IDLE         0
+#define GENIE_BAUD_REQUESTED    1
+#define GENIE_BAUD_SETTLING     2
+#define GENIE_BAUD_VERIFYING    3
+#define GENIE_BAUD_COMMITTING   4
+#define GENIE_BAUD_ACTIVE       5
+#define GENIE_BAUD_FAILED       6
+
 
 // Structure to store replys returned from a display
 
@@ -233,6 +269,25 @@ struct EventQueueStruct {
 typedef void  (*UserEventHandlerPtr) (void);
 typedef void  (*UserBytePtr)(uint8_t, uint8_t);
 typedef void  (*UserDoubleBytePtr)(uint8_t, uint8_t);
+// cmd, object, index, GENIE_TX_* status. String and magic writes report
+// object 0 and their string/magic index as index.
+typedef void  (*UserTxCompletePtr)(uint8_t, uint8_t, uint8_t, uint8_t);
+typedef void  (*UserBaudSetPtr)(uint32_t);
+
+// Coalescing keys for the frame queues; a queued frame with the same key is
+// updated in place rather than queued again. Outgoing frames are
+// currentForm, cmd, object, index, ...: form changes match on any form and
+// contrast writes on the command alone.
+inline uint32_t genie_tx_key(const uint8_t *frame) {
+  if ( frame[1] == GENIE_WRITE_CONTRAST ) return (uint32_t)frame[1] << 16;
+  if ( frame[2] == GENIE_OBJ_FORM ) return (uint32_t)frame[1] << 16 | (uint32_t)frame[2] << 8;
+  return (uint32_t)frame[1] << 16 | (uint32_t)frame[2] << 8 | frame[3];
+}
+
+// Incoming events are cmd, object, index, ...
+inline uint32_t genie_rx_key(const uint8_t *frame) {
+  return (uint32_t)frame[0] << 16 | (uint32_t)frame[1] << 8 | frame[2];
+}
 
 /////////////////////////////////////////////////////////////////////
 // User API functions
@@ -240,8 +295,8 @@ typedef void  (*UserDoubleBytePtr)(uint8_t, uint8_t);
 //
 class Genie {
   public:
-    Genie_Buffer < uint8_t, (uint32_t)MAX_GENIE_EVENTS, 6 > _incomming_queue; /* currentForm, cmd, object, index, data1, data2 */
-    Genie_Buffer < uint8_t, (uint32_t)MAX_GENIE_EVENTS, 7 > _outgoing_queue; /* currentForm, cmd, object, index, data1, data2, crc */
+    Genie_Keyed_Buffer < uint8_t, (uint32_t)MAX_GENIE_EVENTS, 6, genie_rx_key > _incomming_queue; /* currentForm, cmd, object, index, data1, data2 */
+    Genie_Keyed_Buffer < uint8_t, (uint32_t)MAX_GENIE_EVENTS, 7, genie_tx_key > _outgoing_queue; /* currentForm, cmd, object, index, data1, data2, crc */
     Genie                                     ();
 #if defined(GENIE_SS_SUPPORT)
     bool          Begin                       (SoftwareSerial &serial);
@@ -299,6 +354,15 @@ class Genie {
     void          AttachMagicByteReader       (UserBytePtr userHandler);
     void          AttachMagicDoubleByteReader (UserDoubleBytePtr userHandler);
     uint32_t      GetUptime                   ();
+    void          AttachTxCompleteHandler     (UserTxCompletePtr userHandler);
+    bool          IsIdle                      ();
+    uint8_t       GetTxStatus                 ();
+    uint32_t      GetTxTimeouts               ();
+    uint32_t      GetTxFrames                 ();
+    uint16_t      GetTxPending                ();
+    void          NegotiateBaud               (uint32_t baseBaud, uint32_t fastBaud, uint8_t magicIndex, UserBaudSetPtr setBaud);
+    uint32_t      GetBaud                     ();
+    uint8_t       GetBaudState                ();
 
     // Genie Magic functions (ViSi-Genie Pro Only)
 
@@ -321,10 +385,22 @@ class Genie {
     UserEventHandlerPtr UserHandler;
     UserBytePtr UserByteReader;
     UserDoubleBytePtr UserDoubleByteReader;
+    UserTxCompletePtr UserTxHandler;
+    UserBaudSetPtr UserBaudSetter;
+
+    Genie_Keyed_Buffer < uint8_t, (uint32_t)GENIE_PRIORITY_FRAMES, 7, genie_tx_key > _priority_queue; /* forms and handler writes, sent ahead of _outgoing_queue */
+    Genie_Buffer < uint8_t, (uint32_t)GENIE_LONG_BUFFER > _long_queue; /* length (2 bytes) + frame, for strings and magic writes */
 
     bool          WriteObjectPriority         (uint8_t object, uint8_t index, uint16_t data);
     void          writeMode                   (uint8_t *bytes, uint8_t len);
     bool          Begin_common                ();
+    bool          queue_long                  (const uint8_t *bytes, uint16_t len);
+    void          tx_complete                 (uint8_t status);
+    bool          magic_processing            ();
+    void          baud_processing             ();
+    void          baud_send                   (uint8_t op);
+    void          baud_set                    (uint32_t baud);
+    void          baud_fallback               ();
 
     // used internally by the library, do not modify!
     bool          pendingACK = 0;
@@ -348,6 +424,28 @@ class Genie {
     bool          handler_response_request = 0;
     uint8_t       handler_response_values[6];
     uint8_t       magic_overpull_count = 0;
+    uint8_t       magic_pending = 0; /* report cmd whose payload is still arriving */
+    uint8_t       magic_header[3];
+    uint32_t      magic_timer = 0;
+    uint16_t      rx_discard = 0; /* unread magic payload/checksum bytes to drop */
+    uint8_t       tx_frame[7]; /* frame awaiting ACK: currentForm, cmd, object, index, ... */
+    bool          tx_from_priority = 0;
+    bool          tx_retrying = 0;
+    uint8_t       tx_retries_left = 0;
+    uint8_t       tx_status = GENIE_TX_IDLE;
+    uint32_t      tx_timeouts = 0;
+    bool          tx_handler_active = 0;
+    int16_t       offline_form = -1; /* form requested while offline, shown once detected */
+    uint32_t      begin_time = 0;
+    uint32_t      tx_frames = 0;
+    uint16_t      long_frames = 0; /* frames in _long_queue */
+    uint32_t      baud_base = 0;
+    uint32_t      baud_fast = 0;
+    uint32_t      baud_current = 0;
+    uint8_t       baud_magic_index = 0;
+    uint8_t       baud_state = GENIE_BAUD_IDLE;
+    bool          baud_recommit = 0;
+    uint32_t      baud_timer = 0;
     uint16_t      tx_delay = 0;
     genieFrame    event_frame;
     friend class  GenieObject;
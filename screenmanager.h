@@ -35,6 +35,11 @@ public:
     void ShowSetupAutocut();  // NEW
     void Back();
 
+    /// Send the current form and its starting state again, e.g. after the
+    /// display has (re)connected with everything at its power-up state.
+    /// The screen stays active; readouts catch up on its next update()
+    void Redraw();
+
     void clearAllLeds();
     JogXScreen& GetJogXScreen() { return _jogXScreen; }
     JogYScreen& GetJogYScreen() { return _jogYScreen; }
@@ -45,6 +50,7 @@ public:
 private:
     ScreenManager();
     void writeForm(uint8_t formId);
+    void drawCurrentForm(bool entering);
 
     uint8_t _currentForm = 255;
     uint8_t _lastForm = FORM_MANUAL_MODE;
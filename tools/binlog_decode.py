@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Decode the Autosaw USB stream: BinLog frames back to text.
+
+The firmware mixes plain-text lines with binary BinLog frames on the same
+USB serial port. This tool passes text through unchanged and formats each
+frame with its entry from LogMessages.h.
+
+    python3 tools/binlog_decode.py --port /dev/ttyACM0      (needs pyserial)
+    python3 tools/binlog_decode.py capture.bin
+    cat capture.bin | python3 tools/binlog_decode.py
+
+Frame layout (see BinLog.h):
+    0xA5, len, timestamp_us:u32, id:u16, args..., checksum
+    len counts timestamp + id + args; checksum = ~sum(those bytes) & 0xFF
+    each arg is a type byte: 'i' i32, 'u' u32, 'f' f32, 'b' u8, 's' len+chars
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+DEFAULT_CATALOG = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "LogMessages.h")
+
+
+def load_catalog(path):
+    """Message table indexed by ID, in LogMessages.h order."""
+    pattern = re.compile(r'^\s*LOG_MESSAGE\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+    table = []
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            m = pattern.match(line)
+            if m:
+                table.append((m.group(1), m.group(2)))
+    return table
+
+
+def parse_args(data):
+    """Decode the typed argument list; None if it doesn't parse exactly."""
+    args = []
+    i = 0
+    while i < len(data):
+        t = chr(data[i])
+        i += 1
+        if t in "iuf":
+            if i + 4 > len(data):
+                return None
+            fmt = {"i": "<i", "u": "<I", "f": "<f"}[t]
+            args.append(struct.unpack_from(fmt, data, i)[0])
+            i += 4
+        elif t == "b":
+            if i + 1 > len(data):
+                return None
+            args.append(bool(data[i]))
+            i += 1
+        elif t == "s":
+            if i + 1 > len(data):
+                return None
+            n = data[i]
+            i += 1
+            if i + n > len(data):
+                return None
+            args.append(data[i:i + n].decode("ascii", errors="replace"))
+            i += n
+        else:
+            return None
+    return args
+
+
+def format_record(table, ts_us, msg_id, args):
+    if msg_id >= len(table):
+        return "[{:12.6f}] <unknown id {}> {}".format(ts_us / 1e6, msg_id, args)
+    name, text = table[msg_id]
+    try:
+        body = text.format(*args)
+    except (IndexError, ValueError):
+        body = "{} {}".format(text, args)
+    return "[{:12.6f}] {}".format(ts_us / 1e6, body)
+
+
+class Decoder:
+    """Incremental decoder: feed() bytes, get back finished output lines."""
+
+    def __init__(self, table, show_text=True):
+        self.table = table
+        self.show_text = show_text
+        self.buf = bytearray()
+        self.text = bytearray()
+        self.frames = 0
+        self.bad_frames = 0
+
+    def feed(self, chunk):
+        self.buf.extend(chunk)
+        out = []
+        while self.buf:
+            b = self.buf[0]
+            if b != SYNC:
+                del self.buf[0]
+                if b == 0x0A:
+                    if self.show_text:
+                        out.append(self.text.decode("ascii", errors="replace").rstrip("\r"))
+                    self.text.clear()
+                else:
+                    self.text.append(b)
+                continue
+
+            if len(self.buf) < 2:
+                break
+            length = self.buf[1]
+            total = length + 3
+            if len(self.buf) < total:
+                break
+
+            payload = bytes(self.buf[2:2 + length])
+            checksum = self.buf[2 + length]
+            args = None
+            if length >= 6 and (~sum(payload)) & 0xFF == checksum:
+                args = parse_args(payload[6:])
+
+            if args is None:
+                # Not a frame after all - treat the byte as text and resync
+                self.bad_frames += 1
+                del self.buf[0]
+                continue
+
+            ts_us, msg_id = struct.unpack_from("<IH", payload, 0)
+            out.append(format_record(self.table, ts_us, msg_id, args))
+            self.frames += 1
+            del self.buf[:total]
+        return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", nargs="?", help="capture file (default: stdin)")
+    parser.add_argument("--port", help="read live from a serial port instead")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--catalog", default=DEFAULT_CATALOG, help="path to LogMessages.h")
+    parser.add_argument("--frames-only", action="store_true", help="hide plain-text lines")
+    opts = parser.parse_args()
+
+    table = load_catalog(opts.catalog)
+    decoder = Decoder(table, show_text=not opts.frames_only)
+
+    if opts.port:
+        import serial  # pyserial
+        src = serial.Serial(opts.port, opts.baud, timeout=0.1)
+        read = lambda: src.read(4096)
+        live = True
+    else:
+        src = open(opts.input, "rb") if opts.input else sys.stdin.buffer
+        read = lambda: src.read(4096)
+        live = False
+
+    try:
+        while True:
+            chunk = read()
+            if not chunk:
+                if live:
+                    continue
+                break
+            for line in decoder.feed(chunk):
+                print(line, flush=live)
+    except KeyboardInterrupt:
+        pass
+
+    if decoder.text and decoder.show_text:
+        print(decoder.text.decode("ascii", errors="replace"))
+
+    if decoder.bad_frames:
+        print("# {} frames decoded, {} bad sync bytes skipped".format(decoder.frames, decoder.bad_frames), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Convert CutRecorder captures (/CUTnnnn.BIN on the SD card) to CSV.
+
+    python3 tools/cutrec_to_csv.py CUT0001.BIN              (writes CUT0001.csv)
+    python3 tools/cutrec_to_csv.py CUT*.BIN --out-dir csv/
+    python3 tools/cutrec_to_csv.py CUT0001.BIN --stdout
+
+File layout (see CutRecorder.h), little-endian:
+    header  magic "ACUT", version u16, sample_bytes u16, period_us u32,
+            count u32, trigger_index u32, cut_start_ms u32, reason u8, 3 pad,
+            start_pos f32, target_pos f32, max_feed_rate f32
+    sample  y i32 (1e-5 in), torque i16, smoothed i16, target i16,
+            feed_rate u16, spindle_load i16 (all 0.01 %), flags u16
+
+Time is in seconds relative to the trigger sample, so negative rows are the
+pre-trigger history.
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+
+HEADER = struct.Struct("<4sHHIIIIB3xfff")
+SAMPLE = struct.Struct("<ihhhHhH")
+FLAG_TRIGGER = 0x0001
+REASONS = {0: "none", 1: "torque_spike", 2: "abort", 3: "feed_hold", 4: "manual"}
+COLUMNS = ["time_s", "y_in", "torque_pct", "smoothed_torque_pct", "torque_target_pct",
+           "feed_rate_pct", "spindle_load_pct", "trigger"]
+
+
+def read_capture(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        raise ValueError("{}: too short for a header".format(path))
+
+    (magic, version, sample_bytes, period_us, count, trigger_index, cut_start_ms,
+     reason, start_pos, target_pos, max_feed) = HEADER.unpack_from(data, 0)
+    if magic != b"ACUT":
+        raise ValueError("{}: not a cut recorder file".format(path))
+    if version != 1 or sample_bytes != SAMPLE.size:
+        raise ValueError("{}: unsupported format version {} / {} byte samples".format(
+            path, version, sample_bytes))
+
+    available = (len(data) - HEADER.size) // SAMPLE.size
+    if available < count:
+        print("# {}: truncated, {} of {} samples".format(path, available, count), file=sys.stderr)
+        count = available
+
+    header = {
+        "period_us": period_us,
+        "count": count,
+        "trigger_index": trigger_index,
+        "cut_start_ms": cut_start_ms,
+        "reason": REASONS.get(reason, str(reason)),
+        "start_pos": start_pos,
+        "target_pos": target_pos,
+        "max_feed_rate": max_feed,
+    }
+
+    rows = []
+    for i in range(count):
+        y, tq, sm, tgt, feed, load, flags = SAMPLE.unpack_from(data, HEADER.size + i * SAMPLE.size)
+        rows.append([
+            "{:.3f}".format((i - trigger_index) * period_us / 1e6),
+            "{:.5f}".format(y / 1e5),
+            "{:.2f}".format(tq / 100.0),
+            "{:.2f}".format(sm / 100.0),
+            "{:.2f}".format(tgt / 100.0),
+            "{:.2f}".format(feed / 100.0),
+            "{:.2f}".format(load / 100.0),
+            1 if flags & FLAG_TRIGGER else 0,
+        ])
+    return header, rows
+
+
+def write_csv(out, header, rows):
+    out.write("# trigger={reason} period_us={period_us} start_in={start_pos:.4f} "
+              "target_in={target_pos:.4f} max_feed={max_feed_rate:.3f}\n".format(**header))
+    writer = csv.writer(out, lineterminator="\n")
+    writer.writerow(COLUMNS)
+    writer.writerows(rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("files", nargs="+", help="CUTnnnn.BIN files copied off the SD card")
+    parser.add_argument("--out-dir", help="directory for the CSV files (default: next to each input)")
+    parser.add_argument("--stdout", action="store_true", help="write CSV to stdout instead")
+    opts = parser.parse_args()
+
+    status = 0
+    for path in opts.files:
+        try:
+            header, rows = read_capture(path)
+        except (OSError, ValueError) as e:
+            print("error: {}".format(e), file=sys.stderr)
+            status = 1
+            continue
+
+        if opts.stdout:
+            write_csv(sys.stdout, header, rows)
+            continue
+
+        base = os.path.splitext(os.path.basename(path))[0] + ".csv"
+        out_path = os.path.join(opts.out_dir or os.path.dirname(path), base)
+        with open(out_path, "w", newline="") as out:
+            write_csv(out, header, rows)
+        print("{} -> {} ({} samples, {})".format(path, out_path, len(rows), header["reason"]))
+
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,214 @@
+// cut_planner_test.cpp - host test of CutPlanner: the sweep it picks, the
+// stock-end constraint, repeated positions and the saving it reports.
+//
+//   g++ -std=gnu++11 -Itools/cutseq_sim -I. tools/cutseq_sim/cut_planner_test.cpp
+//       CutPlanner.cpp MoveProfile.cpp -o cut_planner_test && ./cut_planner_test
+//
+// Times come from the real fence profile (MoveProfile, Config.h limits), so
+// the checks compare plans against each other and against fenceMoveMs()
+// rather than against fixed millisecond values.
+
+#include "CutPlanner.h"
+#include "Config.h"
+#include <math.h>
+#include <stdio.h>
+
+ClearCore::SerialUsb ClearCore::ConnectorUsb;
+ClearCore::SysTiming ClearCore::TimingMgr;
+
+static int failures = 0;
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static CutPlanner::Cut cuts[kMaxCuts];
+
+static int load(const float* xs, int count) {
+    for (int i = 0; i < count; i++) {
+        cuts[i].x = xs[i];
+        cuts[i].yStop = 1.0f + i;
+    }
+    return count;
+}
+
+static CutPlanner::Options from(float startX) {
+    CutPlanner::Options o;
+    o.startX = startX;
+    return o;
+}
+
+static float xAt(const CutPlanner::Plan& p, int i) { return cuts[p.order[i]].x; }
+
+// Every input index exactly once, and X monotonic in the given direction
+static bool isSweep(const CutPlanner::Plan& p, int count, int dir) {
+    bool seen[kMaxCuts] = {};
+    for (int i = 0; i < p.count; i++) {
+        if (p.order[i] >= count || seen[p.order[i]]) return false;
+        seen[p.order[i]] = true;
+        if (i > 0 && (xAt(p, i) - xAt(p, i - 1)) * dir < 0.0f) return false;
+    }
+    return p.count == count;
+}
+
+static void print(const char* name, const CutPlanner::Plan& p) {
+    printf("%-22s", name);
+    for (int i = 0; i < p.count; i++) printf(" %.2f", xAt(p, i));
+    printf("  | %.2f in, %u rev, %lu ms; as entered %.2f in, %u rev, %lu ms; saved %ld ms\n",
+        p.travel, p.reversals, static_cast<unsigned long>(p.fenceMs),
+        p.naiveTravel, p.naiveReversals, static_cast<unsigned long>(p.naiveFenceMs),
+        static_cast<long>(p.savedMs()));
+}
+
+// Fence below the list: one sweep up, no reversal
+static void testStartBelow() {
+    const float xs[] = { 3.0f, 1.0f, 4.0f, 2.0f };
+    int n = load(xs, 4);
+    CutPlanner::Plan p;
+    CHECK(CutPlanner::plan(cuts, n, from(0.0f), p));
+    print("start below", p);
+    CHECK(isSweep(p, n, 1));
+    CHECK(p.reversals == 0);
+    CHECK(fabsf(p.travel - 4.0f) < 1e-4f);
+    CHECK(p.fenceMs == 4 * CutPlanner::fenceMoveMs(1.0f));
+}
+
+// Fence above the list: one sweep down
+static void testStartAbove() {
+    const float xs[] = { 3.0f, 1.0f, 4.0f, 2.0f };
+    int n = load(xs, 4);
+    CutPlanner::Plan p;
+    CHECK(CutPlanner::plan(cuts, n, from(6.0f), p));
+    print("start above", p);
+    CHECK(isSweep(p, n, -1));
+    CHECK(p.reversals == 0);
+    CHECK(fabsf(p.travel - 5.0f) < 1e-4f);
+}
+
+// Fence inside the list: out to the nearer end first, one reversal
+static void testStartInside() {
+    const float xs[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+    int n = load(xs, 6);
+    CutPlanner::Plan p;
+
+    CHECK(CutPlanner::plan(cuts, n, from(5.2f), p));
+    print("inside, near top", p);
+    CHECK(isSweep(p, n, -1));
+    CHECK(p.reversals == 1);
+    CHECK(fabsf(p.travel - (0.8f + 5.0f)) < 1e-4f);
+
+    CHECK(CutPlanner::plan(cuts, n, from(1.7f), p));
+    print("inside, near bottom", p);
+    CHECK(isSweep(p, n, 1));
+    CHECK(p.reversals == 1);
+    CHECK(fabsf(p.travel - (0.7f + 5.0f)) < 1e-4f);
+}
+
+// Stock end first overrides the quicker sweep
+static void testStockEndFirst() {
+    const float xs[] = { 2.0f, 3.0f, 4.0f, 5.0f };
+    int n = load(xs, 4);
+    CutPlanner::Plan free;
+    CHECK(CutPlanner::plan(cuts, n, from(0.0f), free));
+    CHECK(isSweep(free, n, 1));
+
+    CutPlanner::Options o = from(0.0f);
+    o.constraint = CutPlanner::ORDER_STOCK_END_FIRST;
+    o.stockEndX = 6.0f;
+    CutPlanner::Plan p;
+    CHECK(CutPlanner::plan(cuts, n, o, p));
+    print("stock end at 6", p);
+    CHECK(isSweep(p, n, -1));
+    CHECK(xAt(p, 0) == 5.0f);
+    CHECK(p.fenceMs > free.fenceMs);
+
+    // Stock end on the near side: the same sweep as unconstrained
+    o.stockEndX = 1.5f;
+    CHECK(CutPlanner::plan(cuts, n, o, p));
+    print("stock end at 1.5", p);
+    CHECK(isSweep(p, n, 1));
+    CHECK(p.fenceMs == free.fenceMs);
+}
+
+// Repeated positions: every cut is kept, the repeats cost no move or reversal
+static void testDuplicates() {
+    const float xs[] = { 2.0f, 3.0f, 2.0f, 1.0f, 3.0f, 2.0f };
+    int n = load(xs, 6);
+    CutPlanner::Plan p;
+    CHECK(CutPlanner::plan(cuts, n, from(0.0f), p));
+    print("repeated positions", p);
+    CHECK(isSweep(p, n, 1));
+    CHECK(p.reversals == 0);
+    CHECK(fabsf(p.travel - 3.0f) < 1e-4f);
+    CHECK(p.fenceMs == 3 * CutPlanner::fenceMoveMs(1.0f));
+
+    // Each cut keeps its own Y stop through the reorder
+    for (int i = 0; i < p.count; i++) {
+        CHECK(cuts[p.order[i]].yStop == 1.0f + p.order[i]);
+    }
+
+    // Starting on a repeated position
+    CHECK(CutPlanner::plan(cuts, n, from(2.0f), p));
+    CHECK(p.count == n);
+    CHECK(p.reversals == 1);
+}
+
+// The saving is the as-entered order priced the same way
+static void testSavedMs() {
+    const float xs[] = { 1.0f, 5.0f, 2.0f, 4.0f, 3.0f };
+    int n = load(xs, 5);
+    CutPlanner::Plan p;
+    CHECK(CutPlanner::plan(cuts, n, from(0.0f), p));
+    print("zig-zag", p);
+    CHECK(fabsf(p.naiveTravel - 11.0f) < 1e-4f);
+    CHECK(p.naiveReversals == 3);
+    uint32_t naive = CutPlanner::fenceMoveMs(1.0f) * 2 + CutPlanner::fenceMoveMs(4.0f)
+        + CutPlanner::fenceMoveMs(3.0f) + CutPlanner::fenceMoveMs(2.0f) + 3 * CUT_PLAN_REVERSAL_MS;
+    CHECK(p.naiveFenceMs == naive);
+    CHECK(p.savedMs() == static_cast<int32_t>(naive - p.fenceMs));
+    CHECK(p.savedMs() > 0);
+
+    // Already in sweep order: nothing to save
+    const float sorted[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+    n = load(sorted, 5);
+    CHECK(CutPlanner::plan(cuts, n, from(0.0f), p));
+    print("already sorted", p);
+    CHECK(p.savedMs() == 0);
+
+    // A constraint can cost time against the entered order: negative saving
+    const float nearFirst[] = { 1.0f, 2.0f, 3.0f };
+    n = load(nearFirst, 3);
+    CutPlanner::Options o = from(0.0f);
+    o.constraint = CutPlanner::ORDER_STOCK_END_FIRST;
+    o.stockEndX = 10.0f;
+    CHECK(CutPlanner::plan(cuts, n, o, p));
+    print("constraint costs", p);
+    CHECK(p.savedMs() < 0);
+}
+
+static void testBadInput() {
+    CutPlanner::Plan p;
+    CHECK(!CutPlanner::plan(cuts, 0, from(0.0f), p));
+    CHECK(!CutPlanner::plan(cuts, kMaxCuts + 1, from(0.0f), p));
+
+    // A full list still plans
+    for (int i = 0; i < kMaxCuts; i++) {
+        cuts[i].x = static_cast<float>((i * 37) % kMaxCuts) * 0.25f;
+    }
+    CHECK(CutPlanner::plan(cuts, kMaxCuts, from(0.0f), p));
+    CHECK(isSweep(p, kMaxCuts, 1));
+}
+
+int main() {
+    testStartBelow();
+    testStartAbove();
+    testStartInside();
+    testStockEndFirst();
+    testDuplicates();
+    testSavedMs();
+    testBadInput();
+
+    if (failures) {
+        printf("%d check(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
@@ -0,0 +1,297 @@
+// cutseq_pause_test.cpp - host test of CutSequenceController pause/resume,
+// strict and overlapped, against a simulated X/Y table.
+//
+//   g++ -std=gnu++11 -Itools/cutseq_sim -I. tools/cutseq_sim/cutseq_pause_test.cpp
+//       CutSequenceController.cpp CutPlanner.cpp MoveProfile.cpp
+//       -o cutseq_pause_test && ./cutseq_pause_test
+//
+// The real controller runs against a stand-in MotionController: each axis
+// keeps a queue of segments the way MotionQueue does, starts the next one
+// when the last has stopped, and moves at a fixed speed. Every move the
+// axis starts is counted, so a paused sequence that keeps issuing moves
+// shows up as a count that changes while paused.
+
+#include "CutSequenceController.h"
+#include "CycleTimeEstimator.h"
+#include <math.h>
+#include <stdio.h>
+#include <deque>
+#include <vector>
+
+ClearCore::SerialUsb ClearCore::ConnectorUsb;
+ClearCore::SysTiming ClearCore::TimingMgr;
+
+static int failures = 0;
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static const float TICK = 0.001f;           // Motion task period, s
+static const float RAPID_IPS = 4.0f;
+static const float FEED_IPS = 0.5f;
+
+// --- Simulated axis ---
+
+struct SimAxis {
+    struct Segment {
+        uint16_t id;
+        float target;
+    };
+
+    float pos = 0.0f;
+    bool moving = false;
+    float target = 0.0f;
+    float speed = RAPID_IPS;
+    uint16_t id = 0;            // Segment in flight, 0 for a direct move
+    std::deque<Segment> pending;
+    uint16_t nextId = 1;
+    uint16_t lastDone = 0;
+    uint16_t clearedThrough = 0;
+    int started = 0;            // Moves started, queued or direct
+    bool feeding = false;
+    bool feedPaused = false;
+
+    void start(float to, uint16_t segment, float ips) {
+        moving = true;
+        target = to;
+        id = segment;
+        speed = ips;
+        started++;
+    }
+
+    uint16_t push(float to) {
+        pending.push_back({ nextId, to });
+        return nextId++;
+    }
+
+    // MotionQueue::clear: the segment in flight finishes, the rest never start
+    void clear() {
+        if (!pending.empty()) clearedThrough = pending.back().id;
+        pending.clear();
+    }
+
+    // XAxis/YAxis::Stop: the queue is cleared, the segment in flight with it
+    void stop() {
+        if (moving && id) clearedThrough = id;
+        clear();
+        moving = false;
+        feeding = false;
+    }
+
+    void moveTo(float to, float ips) {
+        clear();
+        start(to, 0, ips);
+    }
+
+    bool busy() const { return moving || !pending.empty(); }
+
+    bool done(uint16_t segment) const {
+        return segment == 0 || segment <= lastDone || segment <= clearedThrough;
+    }
+
+    void tick() {
+        if (!moving && !pending.empty()) {
+            start(pending.front().target, pending.front().id, RAPID_IPS);
+            pending.pop_front();
+        }
+        if (!moving || (feeding && feedPaused)) return;
+
+        float stepIn = speed * TICK;
+        if (fabsf(target - pos) <= stepIn) {
+            pos = target;
+            moving = false;
+            feeding = false;
+            if (id) lastDone = id;
+        }
+        else {
+            pos += target > pos ? stepIn : -stepIn;
+        }
+    }
+};
+
+static SimAxis simX;
+static SimAxis simY;
+
+static SimAxis& sim(int axis) { return axis == AXIS_X ? simX : simY; }
+
+// --- Link seams: the parts of the firmware the controller calls ---
+
+MotionQueue::MotionQueue(MotorDriver* motor, float maxVelocity, float maxAcceleration, uint32_t jerkMax)
+    : _motor(motor), _maxVelocity(maxVelocity), _maxAcceleration(maxAcceleration), _jerkMax(jerkMax) {}
+Spindle::Spindle() {}
+XAxis::XAxis() : _stepsPerInch(0.0f), _motor(nullptr), _queue(nullptr, 0.0f, 0.0f, 0), _homingHelper(nullptr) {}
+XAxis::~XAxis() {}
+YAxis::YAxis() : _stepsPerInch(0.0f), _motor(nullptr), _queue(nullptr, 0.0f, 0.0f, 0), _homingHelper(nullptr), _dynamicFeed(nullptr) {}
+YAxis::~YAxis() {}
+ZAxis::ZAxis() : _stepsPerDeg(0.0f), _motor(nullptr) {}
+MotionController::MotionController() {}
+
+MotionController& MotionController::Instance() {
+    static MotionController inst;
+    return inst;
+}
+
+float MotionController::getAbsoluteAxisPosition(AxisId axis) const { return sim(axis).pos; }
+bool MotionController::isAxisMoving(AxisId axis) const { return sim(axis).busy(); }
+bool MotionController::moveTo(AxisId axis, float position, float) { sim(axis).moveTo(position, RAPID_IPS); return true; }
+uint16_t MotionController::enqueueMove(AxisId axis, float position, float, bool) { return sim(axis).push(position); }
+bool MotionController::isSegmentDone(AxisId axis, uint16_t id) const { return sim(axis).done(id); }
+void MotionController::clearQueue(AxisId axis) { sim(axis).clear(); }
+void MotionController::stopAxis(AxisId axis) { sim(axis).stop(); }
+void MotionController::setTorqueTarget(AxisId, float) {}
+
+bool MotionController::startTorqueControlledFeed(AxisId axis, float target, float) {
+    sim(axis).moveTo(target, FEED_IPS);
+    sim(axis).feeding = true;
+    sim(axis).feedPaused = false;
+    return true;
+}
+
+bool MotionController::isInTorqueControlledFeed(AxisId axis) const { return sim(axis).feeding; }
+void MotionController::abortTorqueControlledFeed(AxisId axis) { sim(axis).stop(); }
+void MotionController::pauseTorqueControlledFeed(int axis) { sim(axis).feedPaused = true; }
+void MotionController::resumeTorqueControlledFeed(int axis) { sim(axis).feedPaused = false; }
+
+CycleTimeEstimator::CycleTimeEstimator() {}
+
+CycleTimeEstimator& CycleTimeEstimator::Instance() {
+    static CycleTimeEstimator inst;
+    return inst;
+}
+
+void CycleTimeEstimator::beginBatch() {}
+void CycleTimeEstimator::cutStarted(int) {}
+void CycleTimeEstimator::cutFinished(int) {}
+void CycleTimeEstimator::batchFinished() {}
+void CycleTimeEstimator::batchStopped() {}
+void CycleTimeEstimator::invalidateCut() {}
+
+// --- Harness ---
+
+static const float Y_RETRACT = 0.0f;
+static const float Y_START = 1.0f;
+static const float Y_STOP = 2.0f;
+
+typedef CutSequenceController::SequenceState State;
+
+static void tick() {
+    ClearCore::TimingMgr.us += static_cast<uint32_t>(TICK * 1e6f);
+    simX.tick();
+    simY.tick();
+    CutSequenceController::Instance().update();
+}
+
+static void startBatch(bool overlap, const std::vector<float>& xs) {
+    simX = SimAxis();
+    simY = SimAxis();
+    simY.pos = Y_START;     // Left at the cut start by the last job
+
+    auto& seq = CutSequenceController::Instance();
+    seq.reset();
+    seq.setOverlapMode(overlap);
+    seq.setXIncrements(xs);
+    seq.setYRetract(Y_RETRACT);
+    seq.setYCutStart(Y_START);
+    seq.setYCutStop(Y_STOP);
+    seq.setLastCompletedPosition(0);
+    seq.setBatchSize(static_cast<int>(xs.size()));
+    CHECK(seq.startBatchSequence());
+}
+
+// Run until the sequence reaches the state; false on timeout
+static bool runUntil(State state, float seconds = 30.0f) {
+    auto& seq = CutSequenceController::Instance();
+    for (float t = 0.0f; t < seconds; t += TICK) {
+        if (seq.getState() == state) return true;
+        tick();
+    }
+    return seq.getState() == state;
+}
+
+// Run a little way into the state, so its moves are in flight
+static bool runInto(State state, float seconds) {
+    if (!runUntil(state)) return false;
+    for (float t = 0.0f; t < seconds; t += TICK) {
+        tick();
+        if (CutSequenceController::Instance().getState() != state) return false;
+    }
+    return true;
+}
+
+static const char* const STATE_NAMES[] = {
+    "idle", "retract", "index X", "approach", "cutting", "retracting", "completed", "paused", "aborted"
+};
+
+// Pause in the given state: nothing may move or start while paused, and
+// the batch still finishes with every cut on its X after resume
+static void testPause(bool overlap, State state, float into, const std::vector<float>& xs) {
+    printf("%s, pause %.3f s into %s\n", overlap ? "overlapped" : "strict", into, STATE_NAMES[state]);
+
+    startBatch(overlap, xs);
+    auto& seq = CutSequenceController::Instance();
+
+    // Skip the first cut so the pause lands on a full retract-index-approach
+    CHECK(runUntil(CutSequenceController::SEQUENCE_CUTTING));
+    CHECK(runInto(state, into));
+
+    seq.pause();
+    CHECK(seq.isPaused());
+    int startedX = simX.started;
+    int startedY = simY.started;
+    float x = simX.pos;
+    float y = simY.pos;
+    for (int i = 0; i < 3000; i++) tick();
+
+    printf("  paused at X %.3f Y %.3f, moves started while paused: X %d, Y %d\n",
+        x, y, simX.started - startedX, simY.started - startedY);
+    CHECK(simX.started == startedX);
+    CHECK(simY.started == startedY);
+    CHECK(simX.pos == x);
+    CHECK(simY.pos == y);
+    CHECK(seq.isPaused());
+
+    // Resume finishes the batch, every cut made on its own X
+    std::vector<float> cutAt;
+    seq.resume();
+    CHECK(!seq.isPaused());
+    for (float t = 0.0f; t < 60.0f && seq.getState() != CutSequenceController::SEQUENCE_COMPLETED; t += TICK) {
+        bool wasCutting = seq.getState() == CutSequenceController::SEQUENCE_CUTTING;
+        tick();
+        if (!wasCutting && seq.getState() == CutSequenceController::SEQUENCE_CUTTING) cutAt.push_back(simX.pos);
+    }
+    CHECK(seq.getState() == CutSequenceController::SEQUENCE_COMPLETED);
+    CHECK(seq.getBatchCompletedCount() == static_cast<int>(xs.size()));
+    CHECK(cutAt.size() == xs.size() - 1);
+    for (size_t i = 0; i < cutAt.size() && i + 1 < xs.size(); i++) {
+        CHECK(fabsf(cutAt[i] - xs[i + 1]) <= 0.01f);
+    }
+    printf("  resumed: %d cuts completed\n", seq.getBatchCompletedCount());
+}
+
+int main() {
+    const std::vector<float> longIndex = { 1.0f, 3.0f, 5.5f, 6.0f };
+    const std::vector<float> shortIndex = { 1.0f, 1.2f, 3.0f, 3.5f };
+    const State states[] = {
+        CutSequenceController::SEQUENCE_RETRACTING,
+        CutSequenceController::SEQUENCE_MOVING_TO_X,
+        CutSequenceController::SEQUENCE_MOVING_TO_START,
+    };
+
+    for (int overlap = 1; overlap >= 0; overlap--) {
+        for (State s : states) {
+            testPause(overlap != 0, s, 0.005f, longIndex);
+        }
+    }
+
+    // Deep into the X index, with the approach about to be queued
+    testPause(true, CutSequenceController::SEQUENCE_MOVING_TO_X, 0.4f, longIndex);
+
+    // A short index queues the approach while Y is still retracting: the
+    // queued approach must not start on its own once the retract ends
+    testPause(true, CutSequenceController::SEQUENCE_MOVING_TO_START, 0.005f, shortIndex);
+
+    if (failures) {
+        printf("%d check(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
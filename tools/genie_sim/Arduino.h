@@ -0,0 +1,42 @@
+// Arduino.h - just enough of the Arduino core to build genieArduinoDEV on a PC
+// for genie_link_test.cpp. Time only moves when the test advances it, so any
+// loop in the library that waits on millis() hangs the test instead of passing.
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+extern uint32_t sim_now_us;
+
+inline uint32_t millis() { return sim_now_us / 1000; }
+inline uint32_t micros() { return sim_now_us; }
+inline void delayMicroseconds(uint32_t) {}
+
+#define F(s) (s)
+
+class Stream {
+public:
+    virtual ~Stream() {}
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t write(uint8_t b) = 0;
+
+    template<typename T> void print(T v) { (void)v; }
+    template<typename T> void println(T v) { (void)v; }
+};
+
+class HardwareSerial : public Stream {};
+
+class String {
+public:
+    String(const char* s = "") : _s(s) {}
+    const char* c_str() const { return _s.c_str(); }
+private:
+    std::string _s;
+};
+
+extern Stream& Serial;
@@ -0,0 +1,51 @@
+// PtySerial.h - the Arduino HardwareSerial the Genie library expects, on a
+// Linux tty such as the pty genie_emu.py creates
+#pragma once
+
+#include <Arduino.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+class PtySerial : public HardwareSerial {
+public:
+    bool open(const char* path) {
+        _fd = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+        if (_fd < 0) return false;
+        termios t;
+        if (tcgetattr(_fd, &t) == 0) {
+            cfmakeraw(&t);
+            tcsetattr(_fd, TCSANOW, &t);
+        }
+        return true;
+    }
+
+    int available() override {
+        fill();
+        return _len - _pos;
+    }
+    int read() override {
+        fill();
+        return _pos < _len ? _buf[_pos++] : -1;
+    }
+    int peek() override {
+        fill();
+        return _pos < _len ? _buf[_pos] : -1;
+    }
+    size_t write(uint8_t b) override {
+        return ::write(_fd, &b, 1) == 1 ? 1 : 0;
+    }
+
+private:
+    void fill() {
+        if (_pos < _len) return;
+        ssize_t n = ::read(_fd, _buf, sizeof(_buf));
+        _pos = 0;
+        _len = n > 0 ? (int)n : 0;
+    }
+
+    int _fd = -1;
+    uint8_t _buf[256];
+    int _pos = 0;
+    int _len = 0;
+};
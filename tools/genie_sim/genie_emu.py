@@ -0,0 +1,288 @@
+#!/usr/bin/env python3
+"""Emulate a 4D Genie display on a pseudo-terminal, for UI latency runs on a PC.
+
+    python3 tools/genie_sim/genie_emu.py --link /tmp/genie
+    python3 tools/genie_sim/genie_emu.py --link /tmp/genie --ack-delay-ms 1.5 \\
+        --script touches.txt --log run.csv --duration 20
+
+Anything that opens the --link path talks to it like the display's UART (see
+genie_pty_bench.cpp). The emulator ACKs writes after --ack-delay-ms (NAKing
+--nak-pct of them and any with a bad checksum), answers reads from an object
+model kept per form, ACKs magic writes so baud negotiation completes, and
+plays touch events from the script.
+
+Script lines are "<ms> <action> <args>", ms counted from the first frame the
+host sends:
+    500   touch 6 25 1        # REPORT_EVENT object 6 (WinButton) index 25 = 1
+    900   touch 6 25 0
+    1500  form 2              # the display changed form by itself (REPORT_EVENT form)
+
+Every frame in either direction is logged with a timestamp; at exit a summary
+gives the time from each form write until the host went quiet (screen
+transition) and from each touch to the first and last write it caused. Pass
+--ignore for object types the host refreshes continuously, or there is never
+a quiet gap to end on.
+"""
+
+import argparse
+import bisect
+import csv
+import heapq
+import os
+import pty
+import random
+import select
+import sys
+import time
+import tty
+
+ACK, NAK = 0x06, 0x15
+READ_OBJ, WRITE_OBJ, WRITE_STR, WRITE_STRU, WRITE_CONTRAST = 0, 1, 2, 3, 4
+REPORT_OBJ, REPORT_EVENT = 5, 7
+WRITE_BYTES, WRITE_DBYTES, WRITE_INH_LABEL = 8, 9, 12
+OBJ_FORM = 10
+
+CMD_NAMES = {READ_OBJ: "read", WRITE_OBJ: "write", WRITE_STR: "str", WRITE_STRU: "stru",
+             WRITE_CONTRAST: "contrast", REPORT_OBJ: "report", REPORT_EVENT: "event",
+             WRITE_BYTES: "magic", WRITE_DBYTES: "magic_d", WRITE_INH_LABEL: "label"}
+
+QUIET_MS = 50   # no host frames for this long ends a transition or a response
+
+
+def frame(*body):
+    cs = 0
+    for b in body:
+        cs ^= b
+    return bytes(body) + bytes([cs])
+
+
+def frame_length(buf):
+    """Bytes in the frame starting buf[0], 0 if not known yet, -1 if not a command."""
+    cmd = buf[0]
+    if cmd == READ_OBJ:
+        return 4
+    if cmd == WRITE_OBJ:
+        return 6
+    if cmd == WRITE_CONTRAST:
+        return 3
+    if cmd in (WRITE_STR, WRITE_INH_LABEL, WRITE_BYTES):
+        return 4 + buf[2] if len(buf) >= 3 else 0
+    if cmd in (WRITE_STRU, WRITE_DBYTES):
+        return 4 + 2 * buf[2] if len(buf) >= 3 else 0
+    return -1
+
+
+def load_script(path):
+    steps = []
+    with open(path) as f:
+        for n, line in enumerate(f, 1):
+            words = line.split("#", 1)[0].split()
+            if not words:
+                continue
+            try:
+                at = float(words[0])
+                if words[1] == "touch":
+                    steps.append((at, "touch", int(words[2]), int(words[3]), int(words[4])))
+                elif words[1] == "form":
+                    steps.append((at, "form", OBJ_FORM, int(words[2]), 0))
+                else:
+                    raise ValueError(words[1])
+            except (IndexError, ValueError) as e:
+                raise SystemExit("{}:{}: bad script line ({})".format(path, n, e))
+    return sorted(steps)
+
+
+class Display:
+    def __init__(self, args, fd):
+        self.args = args
+        self.fd = fd
+        self.form = args.form
+        self.objects = {}           # (form, object, index) -> value
+        self.rx = bytearray()
+        self.pending = []           # (due, seq, bytes) heap
+        self.seq = 0
+        self.t0 = None              # first host frame
+        self.log = []               # (ms, dir, cmd, object, index, value, form)
+
+    def now_ms(self):
+        return (time.monotonic() - self.t0) * 1000.0 if self.t0 is not None else 0.0
+
+    def send_later(self, data, delay_ms):
+        self.seq += 1
+        heapq.heappush(self.pending, (time.monotonic() + delay_ms / 1000.0, self.seq, data))
+
+    def flush_due(self):
+        now = time.monotonic()
+        while self.pending and self.pending[0][0] <= now:
+            _, _, data = heapq.heappop(self.pending)
+            os.write(self.fd, data)
+
+    def record(self, direction, cmd, obj, idx, value):
+        self.log.append((round(self.now_ms(), 3), direction, CMD_NAMES.get(cmd, str(cmd)),
+                         obj, idx, value, self.form))
+
+    def inject(self, obj, idx, value):
+        if obj == OBJ_FORM:
+            self.form = idx
+        self.objects[(self.form, obj, idx)] = value
+        self.send_later(frame(REPORT_EVENT, obj, idx, value >> 8, value & 0xFF), 0)
+        self.record("tx", REPORT_EVENT, obj, idx, value)
+
+    def receive(self, data):
+        self.rx.extend(data)
+        while self.rx:
+            if self.rx[0] == 0xFF:          # host NAK recovery pulse
+                del self.rx[0]
+                continue
+            n = frame_length(self.rx)
+            if n < 0:
+                del self.rx[0]
+                continue
+            if n == 0 or len(self.rx) < n:
+                return
+            self.handle(bytes(self.rx[:n]))
+            del self.rx[:n]
+
+    def handle(self, f):
+        if self.t0 is None:
+            self.t0 = time.monotonic()
+        cmd = f[0]
+        cs = 0
+        for b in f:
+            cs ^= b
+        if cs != 0:
+            self.record("rx", cmd, -1, -1, -1)
+            self.send_later(bytes([NAK]), self.args.ack_delay_ms)
+            return
+
+        if cmd == READ_OBJ:
+            obj, idx = f[1], f[2]
+            value = self.form if obj == OBJ_FORM else self.objects.get((self.form, obj, idx), 0)
+            self.record("rx", cmd, obj, idx, "")
+            self.send_later(frame(REPORT_OBJ, obj, idx, value >> 8, value & 0xFF),
+                            self.args.reply_delay_ms)
+            return
+
+        if cmd == WRITE_OBJ:
+            obj, idx, value = f[1], f[2], f[3] << 8 | f[4]
+            if obj == OBJ_FORM:
+                self.form = idx
+            else:
+                self.objects[(self.form, obj, idx)] = value
+            self.record("rx", cmd, obj, idx, value)
+        elif cmd == WRITE_CONTRAST:
+            self.record("rx", cmd, "", "", f[1])
+        else:
+            self.record("rx", cmd, "", f[1], f[2])   # index, length
+
+        if random.random() * 100 < self.args.nak_pct:
+            self.send_later(bytes([NAK]), self.args.ack_delay_ms)
+        else:
+            self.send_later(bytes([ACK]), self.args.ack_delay_ms)
+
+
+def spans(log, start_rows, ignore):
+    """For each start row, ms to the first and last host write before QUIET_MS of quiet."""
+    writes = [r[0] for r in log if r[1] == "rx" and r[2] != "read" and r[3] not in ignore]
+    out = []
+    for row in start_rows:
+        t = row[0]
+        i = bisect.bisect_left(writes, t)
+        if i == len(writes):
+            out.append((row, None, None))
+            continue
+        first = last = writes[i]
+        for w in writes[i + 1:]:
+            if w - last > QUIET_MS:
+                break
+            last = w
+        out.append((row, first - t, last - t))
+    return out
+
+
+def summarize(log, ignore):
+    forms = [r for r in log if r[1] == "rx" and r[2] == "write" and r[3] == OBJ_FORM]
+    print("form transitions (form write to last write of the burst):")
+    times = []
+    for row, _, last in spans(log, forms, ignore):
+        if last is None:
+            print("  {:9.1f} ms  form {:2}  no writes".format(row[0], row[4]))
+            continue
+        times.append(last)
+        print("  {:9.1f} ms  form {:2}  {:7.1f} ms".format(row[0], row[4], last))
+    if times:
+        print("  mean {:.1f} ms, worst {:.1f} ms".format(sum(times) / len(times), max(times)))
+
+    touches = [r for r in log if r[1] == "tx" and r[2] == "event"]
+    print("touch responses (event to first / last write):")
+    for row, first, last in spans(log, touches, ignore):
+        if first is None:
+            print("  {:9.1f} ms  {}/{} = {}  no response".format(row[0], row[3], row[4], row[5]))
+        else:
+            print("  {:9.1f} ms  {}/{} = {}  {:6.1f} / {:6.1f} ms".format(
+                row[0], row[3], row[4], row[5], first, last))
+
+    writes = sum(1 for r in log if r[1] == "rx")
+    print("{} host frames".format(writes))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--link", default="/tmp/genie", help="symlink created to the pty")
+    ap.add_argument("--ack-delay-ms", type=float, default=1.0)
+    ap.add_argument("--reply-delay-ms", type=float, default=2.0, help="delay before read replies")
+    ap.add_argument("--nak-pct", type=float, default=0.0, help="share of writes NAKed")
+    ap.add_argument("--form", type=int, default=0, help="form shown at power-up")
+    ap.add_argument("--script", help="touch events to inject")
+    ap.add_argument("--log", help="CSV of every frame")
+    ap.add_argument("--ignore", type=int, nargs="*", default=[],
+                    help="object types left out of the summary timings (periodic gauges)")
+    ap.add_argument("--duration", type=float, default=0, help="seconds to run after the host connects (0 = until Ctrl-C)")
+    args = ap.parse_args()
+
+    master, slave = pty.openpty()
+    tty.setraw(slave)
+    if os.path.lexists(args.link):
+        os.unlink(args.link)
+    os.symlink(os.ttyname(slave), args.link)
+    print("genie display on {} -> {}".format(args.link, os.ttyname(slave)), file=sys.stderr)
+
+    display = Display(args, master)
+    script = load_script(args.script) if args.script else []
+    step = 0
+    try:
+        while True:
+            timeout = 0.005
+            if display.pending:
+                timeout = max(0.0, min(timeout, display.pending[0][0] - time.monotonic()))
+            readable, _, _ = select.select([master], [], [], timeout)
+            if readable:
+                try:
+                    display.receive(os.read(master, 4096))
+                except OSError:
+                    pass            # no host connected yet
+            display.flush_due()
+
+            if display.t0 is not None:
+                now = display.now_ms()
+                while step < len(script) and script[step][0] <= now:
+                    _, _, obj, idx, value = script[step]
+                    display.inject(obj, idx, value)
+                    step += 1
+                if args.duration and now >= args.duration * 1000:
+                    break
+    except KeyboardInterrupt:
+        pass
+    finally:
+        os.unlink(args.link)
+
+    if args.log:
+        with open(args.log, "w", newline="") as f:
+            w = csv.writer(f)
+            w.writerow(["ms", "dir", "cmd", "object", "index", "value", "form"])
+            w.writerows(display.log)
+    summarize(display.log, set(args.ignore))
+
+
+if __name__ == "__main__":
+    main()
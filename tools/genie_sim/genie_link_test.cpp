@@ -0,0 +1,463 @@
+// genie_link_test.cpp - host test of the genieArduinoDEV send path against a
+// simulated display that answers late, drops ACKs, goes missing or changes baud.
+//
+//   g++ -std=gnu++11 -DARDUINO=100 -Itools/genie_sim -IArduino/libraries/genieArduinoDEV/src
+//       tools/genie_sim/genie_link_test.cpp Arduino/libraries/genieArduinoDEV/src/genieArduinoDEV.cpp
+//       -o genie_link_test && ./genie_link_test
+//
+// Simulated time only advances between DoEvents() calls, so a library call that
+// waits for the display never returns; the alarm turns that into a failure.
+
+#include <Arduino.h>
+#include <genieArduinoDEV.h>
+#include <signal.h>
+#include <unistd.h>
+#include <deque>
+#include <vector>
+
+uint32_t sim_now_us = 0;
+
+class NullStream : public Stream {
+public:
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t) override { return 1; }
+};
+static NullStream nullSerial;
+Stream& Serial = nullSerial;
+
+static const uint8_t BAUD_MAGIC_INDEX = 3;
+
+// What the display received
+struct Frame {
+    uint8_t cmd, object, index;
+    uint16_t value;
+    uint32_t atUs;
+};
+
+class SimDisplay : public HardwareSerial {
+public:
+    bool online = true;
+    uint32_t ackDelayUs = 2000;
+    uint32_t replyDelayUs = 2000;
+    int dropAcks = 0;           // ACKs to drop; -1 drops all
+    uint8_t form = 0;
+    std::vector<Frame> frames;
+
+    // Baud handling: bytes sent at a rate the other end isn't on arrive as garbage
+    static const uint32_t BOOT_BAUD = 115200;
+    uint32_t baud = BOOT_BAUD;
+    uint32_t hostBaud = BOOT_BAUD;
+    bool baudHandler = true;    // Magic baud object present
+    bool baudIgnored = false;   // ACKs the request but never switches
+    uint32_t switchAtUs = 0;
+    uint32_t switchTo = 0;
+    uint32_t revertAtUs = 0;
+
+    void tick() {
+        if (switchAtUs && sim_now_us >= switchAtUs) {
+            baud = switchTo;
+            switchAtUs = 0;
+            revertAtUs = sim_now_us + GENIE_BAUD_COMMIT_MS * 1000UL;
+        }
+        if (revertAtUs && sim_now_us >= revertAtUs) {
+            baud = BOOT_BAUD;
+            revertAtUs = 0;
+        }
+    }
+
+    int available() override {
+        int n = 0;
+        for (size_t i = 0; i < _out.size() && _out[i].atUs <= sim_now_us; i++) n++;
+        return n;
+    }
+    int read() override {
+        if (!available()) return -1;
+        Byte b = _out.front();
+        _out.pop_front();
+        return b.baud == hostBaud ? b.b : 0xFE;
+    }
+    int peek() override {
+        if (!available()) return -1;
+        return _out.front().baud == hostBaud ? _out.front().b : 0xFE;
+    }
+
+    size_t write(uint8_t b) override {
+        if (!online) return 1;
+        if (hostBaud != baud) return 1;             // garbled on the wire
+        if (_in.empty() && b == 0xFF) return 1;     // NAK recovery pulse
+        _in.push_back(b);
+        uint8_t cmd = _in[0];
+        size_t want = 0;
+        switch (cmd) {
+        case GENIE_READ_OBJ:        want = 4; break;
+        case GENIE_WRITE_OBJ:       want = 6; break;
+        case GENIE_WRITE_CONTRAST:  want = 3; break;
+        case GENIE_WRITE_STR:
+        case GENIE_WRITE_INH_LABEL:
+        case GENIEM_WRITE_BYTES:    want = _in.size() >= 3 ? 4u + _in[2] : 0; break;
+        case GENIE_WRITE_STRU:
+        case GENIEM_WRITE_DBYTES:   want = _in.size() >= 3 ? 4u + 2u * _in[2] : 0; break;
+        default:                    _in.clear(); return 1;
+        }
+        if (want && _in.size() >= want) {
+            frameReceived();
+            _in.clear();
+        }
+        return 1;
+    }
+
+    // Unsolicited bytes from the display, starting `delayUs` from now
+    void send(const std::vector<uint8_t>& bytes, uint32_t delayUs, uint32_t gapUs = 0) {
+        uint32_t at = sim_now_us + delayUs;
+        for (uint8_t b : bytes) {
+            _out.push_back({ b, at, baud });
+            at += gapUs;
+        }
+    }
+
+    int count(uint8_t cmd, uint8_t object) const {
+        int n = 0;
+        for (const Frame& f : frames) if (f.cmd == cmd && f.object == object) n++;
+        return n;
+    }
+
+private:
+    struct Byte { uint8_t b; uint32_t atUs; uint32_t baud; };
+    std::deque<Byte> _out;
+    std::vector<uint8_t> _in;
+
+    void frameReceived() {
+        uint8_t cmd = _in[0];
+        if (cmd == GENIE_READ_OBJ) {
+            uint16_t v = _in[1] == GENIE_OBJ_FORM ? form : 0;
+            std::vector<uint8_t> r = { GENIE_REPORT_OBJ, _in[1], _in[2], (uint8_t)(v >> 8), (uint8_t)v, 0 };
+            for (int i = 0; i < 5; i++) r[5] ^= r[i];
+            send(r, replyDelayUs);
+            return;
+        }
+        if (cmd == GENIEM_WRITE_BYTES && _in[1] == BAUD_MAGIC_INDEX) {
+            magicBaud();
+            return;
+        }
+        Frame f = { cmd, 0, 0, 0, sim_now_us };
+        if (cmd == GENIE_WRITE_OBJ) {
+            f.object = _in[1];
+            f.index = _in[2];
+            f.value = (uint16_t)(_in[3] << 8 | _in[4]);
+            if (f.object == GENIE_OBJ_FORM) form = f.index;
+        }
+        else {
+            f.index = _in[1];
+        }
+        frames.push_back(f);
+        if (dropAcks) {
+            if (dropAcks > 0) dropAcks--;
+            return;
+        }
+        send({ GENIE_ACK }, ackDelayUs);
+    }
+
+    // The display project's magic handler: 'B' ACKs then switches, 'C' commits
+    void magicBaud() {
+        if (!baudHandler) {
+            send({ GENIE_NAK }, ackDelayUs);
+            return;
+        }
+        uint32_t rate = (uint32_t)_in[4] << 24 | (uint32_t)_in[5] << 16 | (uint32_t)_in[6] << 8 | _in[7];
+        send({ GENIE_ACK }, ackDelayUs);
+        if (_in[3] == 'B' && !baudIgnored) {
+            switchTo = rate;
+            switchAtUs = sim_now_us + ackDelayUs + 1000;
+        }
+        else if (_in[3] == 'C') {
+            revertAtUs = 0;
+        }
+    }
+};
+
+static SimDisplay* sim = nullptr;
+static void setHostBaud(uint32_t baud) { sim->hostBaud = baud; }
+
+static int failures = 0;
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// Completion reports and events seen by the handlers
+struct TxDone { uint8_t cmd, object, index, status; uint32_t atUs; };
+static std::vector<TxDone> txDone;
+static std::vector<genieFrame> events;
+static Genie* current = nullptr;
+
+static void onTxComplete(uint8_t cmd, uint8_t object, uint8_t index, uint8_t status) {
+    txDone.push_back({ cmd, object, index, status, sim_now_us });
+}
+
+static void onEvent() {
+    genieFrame e;
+    current->DequeueEvent(&e);
+    events.push_back(e);
+}
+
+static std::vector<uint8_t> magicBytes;
+static void onMagicBytes(uint8_t index, uint8_t length) {
+    (void)index;
+    for (uint8_t i = 0; i < length; i++) magicBytes.push_back((uint8_t)current->GetNextByte());
+}
+
+// Run the loop for `ms` in 100 us steps
+static void run(Genie& genie, uint32_t ms) {
+    for (uint32_t t = 0; t < ms * 10; t++) {
+        sim_now_us += 100;
+        if (sim) sim->tick();
+        genie.DoEvents();
+    }
+}
+
+static void fresh(Genie& genie, SimDisplay& display) {
+    sim_now_us += 10000000;
+    txDone.clear();
+    events.clear();
+    current = &genie;
+    sim = &display;
+    genie.AttachTxCompleteHandler(onTxComplete);
+    genie.Begin(display);
+    genie.AttachEventHandler(onEvent);
+}
+
+static void testBeginDoesNotWait() {
+    printf("begin does not wait for the display\n");
+    Genie genie;
+    SimDisplay display;
+    display.replyDelayUs = 20000;
+    fresh(genie, display);
+    CHECK(!genie.IsOnline());
+    run(genie, 50);
+    CHECK(genie.IsOnline());
+    bool ready = false;
+    for (const genieFrame& e : events) if (e.reportObject.cmd == GENIE_READY) ready = true;
+    CHECK(ready);
+}
+
+static void testFormChangeIsQueued() {
+    printf("form change returns before its ACK\n");
+    Genie genie;
+    SimDisplay display;
+    fresh(genie, display);
+    run(genie, 10);
+    display.ackDelayUs = 50000;
+    uint32_t start = sim_now_us;
+    CHECK(genie.WriteObject(GENIE_OBJ_FORM, 3, 0));
+    CHECK(!genie.IsIdle());
+    CHECK(display.count(GENIE_WRITE_OBJ, GENIE_OBJ_FORM) == 1);
+    run(genie, 100);
+    CHECK(genie.IsIdle());
+    CHECK(txDone.size() == 1);
+    if (txDone.size() == 1) {
+        CHECK(txDone[0].object == GENIE_OBJ_FORM && txDone[0].index == 3);
+        CHECK(txDone[0].status == GENIE_TX_ACKED);
+        CHECK(txDone[0].atUs - start >= 50000);
+    }
+    CHECK(genie.GetTxStatus() == GENIE_TX_ACKED);
+}
+
+static void testPriorityJumpsQueue() {
+    printf("form change goes ahead of queued object writes\n");
+    Genie genie;
+    SimDisplay display;
+    fresh(genie, display);
+    run(genie, 10);
+    for (uint8_t i = 0; i < 5; i++) genie.WriteObject(GENIE_OBJ_LED_DIGITS, i, 100 + i);
+    genie.WriteObject(GENIE_OBJ_FORM, 2, 0);
+    run(genie, 100);
+    CHECK(display.frames.size() == 6);
+    if (display.frames.size() == 6) {
+        // The first digit write went straight out; the form beats the other four
+        CHECK(display.frames[0].object == GENIE_OBJ_LED_DIGITS && display.frames[0].index == 0);
+        CHECK(display.frames[1].object == GENIE_OBJ_FORM);
+        for (int i = 2; i < 6; i++) CHECK(display.frames[i].index == i - 1);
+    }
+    CHECK(genie.IsIdle());
+}
+
+static void testDroppedAckRetriesPriority() {
+    printf("dropped ACK on a form change is retried once\n");
+    Genie genie;
+    SimDisplay display;
+    fresh(genie, display);
+    run(genie, 10);
+    display.dropAcks = 1;
+    genie.WriteObject(GENIE_OBJ_FORM, 4, 0);
+    run(genie, GENIE_ACK_TIMEOUT + 50);
+    CHECK(display.count(GENIE_WRITE_OBJ, GENIE_OBJ_FORM) == 2);
+    CHECK(genie.GetTxTimeouts() == 1);
+    CHECK(txDone.size() == 1);
+    if (txDone.size() == 1) CHECK(txDone[0].status == GENIE_TX_ACKED);
+}
+
+static void testLostDisplayDoesNotStall() {
+    printf("writes keep moving when ACKs never come\n");
+    Genie genie;
+    SimDisplay display;
+    fresh(genie, display);
+    run(genie, 10);
+    display.dropAcks = -1;
+    genie.WriteObject(GENIE_OBJ_LED_DIGITS, 0, 1);
+    genie.WriteObject(GENIE_OBJ_LED_DIGITS, 1, 2);
+    run(genie, GENIE_ACK_TIMEOUT / 2);
+    CHECK(display.frames.size() == 1);      // still waiting on the first
+    run(genie, GENIE_ACK_TIMEOUT + 50);
+    CHECK(display.frames.size() == 2);      // gave up and moved on
+    run(genie, GENIE_ACK_TIMEOUT);
+    CHECK(txDone.size() == 2);
+    for (const TxDone& d : txDone) CHECK(d.status == GENIE_TX_TIMEOUT);
+    CHECK(genie.IsIdle());
+}
+
+static void testOfflineFormShownOnDetect() {
+    printf("form requested while offline is shown once detected\n");
+    Genie genie;
+    SimDisplay display;
+    display.online = false;
+    fresh(genie, display);
+    run(genie, 10);
+    CHECK(!genie.WriteObject(GENIE_OBJ_FORM, 5, 0));
+    run(genie, 100);
+    CHECK(display.frames.empty());
+    display.online = true;
+    run(genie, 100);
+    CHECK(genie.IsOnline());
+    CHECK(display.count(GENIE_WRITE_OBJ, GENIE_OBJ_FORM) == 1);
+    CHECK(display.form == 5);
+}
+
+static void testStringsQueued() {
+    printf("string writes are queued behind an outstanding ACK\n");
+    Genie genie;
+    SimDisplay display;
+    fresh(genie, display);
+    run(genie, 10);
+    display.ackDelayUs = 30000;
+    genie.WriteObject(GENIE_OBJ_LED_DIGITS, 0, 7);
+    run(genie, 1);
+    CHECK(genie.WriteStr(1, "HELLO"));
+    CHECK(display.frames.size() == 1);
+    run(genie, 100);
+    CHECK(display.count(GENIE_WRITE_STR, 0) == 1);
+    CHECK(txDone.size() == 2);
+    if (txDone.size() == 2) CHECK(txDone[1].cmd == GENIE_WRITE_STR && txDone[1].index == 1);
+}
+
+static void testSlowMagicReport() {
+    printf("magic report trickling in does not hold up DoEvents\n");
+    Genie genie;
+    SimDisplay display;
+    fresh(genie, display);
+    genie.AttachMagicByteReader(onMagicBytes);
+    run(genie, 10);
+    magicBytes.clear();
+    // Header now, payload one byte every 10 ms, then the checksum
+    display.send({ GENIEM_REPORT_BYTES, 0, 3 }, 0);
+    display.send({ 0x11, 0x22, 0x33, 0x00 }, 1000, 10000);
+    run(genie, 20);
+    CHECK(magicBytes.empty());
+    run(genie, 40);
+    CHECK(magicBytes.size() == 3);
+    if (magicBytes.size() == 3) CHECK(magicBytes[0] == 0x11 && magicBytes[2] == 0x33);
+    // Stream is back in sync for the next frame
+    genie.WriteObject(GENIE_OBJ_LED_DIGITS, 0, 1);
+    run(genie, 10);
+    CHECK(genie.IsIdle());
+}
+
+static void startFast(Genie& genie, SimDisplay& display) {
+    genie.NegotiateBaud(SimDisplay::BOOT_BAUD, 600000, BAUD_MAGIC_INDEX, setHostBaud);
+    fresh(genie, display);
+}
+
+static void testBaudNegotiated() {
+    printf("link negotiates a higher baud and keeps it\n");
+    Genie genie;
+    SimDisplay display;
+    startFast(genie, display);
+    run(genie, 100);
+    CHECK(genie.GetBaudState() == GENIE_BAUD_ACTIVE);
+    CHECK(genie.GetBaud() == 600000);
+    CHECK(display.hostBaud == 600000);
+    run(genie, GENIE_BAUD_COMMIT_MS * 2);
+    CHECK(display.baud == 600000);          // committed, so the display didn't revert
+    uint32_t before = genie.GetTxFrames();
+    genie.WriteObject(GENIE_OBJ_LED_DIGITS, 0, 42);
+    run(genie, 10);
+    CHECK(genie.GetTxFrames() == before + 1);
+    CHECK(txDone.size() == 1);              // negotiation frames aren't reported
+}
+
+static void testBaudRefused() {
+    printf("display without the baud handler stays at the boot rate\n");
+    Genie genie;
+    SimDisplay display;
+    display.baudHandler = false;
+    startFast(genie, display);
+    run(genie, 500);
+    CHECK(genie.GetBaudState() == GENIE_BAUD_FAILED);
+    CHECK(genie.GetBaud() == SimDisplay::BOOT_BAUD);
+    genie.WriteObject(GENIE_OBJ_LED_DIGITS, 0, 42);
+    run(genie, 10);
+    CHECK(display.count(GENIE_WRITE_OBJ, GENIE_OBJ_LED_DIGITS) == 1);
+}
+
+static void testBaudFallsBack() {
+    printf("new rate that never answers falls back\n");
+    Genie genie;
+    SimDisplay display;
+    display.baudIgnored = true;
+    startFast(genie, display);
+    run(genie, GENIE_BAUD_VERIFY_MS + 100);
+    CHECK(genie.GetBaudState() == GENIE_BAUD_FAILED);
+    CHECK(display.hostBaud == SimDisplay::BOOT_BAUD);
+    CHECK(genie.IsOnline());
+    genie.WriteObject(GENIE_OBJ_LED_DIGITS, 0, 42);
+    run(genie, 10);
+    CHECK(display.count(GENIE_WRITE_OBJ, GENIE_OBJ_LED_DIGITS) == 1);
+}
+
+static void testBaudAfterDisplayReset() {
+    printf("display reset at the high rate is found again and renegotiated\n");
+    Genie genie;
+    SimDisplay display;
+    startFast(genie, display);
+    run(genie, 100);
+    CHECK(genie.GetBaudState() == GENIE_BAUD_ACTIVE);
+    display.baud = SimDisplay::BOOT_BAUD;   // rebooted
+    run(genie, DISPLAY_TIMEOUT + AUTO_PING_CYCLE + 500);
+    CHECK(genie.IsOnline());
+    CHECK(genie.GetBaudState() == GENIE_BAUD_ACTIVE);
+    CHECK(display.baud == 600000 && display.hostBaud == 600000);
+}
+
+static void onHang(int) {
+    printf("  FAIL: library call blocked waiting for the display\n");
+    _exit(1);
+}
+
+int main() {
+    signal(SIGALRM, onHang);
+    alarm(10);
+
+    testBeginDoesNotWait();
+    testFormChangeIsQueued();
+    testPriorityJumpsQueue();
+    testDroppedAckRetriesPriority();
+    testLostDisplayDoesNotStall();
+    testOfflineFormShownOnDetect();
+    testStringsQueued();
+    testSlowMagicReport();
+    testBaudNegotiated();
+    testBaudRefused();
+    testBaudFallsBack();
+    testBaudAfterDisplayReset();
+
+    printf(failures ? "%d failure(s)\n" : "all passed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+// genie_pty_bench.cpp - runs genieArduinoDEV against a real tty (normally
+// genie_emu.py's pty) on the wall clock, with a load shaped like the saw's
+// screens, and reports what the host side sees.
+//
+//   python3 tools/genie_sim/genie_emu.py --link /tmp/genie --script tools/genie_sim/touches.txt --ignore 40 &
+//   g++ -std=gnu++11 -O2 -DARDUINO=100 -Itools/genie_sim -IArduino/libraries/genieArduinoDEV/src
+//       tools/genie_sim/genie_pty_bench.cpp Arduino/libraries/genieArduinoDEV/src/genieArduinoDEV.cpp
+//       -o genie_pty_bench && ./genie_pty_bench /tmp/genie 10
+//
+// Load: a form change every FORM_PERIOD_MS followed by that form's starting
+// values, a gauge refreshed every GAUGE_PERIOD_MS, and each WinButton touch
+// answered with an LED write. Like DisplayModel, writes are held back while
+// the library's queue is full rather than overwriting queued frames.
+
+#include <Arduino.h>
+#include <genieArduinoDEV.h>
+#include "PtySerial.h"
+#include <time.h>
+#include <deque>
+
+uint32_t sim_now_us = 0;
+
+class NullStream : public Stream {
+public:
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t) override { return 1; }
+};
+static NullStream nullSerial;
+Stream& Serial = nullSerial;
+
+static const uint32_t FORM_PERIOD_MS = 500;
+static const uint32_t GAUGE_PERIOD_MS = 20;
+static const uint8_t FORM_FIELDS = 24;     // Starting values sent per form
+static const uint8_t FORMS[] = { 7, 1, 6, 2, 5, 9 };
+
+static Genie genie;
+
+struct Write { uint8_t object, index; uint16_t value; };
+static std::deque<Write> backlog;
+
+static uint32_t wallUs() {
+    static timespec start;
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (!start.tv_sec) start = now;
+    return (uint32_t)((now.tv_sec - start.tv_sec) * 1000000LL + (now.tv_nsec - start.tv_nsec) / 1000);
+}
+
+static void queueWrite(uint8_t object, uint8_t index, uint16_t value) {
+    backlog.push_back({ object, index, value });
+}
+
+static void drain() {
+    while (!backlog.empty() && genie._outgoing_queue.size() < genie._outgoing_queue.capacity()) {
+        const Write& w = backlog.front();
+        if (!genie.WriteObject(w.object, w.index, w.value)) break;
+        backlog.pop_front();
+    }
+}
+
+// Form transition: from the form write until every frame queued behind it is ACKed
+struct Transition { bool pending; uint32_t startUs; uint32_t frames; };
+static Transition transition;
+static uint32_t transitions = 0, transitionSumUs = 0, transitionWorstUs = 0;
+
+static void showForm(uint8_t form) {
+    genie.WriteObject(GENIE_OBJ_FORM, form, 0);
+    for (uint8_t i = 0; i < FORM_FIELDS; i++) {
+        queueWrite(i < 8 ? GENIE_OBJ_WINBUTTON : GENIE_OBJ_LED_DIGITS, i, form * 100 + i);
+    }
+    transition = { true, wallUs(), 0 };
+}
+
+static void checkTransition() {
+    if (!transition.pending || !backlog.empty()) return;
+    if (!transition.frames) transition.frames = genie.GetTxFrames() + genie.GetTxPending();
+    if ((int32_t)(genie.GetTxFrames() - transition.frames) < 0) return;
+    uint32_t us = wallUs() - transition.startUs;
+    transitions++;
+    transitionSumUs += us;
+    if (us > transitionWorstUs) transitionWorstUs = us;
+    transition.pending = false;
+}
+
+static uint32_t events = 0;
+static void onEvent() {
+    genieFrame e;
+    genie.DequeueEvent(&e);
+    if (e.reportObject.cmd != GENIE_REPORT_EVENT) return;
+    events++;
+    if (e.reportObject.object == GENIE_OBJ_WINBUTTON) {
+        // Same path a screen's button handler takes: state shown on an LED
+        queueWrite(GENIE_OBJ_LED, e.reportObject.index, e.reportObject.data_lsb);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "/tmp/genie";
+    uint32_t seconds = argc > 2 ? (uint32_t)atoi(argv[2]) : 10;
+
+    PtySerial port;
+    if (!port.open(path)) {
+        printf("can't open %s - is genie_emu.py running?\n", path);
+        return 1;
+    }
+    genie.Begin(port);
+    genie.AttachEventHandler(onEvent);
+
+    uint32_t endUs = 0, nextFormUs = 0, nextGaugeUs = 0;
+    uint32_t samples = 0, depthSum = 0, depthMax = 0, loops = 0, loopWorstUs = 0;
+    size_t form = 0;
+    uint16_t gauge = 0;
+    uint32_t last = wallUs();
+
+    for (;;) {
+        uint32_t now = wallUs();
+        sim_now_us = now;
+        if (now - last > loopWorstUs) loopWorstUs = now - last;
+        last = now;
+
+        genie.DoEvents();
+        if (!genie.IsOnline()) {
+            if (now > 5000000) {
+                printf("display not found on %s\n", path);
+                return 1;
+            }
+            continue;
+        }
+        if (!endUs) {
+            endUs = now + seconds * 1000000UL;
+            nextFormUs = nextGaugeUs = now;
+        }
+        if ((int32_t)(now - endUs) >= 0) break;
+
+        if ((int32_t)(now - nextFormUs) >= 0) {
+            showForm(FORMS[form++ % sizeof(FORMS)]);
+            nextFormUs += FORM_PERIOD_MS * 1000;
+        }
+        if ((int32_t)(now - nextGaugeUs) >= 0) {
+            queueWrite(GENIE_OBJ_IGAUGE, 0, gauge++ % 100);
+            nextGaugeUs += GAUGE_PERIOD_MS * 1000;
+        }
+        drain();
+        checkTransition();
+
+        uint32_t depth = genie.GetTxPending() + backlog.size();
+        depthSum += depth;
+        if (depth > depthMax) depthMax = depth;
+        samples++;
+        loops++;
+        usleep(100);
+    }
+
+    printf("%u s at %s\n", seconds, path);
+    printf("  form transitions: %u, mean %.1f ms, worst %.1f ms\n", transitions,
+        transitions ? transitionSumUs / 1000.0 / transitions : 0.0, transitionWorstUs / 1000.0);
+    printf("  queue depth (library + held back): mean %.1f, max %u\n",
+        samples ? (double)depthSum / samples : 0.0, depthMax);
+    printf("  frames ACKed %u (%.0f/s), ACK timeouts %u, events %u\n", genie.GetTxFrames(),
+        genie.GetTxFrames() / (double)seconds, genie.GetTxTimeouts(), events);
+    printf("  loop passes %u, worst gap %.2f ms\n", loops, loopWorstUs / 1000.0);
+    return 0;
+}
@@ -0,0 +1,147 @@
+// genie_queue_bench.cpp - host micro-benchmark of frame coalescing: the old
+// Genie_Buffer::replace() ring scan against Genie_Keyed_Buffer's hash index,
+// at the queue depths the display link actually runs at. Also cross-checks
+// that both queues deliver the same frames for a random write/send mix.
+//
+//   g++ -std=gnu++11 -O2 -DARDUINO=100 -Itools/genie_sim -IArduino/libraries/genieArduinoDEV/src
+//       tools/genie_sim/genie_queue_bench.cpp -o genie_queue_bench && ./genie_queue_bench
+
+#include <Arduino.h>
+#include <genieArduinoDEV.h>
+#include <chrono>
+
+uint32_t sim_now_us = 0;
+
+static int failures = 0;
+static volatile uint8_t sink;
+
+static void makeFrame(uint8_t* f, uint8_t object, uint8_t index, uint16_t value) {
+    f[0] = 0;
+    f[1] = GENIE_WRITE_OBJ;
+    f[2] = object;
+    f[3] = index;
+    f[4] = value >> 8;
+    f[5] = value;
+    f[6] = f[1] ^ f[2] ^ f[3] ^ f[4] ^ f[5];
+}
+
+// The same write/send mix on both queues must deliver the same frames
+static void crossCheck() {
+    Genie_Buffer<uint8_t, 16, 7> scan;
+    Genie_Keyed_Buffer<uint8_t, 16, 7, genie_tx_key> keyed;
+    srand(1);
+    for (int n = 0; n < 200000; n++) {
+        uint8_t f[7], a[7], b[7];
+        if (rand() % 3) {
+            // Few objects so writes often coalesce; occasionally overflows
+            makeFrame(f, GENIE_OBJ_LED_DIGITS, rand() % 24, rand());
+            if (!scan.replace(f, 7, 1, 2, 3)) scan.push_back(f, 7);
+            if (!keyed.replace(f, 7)) keyed.push_back(f, 7);
+        }
+        else if (scan.size()) {
+            scan.pop_front(a, 7);
+            keyed.pop_front(b, 7);
+            if (memcmp(a, b, 7) != 0) {
+                printf("FAIL crossCheck: frames differ at op %d\n", n);
+                failures++;
+                return;
+            }
+        }
+        if (scan.size() != keyed.size()) {
+            printf("FAIL crossCheck: depth %u vs %u at op %d\n", scan.size(), keyed.size(), n);
+            failures++;
+            return;
+        }
+    }
+}
+
+// A retried frame pushed back to the front must not take over the index
+// from a newer write to the same object
+static void retryKeepsNewest() {
+    Genie_Keyed_Buffer<uint8_t, 8, 7, genie_tx_key> q;
+    uint8_t f[7], out[7] = { 0 };
+    makeFrame(f, GENIE_OBJ_FORM, 2, 0);
+    q.push_back(f, 7);
+    q.pop_front(out, 7);                        // sent, then NAKed
+    makeFrame(f, GENIE_OBJ_FORM, 3, 0);
+    q.push_back(f, 7);                          // newer form change
+    q.push_front(out, 7);                       // retry goes first
+    makeFrame(f, GENIE_OBJ_FORM, 4, 0);
+    q.replace(f, 7);                            // should update form 3's frame
+    q.pop_front(out, 7);
+    bool ok = out[3] == 2;
+    q.pop_front(out, 7);
+    ok = ok && out[3] == 4 && q.size() == 0;
+    if (!ok) {
+        printf("FAIL retryKeepsNewest\n");
+        failures++;
+    }
+}
+
+// ns per write with `depth` distinct objects queued; `hitPct` of writes
+// coalesce into a queued frame, the rest are new and displace the oldest
+template<typename Q, typename Enqueue>
+static double timeWrites(Q& q, uint16_t depth, int hitPct, Enqueue enqueue) {
+    uint8_t f[7], out[7] = { 0 };
+    q.clear();
+    for (uint16_t i = 0; i < depth; i++) {
+        makeFrame(f, GENIE_OBJ_LED_DIGITS, i, 0);
+        q.push_back(f, 7);
+    }
+    const int N = 2000000;
+    uint16_t fresh = depth;
+    srand(2);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < N; n++) {
+        if (rand() % 100 < hitPct) {
+            // Ages one window behind `fresh`, so it is still queued
+            makeFrame(f, GENIE_OBJ_LED_DIGITS, (uint8_t)(fresh - 1 - rand() % depth), n);
+            enqueue(q, f);
+        }
+        else {
+            q.pop_front(out, 7);
+            sink = out[3];
+            makeFrame(f, GENIE_OBJ_LED_DIGITS, (uint8_t)fresh++, n);
+            enqueue(q, f);
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+}
+
+template<uint16_t SIZE>
+static void benchSize() {
+    static Genie_Buffer<uint8_t, SIZE, 7> scan;
+    static Genie_Keyed_Buffer<uint8_t, SIZE, 7, genie_tx_key> keyed;
+    auto scanWrite = [](Genie_Buffer<uint8_t, SIZE, 7>& q, uint8_t* f) {
+        if (!q.replace(f, 7, 1, 2, 3)) q.push_back(f, 7);
+    };
+    auto keyedWrite = [](Genie_Keyed_Buffer<uint8_t, SIZE, 7, genie_tx_key>& q, uint8_t* f) {
+        if (!q.replace(f, 7)) q.push_back(f, 7);
+    };
+
+    printf("queue of %u frames\n", SIZE);
+    printf("  depth  hit%%   scan ns   keyed ns\n");
+    const uint16_t depths[] = { 1, 4, SIZE / 2, SIZE - 1 };
+    const int hits[] = { 0, 50, 90 };
+    for (uint16_t d : depths) {
+        for (int h : hits) {
+            double a = timeWrites(scan, d, h, scanWrite);
+            double b = timeWrites(keyed, d, h, keyedWrite);
+            printf("  %5u  %4d  %8.1f   %8.1f\n", d, h, a, b);
+        }
+    }
+}
+
+int main() {
+    crossCheck();
+    retryKeepsNewest();
+
+    // Time includes the frame build and rand() common to both columns
+    benchSize<MAX_GENIE_EVENTS>();
+    benchSize<64>();
+    benchSize<256>();
+
+    printf(failures ? "%d failure(s)\n" : "all passed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,61 @@
+// ClearCore.h - stand-in for the ClearCore library on the host: USB text
+// output, a settable clock, the MPG's encoder and range pins, and the names
+// the firmware headers mention. The test defines the globals.
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+namespace ClearCore {
+
+const uint16_t SampleRateHz = 5000;
+
+class MotorDriver;
+
+class SerialUsb {
+public:
+    void Send(const char* s) { if (echo) fputs(s, stdout); }
+    void Send(char c) { if (echo) putchar(c); }
+    void Send(int32_t v) { if (echo) printf("%ld", static_cast<long>(v)); }
+    void Send(uint32_t v) { if (echo) printf("%lu", static_cast<unsigned long>(v)); }
+    void Send(double v, uint8_t digits = 2) { if (echo) printf("%.*f", digits, v); }
+    void SendLine() { if (echo) putchar('\n'); }
+    template <typename T> void SendLine(T v) { Send(v); SendLine(); }
+
+    bool echo = false;      // Firmware log lines to stdout
+};
+
+class SysTiming {
+public:
+    uint32_t Milliseconds() const { return us / 1000; }
+    uint32_t Microseconds() const { return us; }
+
+    uint32_t us = 0;        // Advanced by the test
+};
+
+class Connector {
+public:
+    enum ConnectorModes { INPUT_DIGITAL };
+
+    bool Mode(ConnectorModes) { return true; }
+    int16_t State() const { return state; }
+
+    int16_t state = 0;      // Set by the test
+};
+
+class EncoderInput {
+public:
+    int32_t Position() const { return position; }
+
+    int32_t position = 0;   // Quadrature counts, turned by the test
+};
+
+extern SerialUsb ConnectorUsb;
+extern SysTiming TimingMgr;
+extern Connector ConnectorA10;
+extern Connector ConnectorA11;
+extern EncoderInput EncoderIn;
+
+}
+
+using namespace ClearCore;
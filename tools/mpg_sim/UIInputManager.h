@@ -0,0 +1,4 @@
+// UIInputManager.h - the firmware includes this header by its Windows name;
+// the file on disk is UIInputmanager.h.
+#pragma once
+#include "../../UIInputmanager.h"
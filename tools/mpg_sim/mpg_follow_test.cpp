@@ -0,0 +1,228 @@
+// mpg_follow_test.cpp - host test of MPGJogManager's handwheel following
+// alongside the jog screens' own moves, against a simulated X/Y table.
+//
+//   g++ -std=gnu++11 -DARDUINO=100 -Itools/mpg_sim -Itools/genie_sim
+//       -IArduino/libraries/genieArduinoDEV/src -I. tools/mpg_sim/mpg_follow_test.cpp
+//       MPGJogManager.cpp -o mpg_follow_test && ./mpg_follow_test
+//
+// The real follow() runs every motion tick against a stand-in
+// MotionController. A positional move runs at a fixed speed until it
+// arrives; a velocity jog replaces it, the way JogVelocity clears the queue
+// and calls MoveVelocity. Every jog command is counted, so a button move the
+// wheel interferes with shows up as jogs issued during it.
+
+#include "MPGJogManager.h"
+#include "BinLog.h"
+#include "LatencyProfiler.h"
+#include "SetupAutocutScreen.h"
+#include <math.h>
+#include <stdio.h>
+
+uint32_t sim_now_us = 0;
+
+ClearCore::SerialUsb ClearCore::ConnectorUsb;
+ClearCore::SysTiming ClearCore::TimingMgr;
+ClearCore::Connector ClearCore::ConnectorA10;
+ClearCore::Connector ClearCore::ConnectorA11;
+ClearCore::EncoderInput ClearCore::EncoderIn;
+
+static int failures = 0;
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static const float TICK = TASK_PERIOD_MOTION_US / 1000000.0f;
+static const float MOVE_IPS = 4.0f;         // Button moves at full rate
+
+// --- Simulated axis ---
+
+struct SimAxis {
+    float pos = 1.0f;
+    bool moving = false;        // Positional move in flight
+    float target = 0.0f;
+    float speed = 0.0f;
+    float jogIps = 0.0f;        // Velocity move, 0 when none
+    int jogs = 0;               // Velocity commands issued
+
+    void moveTo(float to, float rate) {
+        jogIps = 0.0f;
+        moving = true;
+        target = to;
+        speed = MOVE_IPS * rate;
+    }
+
+    void jog(float ips) {
+        moving = false;
+        jogIps = ips;
+        jogs++;
+    }
+
+    bool busy() const { return moving || jogIps != 0.0f; }
+
+    void tick() {
+        if (jogIps != 0.0f) {
+            pos += jogIps * TICK;
+            return;
+        }
+        if (!moving) return;
+        float stepIn = speed * TICK;
+        if (fabsf(target - pos) <= stepIn) {
+            pos = target;
+            moving = false;
+        }
+        else {
+            pos += target > pos ? stepIn : -stepIn;
+        }
+    }
+};
+
+static SimAxis simX;
+static SimAxis simY;
+
+static SimAxis& sim(int axis) { return axis == AXIS_X ? simX : simY; }
+
+// --- Link seams: the parts of the firmware the MPG calls ---
+
+MotionQueue::MotionQueue(MotorDriver* motor, float maxVelocity, float maxAcceleration, uint32_t jerkMax)
+    : _motor(motor), _maxVelocity(maxVelocity), _maxAcceleration(maxAcceleration), _jerkMax(jerkMax) {}
+Spindle::Spindle() {}
+XAxis::XAxis() : _stepsPerInch(0.0f), _motor(nullptr), _queue(nullptr, 0.0f, 0.0f, 0), _homingHelper(nullptr) {}
+XAxis::~XAxis() {}
+YAxis::YAxis() : _stepsPerInch(0.0f), _motor(nullptr), _queue(nullptr, 0.0f, 0.0f, 0), _homingHelper(nullptr), _dynamicFeed(nullptr) {}
+YAxis::~YAxis() {}
+ZAxis::ZAxis() : _stepsPerDeg(0.0f), _motor(nullptr) {}
+MotionController::MotionController() {}
+
+MotionController& MotionController::Instance() {
+    static MotionController inst;
+    return inst;
+}
+
+float MotionController::getAxisPosition(AxisId axis) const { return sim(axis).pos; }
+float MotionController::getAbsoluteAxisPosition(AxisId axis) const { return sim(axis).pos; }
+bool MotionController::isAxisMoving(AxisId axis) const { return sim(axis).busy(); }
+bool MotionController::moveTo(AxisId axis, float position, float velocityScale) { sim(axis).moveTo(position, velocityScale); return true; }
+bool MotionController::moveToWithRate(AxisId axis, float target, float rate) { sim(axis).moveTo(target, rate); return true; }
+bool MotionController::jogVelocity(AxisId axis, float inchesPerSec) { sim(axis).jog(inchesPerSec); return true; }
+
+BinLog& BinLog::Instance() {
+    static BinLog inst;
+    return inst;
+}
+
+void BinLog::commit(LogMsg, uint8_t*, size_t) {}
+
+LatencyProfiler& LatencyProfiler::Instance() {
+    static LatencyProfiler inst;
+    return inst;
+}
+
+int LatencyProfiler::channel(const char*) { return -1; }
+int LatencyHistogram::bucketFor(uint32_t) { return 0; }
+
+void SetupAutocutScreen::onEncoderChanged(int) {}
+
+// --- Harness ---
+
+static const float CLICK_IN = 0.0003f;      // X1 range, both range pins low
+
+static void tick() {
+    ClearCore::TimingMgr.us += TASK_PERIOD_MOTION_US;
+    sim_now_us = ClearCore::TimingMgr.us;
+    simX.tick();
+    simY.tick();
+    MPGJogManager::Instance().follow();
+}
+
+static void run(float seconds) {
+    for (float t = 0.0f; t < seconds; t += TICK) tick();
+}
+
+// Run until the axis stops; false on timeout
+static bool runUntilStopped(AxisId axis, float seconds = 10.0f) {
+    for (float t = 0.0f; t < seconds; t += TICK) {
+        tick();
+        if (!sim(axis).busy()) return true;
+    }
+    return false;
+}
+
+// Turn the wheel a click per tick
+static void turn(int clicks) {
+    int dir = clicks < 0 ? -1 : 1;
+    for (int i = 0; i < clicks * dir; i++) {
+        ClearCore::EncoderIn.position += dir * ENCODER_COUNTS_PER_CLICK;
+        tick();
+    }
+}
+
+static void selectAxis(AxisId axis) {
+    auto& mpg = MPGJogManager::Instance();
+    mpg.setAxis(axis == AXIS_X ? AXIS_Y : AXIS_X);    // Drops any follow in progress
+    mpg.setAxis(axis);
+    run(0.05f);
+}
+
+// A wheel follow lands where the clicks say
+static void testWheelFollows(AxisId axis) {
+    selectAxis(axis);
+    float from = sim(axis).pos;
+    turn(40);
+    CHECK(runUntilStopped(axis));
+    run(0.1f);
+    printf("  wheel: 40 clicks from %.4f to %.4f\n", from, sim(axis).pos);
+    CHECK(fabsf(sim(axis).pos - (from + 40 * CLICK_IN)) < 0.0001f);
+}
+
+// A button move after a follow has settled runs to its target untouched,
+// and the wheel picks up from where it ends
+static void testButtonMoveAfterFollow(AxisId axis, float to) {
+    printf("%s axis, button move to %.2f after a follow\n", axis == AXIS_X ? "X" : "Y", to);
+    testWheelFollows(axis);
+
+    int jogs = sim(axis).jogs;
+    MotionController::Instance().moveToWithRate(axis, to, 1.0f);
+    CHECK(runUntilStopped(axis));
+    run(0.5f);
+    printf("  button move ended at %.4f, jogs issued during it: %d\n", sim(axis).pos, sim(axis).jogs - jogs);
+    CHECK(sim(axis).pos == to);
+    CHECK(sim(axis).jogs == jogs);
+
+    testWheelFollows(axis);
+}
+
+// Clicks turned while a button move runs are dropped, not followed after it
+static void testClicksDuringButtonMove(AxisId axis, float to) {
+    printf("%s axis, wheel turned during a button move to %.2f\n", axis == AXIS_X ? "X" : "Y", to);
+    selectAxis(axis);
+
+    int jogs = sim(axis).jogs;
+    MotionController::Instance().moveTo(axis, to, 0.5f);
+    run(0.05f);
+    turn(30);
+    CHECK(runUntilStopped(axis));
+    run(0.5f);
+    printf("  button move ended at %.4f, jogs issued: %d\n", sim(axis).pos, sim(axis).jogs - jogs);
+    CHECK(sim(axis).pos == to);
+    CHECK(sim(axis).jogs == jogs);
+    CHECK(!sim(axis).busy());
+}
+
+int main() {
+    auto& mpg = MPGJogManager::Instance();
+    mpg.setup();
+    mpg.setFollowMode(true);
+    mpg.setEnabled(true);
+    mpg.routeWheel(true);
+
+    // Go to zero, jog to start/end/retract
+    testButtonMoveAfterFollow(AXIS_X, 0.0f);
+    testButtonMoveAfterFollow(AXIS_Y, 3.5f);
+    testClicksDuringButtonMove(AXIS_X, 2.0f);
+    testClicksDuringButtonMove(AXIS_Y, 0.5f);
+
+    if (failures) {
+        printf("%d check(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
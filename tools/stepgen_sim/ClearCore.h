@@ -0,0 +1,5 @@
+// ClearCore.h - stand-in for ClearCore.h, so Config.h and MoveProfile.cpp
+// build next to the library's StepGenerator on the host.
+#pragma once
+
+#include <SysTiming.h>
@@ -0,0 +1,11 @@
+// SysTiming.h - stand-in for ClearCore's SysTiming.h: only the sample rate
+// StepGenerator needs.
+#pragma once
+
+#include <stdint.h>
+
+namespace ClearCore {
+
+const uint16_t SampleRateHz = 5000;
+
+}
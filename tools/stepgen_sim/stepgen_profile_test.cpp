@@ -0,0 +1,311 @@
+// stepgen_profile_test.cpp - host test of ClearCore's StepGenerator profiles:
+// the jerk-limited S-curve against the trapezoid it replaces.
+//
+//   g++ -std=gnu++11 -Itools/stepgen_sim -IClearCore-library-master/libClearCore/inc -I.
+//       tools/stepgen_sim/stepgen_profile_test.cpp MoveProfile.cpp
+//       ClearCore-library-master/libClearCore/src/StepGenerator.cpp
+//       -o stepgen_profile_test && ./stepgen_profile_test
+//
+// Each move is run one sample at a time, the way the ClearCore ISR calls
+// StepsCalculated(). Acceleration and jerk come from the generator's own exact
+// state (the trapezoid's Q15 velocity steps, the S-curve's Q47 acceleration),
+// not from differentiating step counts, so the peaks are not quantization noise.
+//
+// The limits are Config.h's, and MoveProfile's cycle-time model is checked
+// against the generator it mirrors. This is the patched library in
+// ClearCore-library-master, so the S-curve is tested whether or not the
+// firmware has MOTION_SCURVE on.
+
+#include <StepGenerator.h>
+#include <SysTiming.h>
+#include "Config.h"
+#include "MoveProfile.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+using ClearCore::StepGenerator;
+using ClearCore::SampleRateHz;
+
+static int failures = 0;
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// Fence (X) limits; the S-curve checks assume the table's are the same
+static const uint32_t VEL_MAX = static_cast<uint32_t>(FENCE_VEL_MAX);        // steps/s
+static const uint32_t ACCEL_MAX = static_cast<uint32_t>(FENCE_ACCEL_MAX);    // steps/s^2
+static const uint32_t JERK_MAX = FENCE_JERK_MAX;                             // steps/s^3
+static_assert(FENCE_VEL_MAX == TABLE_VEL_MAX && FENCE_ACCEL_MAX == TABLE_ACCEL_MAX
+    && FENCE_JERK_MAX == TABLE_JERK_MAX, "fence and table limits differ");
+static const uint32_t STEPS_PER_SAMPLE_MAX = 100;
+
+static const double SR = SampleRateHz;
+static const double Q15 = 1 << FRACT_BITS;
+static const double QJ = static_cast<double>(1ULL << SCURVE_FRACT_BITS);
+
+struct Trace {
+    std::vector<int32_t> posn;      // Absolute position after each sample
+    std::vector<double> vel;        // steps/s
+    std::vector<double> accel;      // steps/s^2
+    uint32_t samples = 0;
+    bool reversed = false;          // Any sample stepped the wrong way
+    bool sCurve = false;            // Ran as an S-curve
+    double peakVel = 0, peakAccel = 0, peakJerk = 0;
+};
+
+namespace ClearCore {
+
+// The library's test hook: StepGenerator befriends ClearCore::TestIO
+class TestIO : public StepGenerator {
+public:
+    TestIO() { StepsPerSampleMaxSet(STEPS_PER_SAMPLE_MAX); }
+
+    void OutputDirection() override {}
+
+    void limits(uint32_t jerk) {
+        VelMax(VEL_MAX);
+        AccelMax(ACCEL_MAX);
+        JerkMax(jerk);
+    }
+
+    bool sCurve() const { return m_moveState == MS_SCURVE; }
+    int32_t position() const { return m_posnAbsolute; }
+
+    void step() { StepsCalculated(); }
+
+    // Run the current move to completion, or until maxSamples
+    Trace run(uint32_t maxSamples = 1000000) {
+        Trace t;
+        double prevVel = m_velCurrentQx / Q15;
+        double prevAccel = 0;
+        int32_t prevPosn = m_posnAbsolute;
+        bool forward = !m_dirCommanded;
+        while (!StepsComplete() && t.samples < maxSamples) {
+            bool wasSCurve = sCurve();
+            StepsCalculated();
+            t.samples++;
+            // The sample that plans the S-curve also runs it; the last one ends it
+            bool scurve = sCurve() || (wasSCurve && m_moveState == MS_END);
+            if (scurve) t.sCurve = true;
+            double vel = m_velCurrentQx / Q15;
+            double accel = scurve ? m_scAccelQj / QJ : vel - prevVel;
+            int32_t posn = m_posnAbsolute;
+            if (forward ? posn < prevPosn : posn > prevPosn) t.reversed = true;
+            t.posn.push_back(posn);
+            t.vel.push_back(vel * SR);
+            t.accel.push_back(accel * SR * SR);
+            if (vel * SR > t.peakVel) t.peakVel = vel * SR;
+            if (fabs(accel) * SR * SR > t.peakAccel) t.peakAccel = fabs(accel) * SR * SR;
+            double jerk = fabs(accel - prevAccel) * SR * SR * SR;
+            if (jerk > t.peakJerk) t.peakJerk = jerk;
+            prevVel = vel;
+            prevAccel = accel;
+            prevPosn = posn;
+        }
+        return t;
+    }
+};
+
+}
+
+using ClearCore::TestIO;
+
+static Trace runMove(int32_t dist, uint32_t jerk) {
+    TestIO gen;
+    gen.limits(jerk);
+    gen.Move(dist);
+    Trace t = gen.run();
+    CHECK(t.sCurve == (jerk != 0));
+    CHECK(gen.StepsComplete());
+    CHECK(gen.position() == dist);
+    return t;
+}
+
+// Moves of every shape: long with cruise, full accel without cruise,
+// jerk-only, and a few steps
+static void testProfilesAgainstTrapezoid() {
+    printf("distance | trapezoid: ms  peak accel  peak jerk | s-curve: ms  peak accel  peak jerk | max lag\n");
+    const int32_t dists[] = { 1000000, 60000, 12000, 2000, 150, 12, 1 };
+    for (int32_t dist : dists) {
+        Trace trap = runMove(dist, 0);
+        Trace sc = runMove(dist, JERK_MAX);
+
+        // Same end point, never backwards, inside every limit
+        CHECK(trap.posn.back() == dist);
+        CHECK(sc.posn.back() == dist);
+        CHECK(!sc.reversed);
+        CHECK(sc.peakVel <= VEL_MAX * 1.001);
+        CHECK(sc.peakAccel <= ACCEL_MAX * 1.001);
+        if (dist > 1) CHECK(sc.peakJerk <= JERK_MAX * 1.001);
+
+        // The trapezoid steps its acceleration in one sample
+        if (dist >= 2000) CHECK(trap.peakJerk > 10.0 * JERK_MAX);
+
+        // The S-curve pays at most one accel ramp (A/J) plus rounding
+        double rampSamples = static_cast<double>(ACCEL_MAX) / JERK_MAX * SR;
+        CHECK(sc.samples >= trap.samples - 2);
+        if (dist >= 12000) CHECK(sc.samples <= trap.samples + rampSamples + 8);
+
+        // How far the S-curve trails the trapezoid at the same instant
+        int32_t lag = 0;
+        for (size_t i = 0; i < trap.posn.size() && i < sc.posn.size(); i++) {
+            int32_t d = abs(trap.posn[i] - sc.posn[i]);
+            if (d > lag) lag = d;
+        }
+
+        printf("%8d | %13.1f %11.0f %10.3g | %11.1f %11.0f %10.3g | %7d\n",
+               dist, trap.samples * 1000.0 / SR, trap.peakAccel, trap.peakJerk,
+               sc.samples * 1000.0 / SR, sc.peakAccel, sc.peakJerk, lag);
+    }
+}
+
+// No jerk limit: the original trapezoid, sample for sample
+static void testJerkOffIsTrapezoid() {
+    TestIO a, b;
+    a.limits(0);
+    b.VelMax(VEL_MAX);
+    b.AccelMax(ACCEL_MAX);
+    a.Move(25000);
+    b.Move(25000);
+    CHECK(!a.sCurve());
+    Trace ta = a.run(), tb = b.run();
+    CHECK(ta.posn == tb.posn);
+}
+
+// Homing-speed moves: the velocity limit is reached long before the accel limit
+static void testSlowMove() {
+    TestIO gen;
+    gen.limits(JERK_MAX);
+    gen.VelMax(200);
+    gen.Move(4000);
+    Trace t = gen.run();
+    CHECK(t.sCurve);
+    CHECK(gen.position() == 4000);
+    CHECK(t.peakVel <= 200 * 1.001);
+    CHECK(t.peakJerk <= JERK_MAX * 1.001);
+}
+
+// Reverse moves get the same profile mirrored
+static void testNegativeMove() {
+    TestIO gen;
+    gen.limits(JERK_MAX);
+    gen.Move(-8000);
+    Trace t = gen.run();
+    CHECK(gen.position() == -8000);
+    CHECK(!t.reversed);
+    CHECK(t.peakJerk <= JERK_MAX * 1.001);
+}
+
+// A new jerk limit waits for the next move, like the other limits
+static void testJerkLatchedPerMove() {
+    TestIO gen;
+    gen.limits(0);
+    gen.Move(5000);
+    gen.JerkMax(JERK_MAX);
+    gen.step();
+    CHECK(!gen.sCurve());
+    gen.run();
+    gen.Move(5000);
+    gen.step();
+    CHECK(gen.sCurve());
+    gen.run();
+    CHECK(gen.position() == 10000);
+}
+
+// A move issued mid-S-curve merges trapezoidally and still lands on target
+static void testMergeFallsBack() {
+    TestIO gen;
+    gen.limits(JERK_MAX);
+    gen.Move(20000, StepGenerator::MOVE_TARGET_ABSOLUTE);
+    gen.run(300);
+    CHECK(!gen.StepsComplete());
+    gen.Move(5000, StepGenerator::MOVE_TARGET_ABSOLUTE);
+    gen.step();
+    CHECK(!gen.sCurve());
+    gen.run();
+    CHECK(gen.StepsComplete());
+    CHECK(gen.position() == 5000);
+}
+
+// Stop requests still work mid-S-curve
+static void testStopDecel() {
+    TestIO gen;
+    gen.limits(JERK_MAX);
+    gen.Move(60000);
+    gen.run(1500);
+    int32_t at = gen.position();
+    gen.MoveStopDecel();
+    Trace t = gen.run();
+    CHECK(gen.StepsComplete());
+    CHECK(gen.position() >= at);
+    CHECK(gen.position() < 60000);
+    CHECK(!t.reversed);
+}
+
+// CruiseVelocityReached covers the S-curve's cruise segment
+static void testCruiseReported() {
+    TestIO gen;
+    gen.limits(JERK_MAX);
+    gen.Move(60000);
+    bool sawCruise = false;
+    while (!gen.StepsComplete()) {
+        gen.step();
+        if (gen.CruiseVelocityReached()) sawCruise = true;
+    }
+    CHECK(sawCruise);
+}
+
+// MoveProfile's cycle-time model against the generator it mirrors: the
+// move's length, and when it covers each part of the distance, to within a
+// millisecond and a sample. Below a few hundred steps the generator's whole steps trail
+// the model's continuous position, so only the length is checked there.
+static void testMoveProfileMatchesGenerator() {
+    const double TOLERANCE = SR / 1000.0 + 1.0;     // Samples
+    const MoveProfile::Limits limits[] = { MoveProfile::fence(), MoveProfile::table() };
+    const char* const names[] = { "fence", "table" };
+    const float inches[] = { 0.0005f, 0.005f, 0.05f, 0.25f, 1.0f, 2.5f, 10.0f, 40.0f };
+    for (int a = 0; a < 2; a++) {
+        printf("%s inches | generator ms  model ms | worst cover error, samples\n", names[a]);
+        for (int jerk = 1; jerk >= 0; jerk--) {
+            MoveProfile::Limits l = limits[a];
+            l.jerk = jerk ? static_cast<float>(JERK_MAX) : 0.0f;
+            for (float in : inches) {
+                int32_t steps = static_cast<int32_t>(lrintf(in * l.stepsPerInch));
+                Trace t = runMove(steps, static_cast<uint32_t>(l.jerk));
+                MoveProfile::Profile p = MoveProfile::plan(in, l);
+                double model = MoveProfile::seconds(p) * SR;
+
+                CHECK(fabs(model - t.samples) <= TOLERANCE);
+
+                double worst = 0.0;
+                for (int q = 1; q <= 9; q++) {
+                    float part = in * q / 10.0f;
+                    int32_t target = static_cast<int32_t>(ceilf(part * l.stepsPerInch));
+                    uint32_t reached = 0;
+                    while (reached < t.samples && t.posn[reached] < target) reached++;
+                    double cover = MoveProfile::secondsToCover(p, part, l) * SR - (reached + 1);
+                    if (fabs(cover) > fabs(worst)) worst = cover;
+                }
+                if (steps >= 200) CHECK(fabs(worst) <= TOLERANCE);
+
+                printf("%12.4g | %12.1f %9.1f | %+.1f%s\n", in, t.samples * 1000.0 / SR,
+                       model * 1000.0 / SR, worst, jerk ? "" : " (trapezoid)");
+            }
+        }
+    }
+}
+
+int main() {
+    testProfilesAgainstTrapezoid();
+    testJerkOffIsTrapezoid();
+    testSlowMove();
+    testNegativeMove();
+    testJerkLatchedPerMove();
+    testMergeFallsBack();
+    testStopDecel();
+    testCruiseReported();
+    testMoveProfileMatchesGenerator();
+
+    printf(failures ? "%d failure(s)\n" : "all passed\n", failures);
+    return failures ? 1 : 0;
+}
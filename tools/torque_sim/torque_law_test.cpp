@@ -0,0 +1,333 @@
+// torque_law_test.cpp - host test of the Y torque-feed law (TorqueLaw) against
+// a simulated cut, next to the law it replaced.
+//
+//   g++ -std=gnu++11 -I. tools/torque_sim/torque_law_test.cpp TorqueLaw.cpp
+//       -o torque_law_test && ./torque_law_test
+//
+// The plant, stepped at 10 kHz:
+//   - Y follows the commanded velocity at DynamicFeed's feed acceleration.
+//   - In the stock, feed force settles on K * hardness * feed / (D/10 * RPM/3000)
+//     with a first-order lag as chip load builds. Force per in/s falls with rim
+//     speed, which is what the gain schedule undoes. The blade's arc crosses
+//     the stock face and the edges of a hard band over ENGAGE_IN of travel.
+//   - HLFB reports friction plus cutting torque with noise at its 482 Hz PWM rate.
+//   - The blade stalls if torque holds above STALL_PCT for STALL_MS.
+// The law runs from a 1 kHz motion task with scheduling jitter, as on the
+// ClearCore: the new law at its fixed period, the old one on the task's
+// wall-clock dt.
+
+#include "TorqueLaw.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int failures = 0;
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// Plant
+static const double PLANT_DT = 0.0001;
+static const double FEED_ACCEL = 100000.0 * 0.7 / 4065.0;  // in/s^2, DynamicFeed AccelMax / TABLE_STEPS_PER_INCH
+static const double CUT_K = 150.0;              // % per in/s at the schedule's unity point
+static const double CUT_TAU = 0.030;            // s
+static const double ENGAGE_IN = 0.1;
+static const double FRICTION_PCT = 4.0;
+static const double NOISE_PCT = 1.5;            // 1 sigma
+static const double HLFB_PERIOD = 1.0 / 482.0;
+static const double STALL_PCT = 80.0;
+static const double STALL_MS = 20.0;
+
+// Controller side, as DynamicFeed runs it
+static const double TASK_PERIOD = 0.001;        // TASK_PERIOD_MOTION_US
+static const double TASK_JITTER = 0.0003;
+static const double LAW_PERIOD = 0.002;         // TORQUE_PID_PERIOD_US
+static const float MIN_RATE = 0.005f;
+static const float START_FRACTION = 0.15f;
+static const float WRITE_DEADBAND = 0.002f;
+
+// The law this replaces: incremental PID on wall-clock dt, where the dt
+// guard turns each 1 ms pass into a 10 ms step
+struct LegacyLaw {
+    float integral = 0.0f;
+    float prevError = 0.0f;
+
+    float step(float error, float dt, float currentRate, float minRate, float maxRate) {
+        float derivative = (error - prevError) / dt;
+        prevError = error;
+        integral += error * dt;
+        integral = integral > 5.0f ? 5.0f : integral < -5.0f ? -5.0f : integral;
+        float adjustment = 0.00004f * error + 0.01f * integral + 0.02f * derivative;
+        float target = currentRate + adjustment * dt;
+        target = target < minRate ? minRate : target > maxRate ? maxRate : target;
+        float blend = dt * 5.0f;
+        if (blend > 1.0f) blend = 1.0f;
+        return currentRate + (target - currentRate) * blend;
+    }
+};
+
+struct Scenario {
+    const char* name;
+    float diameter;
+    float rpm;
+    float target;           // Torque %
+    float maxRate;          // in/s
+    double entry;           // Stock starts this far into the feed
+    double length;
+    double hardStart;       // Harder band, relative to the stock face
+    double hardEnd;
+    double hardness;
+    double retargetAt;      // Seconds, 0 = never
+    float retarget;
+};
+
+struct Result {
+    bool stalled;
+    double cutSeconds;      // Until the blade leaves the stock
+    double peakPct;         // Highest plant torque in the stock
+    double meanAbsError;    // Once engaged and settled, away from the hard band
+    int velocityWrites;
+};
+
+enum class Law { New, NewUnscheduled, Legacy };
+
+// 0 before, 1 after ENGAGE_IN of travel
+static double ramp(double in) {
+    return in <= 0.0 ? 0.0 : in >= ENGAGE_IN ? 1.0 : in / ENGAGE_IN;
+}
+
+static double noise(unsigned& seed) {
+    // Sum of uniforms, near enough to Gaussian
+    double sum = 0.0;
+    for (int i = 0; i < 12; i++) {
+        seed = seed * 1103515245u + 12345u;
+        sum += ((seed >> 8) & 0xFFFF) / 65536.0;
+    }
+    return (sum - 6.0) * NOISE_PCT;
+}
+
+static Result run(const Scenario& s, Law law) {
+    Result r = { false, 0.0, 0.0, 0.0, 0 };
+    unsigned seed = 12345;
+
+    double scale = (s.diameter / 10.0) * (s.rpm / 3000.0);
+    double pos = 0.0;
+    double vel = 0.0;
+    double cmdVel = 0.0;
+    double cutPct = 0.0;
+    double hlfb = FRICTION_PCT;
+    double nextHlfb = 0.0;
+    double stallMs = 0.0;
+    double errSum = 0.0;
+    long errCount = 0;
+
+    float target = s.target;
+    float rate = START_FRACTION * s.maxRate;
+    float lastWritten = rate;
+    cmdVel = rate;
+
+    TorqueLaw pid;
+    TorqueLaw::Gains gains = law == Law::NewUnscheduled
+        ? TorqueLaw::Gains{ TorqueLaw::KP, TorqueLaw::KI, TorqueLaw::KD }
+        : TorqueLaw::schedule(s.diameter, s.rpm);
+    pid.configure(gains, static_cast<float>(LAW_PERIOD));
+    pid.reset(rate, static_cast<float>(hlfb));
+    double nextLaw = LAW_PERIOD;
+
+    LegacyLaw legacy;
+    double lastLegacyMs = 0.0;
+    double lastLegacyWrite = 0.0;
+
+    double nextTask = TASK_PERIOD;
+    double exitPos = s.entry + s.length;
+    double settledAt = -1.0;
+
+    for (double t = 0.0; t < 60.0; t += PLANT_DT) {
+        // Motor follows the command at the feed acceleration
+        double dv = cmdVel - vel;
+        double maxDv = FEED_ACCEL * PLANT_DT;
+        vel += dv > maxDv ? maxDv : dv < -maxDv ? -maxDv : dv;
+        pos += vel * PLANT_DT;
+
+        bool inStock = pos >= s.entry && pos < exitPos;
+        double depthIn = pos - s.entry;
+        double engaged = inStock ? ramp(depthIn) : 0.0;
+        double hard = 1.0 + (s.hardness - 1.0) * (ramp(depthIn - s.hardStart) - ramp(depthIn - s.hardEnd));
+        double steady = CUT_K * engaged * hard * vel / scale;
+        cutPct += (steady - cutPct) * PLANT_DT / CUT_TAU;
+        double torque = FRICTION_PCT + cutPct;
+
+        if (inStock && torque > r.peakPct) r.peakPct = torque;
+        stallMs = torque > STALL_PCT ? stallMs + PLANT_DT * 1000.0 : 0.0;
+        if (stallMs >= STALL_MS) {
+            r.stalled = true;
+            r.cutSeconds = t;
+            return r;
+        }
+        if (pos >= exitPos) {
+            r.cutSeconds = t;
+            break;
+        }
+
+        if (t >= nextHlfb) {
+            hlfb = torque + noise(seed);
+            hlfb = hlfb < 0.0 ? 0.0 : hlfb > 100.0 ? 100.0 : hlfb;
+            nextHlfb += HLFB_PERIOD;
+        }
+
+        if (s.retargetAt > 0.0 && t >= s.retargetAt) target = s.retarget;
+
+        if (t < nextTask) continue;
+        nextTask += TASK_PERIOD + TASK_JITTER * ((seed >> 16) & 0xFF) / 255.0;
+
+        if (inStock && depthIn >= ENGAGE_IN) {
+            if (settledAt < 0.0) settledAt = t + 0.5;
+            if (t >= settledAt && (depthIn < s.hardStart || depthIn >= s.hardEnd + ENGAGE_IN + 0.1)) {
+                errSum += fabs(torque - target);
+                errCount++;
+            }
+        }
+
+        float measured = static_cast<float>(hlfb);
+        if (law == Law::Legacy) {
+            double nowMs = floor(t * 1000.0);
+            float dt = static_cast<float>((nowMs - lastLegacyMs) / 1000.0);
+            lastLegacyMs = nowMs;
+            if (dt < 0.005f || dt > 0.5f) dt = 0.01f;
+            float previous = rate;
+            rate = legacy.step(target - measured, dt, rate, MIN_RATE, s.maxRate);
+            if (fabsf(rate - previous) > WRITE_DEADBAND || t - lastLegacyWrite > 0.020) {
+                lastLegacyWrite = t;
+                cmdVel = rate;
+                r.velocityWrites++;
+            }
+        }
+        else if (t >= nextLaw) {
+            nextLaw += LAW_PERIOD;
+            if (t >= nextLaw) nextLaw = t + LAW_PERIOD;
+            rate = pid.step(target, measured, MIN_RATE, s.maxRate);
+            if (fabsf(rate - lastWritten) > WRITE_DEADBAND) {
+                lastWritten = rate;
+                cmdVel = rate;
+                r.velocityWrites++;
+            }
+        }
+    }
+    r.meanAbsError = errCount ? errSum / errCount : 0.0;
+    return r;
+}
+
+static void print(const char* label, const Result& r) {
+    printf("    %-12s %s %6.2f s  peak %5.1f%%  |err| %4.1f%%  %5d writes\n", label,
+        r.stalled ? "STALL" : "     ", r.cutSeconds, r.peakPct, r.meanAbsError, r.velocityWrites);
+}
+
+static const Scenario NOMINAL = { "nominal", 10.0f, 3000.0f, 60.0f, 1.0f, 0.25, 3.0, 1.25, 1.75, 1.6, 0.0, 0.0f };
+
+// Nominal cut with a hard band: faster than the old law, no stall
+static void testNominalCut() {
+    printf("10\" blade, 3000 RPM, 60%% target, 1.6x hard band:\n");
+    Result n = run(NOMINAL, Law::New);
+    Result l = run(NOMINAL, Law::Legacy);
+    print("new", n);
+    print("legacy", l);
+    CHECK(!n.stalled);
+    CHECK(n.peakPct < NOMINAL.target + 12.0);
+    CHECK(n.meanAbsError < 4.0);
+    CHECK(n.cutSeconds < l.cutSeconds || l.stalled);
+}
+
+// The fastest cut each law gets through the hard band without stalling,
+// over torque targets up to the stall
+static void testFastestCut() {
+    printf("Fastest stall-free cut through the hard band (stall at %.0f%%):\n", STALL_PCT);
+    const Law laws[2] = { Law::New, Law::Legacy };
+    const char* names[2] = { "new", "legacy" };
+    Result best[2];
+    float bestTarget[2] = { 0.0f, 0.0f };
+    for (int i = 0; i < 2; i++) {
+        for (float target = 40.0f; target < STALL_PCT; target += 2.0f) {
+            Scenario s = NOMINAL;
+            s.target = target;
+            Result r = run(s, laws[i]);
+            if (r.stalled) continue;
+            if (!bestTarget[i] || r.cutSeconds < best[i].cutSeconds) {
+                best[i] = r;
+                bestTarget[i] = target;
+            }
+        }
+        char label[32];
+        snprintf(label, sizeof(label), "%s @%.0f%%", names[i], bestTarget[i]);
+        print(label, best[i]);
+    }
+    CHECK(best[0].cutSeconds < best[1].cutSeconds * 0.8);
+    CHECK(best[0].meanAbsError < 3.0);
+}
+
+// A long air cut at full rate must not wind the integral up before the stock
+static void testLongApproach() {
+    Scenario s = NOMINAL;
+    s.name = "long approach";
+    s.entry = 3.0;
+    printf("3 in of air before the stock:\n");
+    Result n = run(s, Law::New);
+    print("new", n);
+    CHECK(!n.stalled);
+    CHECK(n.peakPct < s.target + 15.0);
+}
+
+// Lowering the target mid-cut backs off without a derivative kick or stall
+static void testRetarget() {
+    Scenario s = NOMINAL;
+    s.hardness = 1.0;
+    s.retargetAt = 3.0;
+    s.retarget = 40.0f;
+    printf("Target 60%% -> 40%% at 3 s:\n");
+    Result n = run(s, Law::New);
+    print("new", n);
+    CHECK(!n.stalled);
+    CHECK(n.peakPct < s.target + 12.0);
+}
+
+// The schedule keeps every blade and speed in the table stable
+static void testScheduleGrid() {
+    const float diameters[] = { 2.0f, 4.0f, 7.0f, 10.0f };
+    const float speeds[] = { 1000.0f, 2000.0f, 3000.0f, 4000.0f };
+    printf("Gain schedule, 1.6x hard band (scheduled / nominal gains):\n");
+    for (float d : diameters) {
+        for (float rpm : speeds) {
+            Scenario s = NOMINAL;
+            s.diameter = d;
+            s.rpm = rpm;
+            // The operator scales the max feed to the blade; the cut is
+            // sized to take about as long as the nominal one
+            float settled = static_cast<float>((s.target - FRICTION_PCT) / CUT_K * (d / 10.0) * (rpm / 3000.0));
+            s.maxRate = 2.5f * settled < 1.0f ? 2.5f * settled : 1.0f;
+            s.length = 3.0 * (d / 10.0) * (rpm / 3000.0);
+            if (s.length < 0.5) s.length = 0.5;
+            s.entry = 0.1 * s.length;
+            s.hardStart = s.length * 0.4;
+            s.hardEnd = s.length * 0.6;
+            Result n = run(s, Law::New);
+            Result u = run(s, Law::NewUnscheduled);
+            char label[32];
+            snprintf(label, sizeof(label), "%4.1f\" %4.0f", d, rpm);
+            print(label, n);
+            print("  unsched", u);
+            CHECK(!n.stalled);
+            CHECK(n.peakPct < s.target + 15.0);
+            CHECK(n.meanAbsError < 5.0);
+            // Scheduling trades no throughput for its tighter tracking:
+            // never slower than nominal by more than a few law periods
+            CHECK(n.cutSeconds <= u.cutSeconds + 0.01);
+        }
+    }
+}
+
+int main() {
+    testNominalCut();
+    testFastestCut();
+    testLongApproach();
+    testRetarget();
+    testScheduleGrid();
+    printf(failures ? "%d FAILED\n" : "All passed\n", failures);
+    return failures ? 1 : 0;
+}